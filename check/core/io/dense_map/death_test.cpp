@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <mcnla/core/io.hpp>
+#include <mcnla/core/la.hpp>
+
+TEST(DenseMapDeathTest, Missing) {
+  using ValType = double;
+  const auto file = "dense_map_death_missing.bin";
+
+  mcnla::matrix::DenseMatrixRowMajor<ValType> a;
+  EXPECT_DEATH(mcnla::io::mapBinary(a, file), "Unable to open");
+  EXPECT_DEATH(mcnla::io::mapBinaryRowBlock(a, file, {0, 1}), "Unable to open");
+}
+
+TEST(DenseMapDeathTest, Short) {
+  using ValType = double;
+  const auto file = "dense_map_death_short.bin";
+
+  // Saves data and drops the last value
+  mcnla::matrix::DenseMatrixRowMajor<ValType> a(4, 3);
+  mcnla::la::memset0(a);
+  mcnla::io::saveBinary(a, file);
+  std::vector<char> bytes;
+  {
+    std::ifstream fin(file, std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(fin), std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream fout(file, std::ios::binary | std::ios::trunc);
+    fout.write(bytes.data(), bytes.size() - sizeof(ValType));
+  }
+
+  mcnla::matrix::DenseMatrixRowMajor<ValType> b;
+  EXPECT_DEATH(mcnla::io::mapBinary(b, file), "Unable to map");
+  std::remove(file);
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <string>
+#include <mcnla/core/io.hpp>
+#include <mcnla/isvd/core/parameters.hpp>
+
+#define MATRIX_A_PATH MCNLA_DATA_PATH "/a.mtx"
+
+TEST(DenseMapBlockTest, Binary) {
+  using ValType = double;
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_root = 0;
+  const auto file = "dense_map_block_" + std::to_string(mpi_size) + ".bin";
+
+  // Reads data
+  mcnla::matrix::DenseMatrixRowMajor<ValType> a;
+  mcnla::io::loadMatrixMarket(a, MATRIX_A_PATH);
+
+  // Sets parameters
+  mcnla::isvd::Parameters<ValType> parameters(mpi_root, mpi_comm);
+  parameters.setSize(a).setRank(1).setOverRank(0).setNumSketchEach(1);
+  parameters.sync();
+
+  // Saves data
+  if ( mpi_rank == mpi_root ) {
+    mcnla::io::saveBinary(a, file.c_str());
+  }
+  MPI_Barrier(mpi_comm);
+
+  // Maps the whole matrix
+  {
+    mcnla::matrix::DenseMatrixRowMajor<ValType> b;
+    mcnla::io::mapBinary(b, file.c_str());
+    ASSERT_EQ(b.sizes(), a.sizes());
+    for ( auto i = 0; i < a.nrow(); ++i ) {
+      for ( auto j = 0; j < a.ncol(); ++j ) {
+        ASSERT_EQ(b(i, j), a(i, j)) << "(i, j) =  (" << i << ", " << j << ")";
+      }
+    }
+  }
+
+  // Maps row-blocks
+  auto aj = a(parameters.rowrange(), ""_);
+  {
+    mcnla::matrix::DenseMatrixRowMajor<ValType> bj;
+    mcnla::io::mapBinaryRowBlock(bj, file.c_str(), parameters.rowrange());
+    ASSERT_EQ(bj.sizes(), aj.sizes());
+    for ( auto i = 0; i < aj.nrow(); ++i ) {
+      for ( auto j = 0; j < aj.ncol(); ++j ) {
+        ASSERT_EQ(bj(i, j), aj(i, j)) << "(i, j) =  (" << i << ", " << j << ")";
+      }
+    }
+  }
+
+  // Maps row-blocks (copy-on-write)
+  {
+    mcnla::matrix::DenseMatrixRowMajor<ValType> bj;
+    mcnla::io::mapBinaryRowBlock(bj, file.c_str(), parameters.rowrange(), mcnla::utility::MapMode::COPY_ON_WRITE);
+    for ( auto i = 0; i < bj.nrow(); ++i ) {
+      for ( auto j = 0; j < bj.ncol(); ++j ) {
+        bj(i, j) = -1.0;
+      }
+    }
+  }
+  MPI_Barrier(mpi_comm);
+
+  // Checks the file is not modified
+  {
+    mcnla::matrix::DenseMatrixRowMajor<ValType> bj;
+    mcnla::io::loadBinaryRowBlock(bj, file.c_str(), parameters.rowrange());
+    ASSERT_EQ(bj.sizes(), aj.sizes());
+    for ( auto i = 0; i < aj.nrow(); ++i ) {
+      for ( auto j = 0; j < aj.ncol(); ++j ) {
+        ASSERT_EQ(bj(i, j), aj(i, j)) << "(i, j) =  (" << i << ", " << j << ")";
+      }
+    }
+  }
+  MPI_Barrier(mpi_comm);
+
+  if ( mpi_rank == mpi_root ) {
+    std::remove(file.c_str());
+  }
+}
+
+TEST(DenseMapBlockTest, Failure) {
+  using ValType = double;
+
+  // Missing file
+  EXPECT_FALSE(bool(mcnla::utility::mapFile<ValType>("dense_map_block_missing.bin", 0, 16)));
+
+  // Not mappable
+  EXPECT_FALSE(bool(mcnla::utility::mapFile<ValType>(".", 0, 16)));
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <string>
+#include <mcnla/core/io.hpp>
+#include <mcnla/isvd/core/parameters.hpp>
+
+#define MATRIX_A_PATH MCNLA_DATA_PATH "/a.mtx"
+
+TEST(DenseSaveBlockTest, Binary) {
+  using ValType = double;
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_root = 0;
+  const auto file = "dense_save_block_" + std::to_string(mpi_size) + ".bin";
+
+  // Reads data
+  mcnla::matrix::DenseMatrixRowMajor<ValType> a;
+  mcnla::io::loadMatrixMarket(a, MATRIX_A_PATH);
+
+  // Sets parameters
+  mcnla::isvd::Parameters<ValType> parameters(mpi_root, mpi_comm);
+  parameters.setSize(a).setRank(1).setOverRank(0).setNumSketchEach(1);
+  parameters.sync();
+
+  // Saves row-blocks
+  auto aj = a(parameters.rowrange(), ""_);
+  mcnla::io::saveBinaryRowBlock(aj, file.c_str(), mpi_comm);
+
+  // Checks result
+  if ( mpi_rank == mpi_root ) {
+    mcnla::matrix::DenseMatrixRowMajor<ValType> b;
+    mcnla::io::loadBinary(b, file.c_str());
+    ASSERT_EQ(b.sizes(), a.sizes());
+    for ( auto i = 0; i < a.nrow(); ++i ) {
+      for ( auto j = 0; j < a.ncol(); ++j ) {
+        ASSERT_EQ(b(i, j), a(i, j)) << "(i, j) =  (" << i << ", " << j << ")";
+      }
+    }
+    std::remove(file.c_str());
+  }
+}
+
+TEST(DenseSaveBlockTest, BinaryColBlock) {
+  using ValType = double;
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_root = 0;
+  const auto file = "dense_save_colblock_" + std::to_string(mpi_size) + ".bin";
+
+  // Reads data
+  mcnla::matrix::DenseMatrixColMajor<ValType> a;
+  mcnla::io::loadMatrixMarket(a, MATRIX_A_PATH);
+
+  // Sets parameters
+  mcnla::isvd::Parameters<ValType> parameters(mpi_root, mpi_comm);
+  parameters.setSize(a).setRank(1).setOverRank(0).setNumSketchEach(1);
+  parameters.sync();
+
+  // Saves column-blocks
+  auto aj = a(""_, parameters.colrange());
+  mcnla::io::saveBinaryColBlock(aj, file.c_str(), mpi_comm);
+
+  // Checks result
+  if ( mpi_rank == mpi_root ) {
+    mcnla::matrix::DenseMatrixColMajor<ValType> b;
+    mcnla::io::loadBinary(b, file.c_str());
+    ASSERT_EQ(b.sizes(), a.sizes());
+    for ( auto i = 0; i < a.nrow(); ++i ) {
+      for ( auto j = 0; j < a.ncol(); ++j ) {
+        ASSERT_EQ(b(i, j), a(i, j)) << "(i, j) =  (" << i << ", " << j << ")";
+      }
+    }
+    std::remove(file.c_str());
+  }
+}
+
+TEST(DenseSaveBlockTest, MatrixMarket) {
+  using ValType = double;
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_root = 0;
+  const auto file = "dense_save_block_" + std::to_string(mpi_size) + ".mtx";
+
+  // Reads data
+  mcnla::matrix::DenseMatrixRowMajor<ValType> a;
+  mcnla::io::loadMatrixMarket(a, MATRIX_A_PATH);
+
+  // Sets parameters
+  mcnla::isvd::Parameters<ValType> parameters(mpi_root, mpi_comm);
+  parameters.setSize(a).setRank(1).setOverRank(0).setNumSketchEach(1);
+  parameters.sync();
+
+  // Saves row-blocks
+  auto aj = a(parameters.rowrange(), ""_);
+  mcnla::io::saveMatrixMarketRowBlock(aj, file.c_str(), mpi_comm);
+
+  // Checks result
+  if ( mpi_rank == mpi_root ) {
+    mcnla::matrix::DenseMatrixRowMajor<ValType> b;
+    mcnla::io::loadMatrixMarket(b, file.c_str());
+    ASSERT_EQ(b.sizes(), a.sizes());
+    for ( auto i = 0; i < a.nrow(); ++i ) {
+      for ( auto j = 0; j < a.ncol(); ++j ) {
+        ASSERT_EQ(b(i, j), a(i, j)) << "(i, j) =  (" << i << ", " << j << ")";
+      }
+    }
+    std::remove(file.c_str());
+  }
+}
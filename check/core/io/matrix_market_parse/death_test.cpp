@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <mcnla/core/io.hpp>
+
+TEST(MatrixMarketParseDeathTest, Missing) {
+  using ValType = double;
+  const auto file = "matrix_market_parse_death_missing.mtx";
+
+  mcnla::matrix::DenseMatrixColMajor<ValType> a;
+  EXPECT_DEATH(mcnla::io::parseMatrixMarket(a, file), "Unable to open");
+}
+
+TEST(MatrixMarketParseDeathTest, Dense) {
+  using ValType = double;
+  const auto file = "matrix_market_parse_death_dense.mtx";
+
+  // Writes data with one less value than the header declares
+  {
+    std::ofstream fout(file);
+    fout << "%%MatrixMarket matrix array real general\n2 2\n1\n2\n3\n";
+  }
+
+  mcnla::matrix::DenseMatrixColMajor<ValType> a;
+  EXPECT_DEATH(mcnla::io::parseMatrixMarket(a, file), "Unable to parse 4 entries, only 3 found");
+  std::remove(file);
+}
+
+TEST(MatrixMarketParseDeathTest, Coo) {
+  using ValType = double;
+  const auto file = "matrix_market_parse_death_coo.mtx";
+
+  // Writes data with one less entry than the header declares
+  {
+    std::ofstream fout(file);
+    fout << "%%MatrixMarket matrix coordinate real general\n3 3 3\n1 1 1\n2 2 2\n";
+  }
+
+  mcnla::matrix::CooMatrixColMajor<ValType> a;
+  EXPECT_DEATH(mcnla::io::parseMatrixMarket(a, file), "Unable to parse 3 entries, only 2 found");
+  std::remove(file);
+}
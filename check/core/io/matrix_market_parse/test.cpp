@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <mcnla/core/io.hpp>
+
+#define MATRIX_A_PATH MCNLA_DATA_PATH "/a.mtx"
+
+TEST(MatrixMarketParseTest, Dense) {
+  using ValType = double;
+
+  mcnla::matrix::DenseMatrixColMajor<ValType> a;
+  mcnla::io::loadMatrixMarket(a, MATRIX_A_PATH);
+
+  mcnla::matrix::DenseMatrixColMajor<ValType> b;
+  mcnla::io::parseMatrixMarket(b, MATRIX_A_PATH);
+  ASSERT_EQ(b.sizes(), a.sizes());
+  for ( auto i = 0; i < a.nrow(); ++i ) {
+    for ( auto j = 0; j < a.ncol(); ++j ) {
+      ASSERT_EQ(b(i, j), a(i, j)) << "(i, j) =  (" << i << ", " << j << ")";
+    }
+  }
+
+  mcnla::matrix::DenseMatrixRowMajor<ValType> c;
+  mcnla::io::parseMatrixMarket(c, MATRIX_A_PATH);
+  ASSERT_EQ(c.sizes(), a.sizes());
+  for ( auto i = 0; i < a.nrow(); ++i ) {
+    for ( auto j = 0; j < a.ncol(); ++j ) {
+      ASSERT_EQ(c(i, j), a(i, j)) << "(i, j) =  (" << i << ", " << j << ")";
+    }
+  }
+}
+
+TEST(MatrixMarketParseTest, Coo) {
+  using ValType = double;
+  const char *file = "matrix_market_parse.mtx";
+
+  const std::string long_val = "0." + std::string(200, '3');
+
+  const int nnz = 8;
+  const int idx0[nnz] = {1, 4, 2, 3, 1, 4, 2, 3};
+  const int idx1[nnz] = {1, 1, 2, 3, 4, 5, 5, 5};
+  const char *val[nnz] = {"3", "-0.5E+3", "0.1", "1e-300", "12345678901234567890123", "-2.494857204606217", "+.25e1",
+                          long_val.c_str()};
+
+  // Writes data
+  {
+    std::ofstream fout(file);
+    fout << "%%MatrixMarket matrix coordinate real general\n% A comment\n4 5 " << nnz << "\n";
+    for ( auto i = 0; i < nnz; ++i ) {
+      fout << idx0[i] << ' ' << idx1[i] << ' ' << val[i] << ((i == 2) ? "\r\n" : "\n");
+    }
+  }
+
+  mcnla::matrix::CooMatrixColMajor<ValType> a;
+  mcnla::io::parseMatrixMarket(a, file);
+  std::remove(file);
+
+  ASSERT_EQ(a.nrow(), 4);
+  ASSERT_EQ(a.ncol(), 5);
+  ASSERT_EQ(a.nnz(), nnz);
+  for ( auto i = 0; i < nnz; ++i ) {
+    EXPECT_EQ(a.idx0Ptr()[i], idx0[i]-1) << "i = " << i;
+    EXPECT_EQ(a.idx1Ptr()[i], idx1[i]-1) << "i = " << i;
+    EXPECT_EQ(a.valPtr()[i], std::strtod(val[i], nullptr)) << "i = " << i;
+  }
+}
+
+TEST(MatrixMarketParseTest, Chunk) {
+  using ValType = double;
+  const char *file = "matrix_market_parse_chunk.mtx";
+
+  const int num = 9;
+  const char *val[num] = {"1", "-22", "0.333", "4444", "5e5", "-66.6", "7", "8.88e-8", "9"};
+
+  // Writes data
+  {
+    std::ofstream fout(file);
+    fout << "%%MatrixMarket matrix array real general\n" << num << " 1\n";
+    for ( auto i = 0; i < num; ++i ) {
+      fout << val[i] << ((i % 2) ? "\r\n" : "\n");
+    }
+  }
+
+  mcnla::index_t sizes[2];
+  const auto text = mcnla::io::detail::mapMatrixMarket(file, sizes, 2);
+  ASSERT_EQ(sizes[0], num);
+  ASSERT_EQ(sizes[1], 1);
+
+  // Lands the chunk boundaries on every byte, including the middle of the lines and the '\r\n' pairs
+  const mcnla::index_t bytes = text.end - text.begin;
+  for ( mcnla::index_t num_chunk = 1; num_chunk <= bytes+1; ++num_chunk ) {
+    std::vector<ValType> a(num, 0.0);
+    std::vector<int> count(num, 0);
+    mcnla::io::detail::parseLines(text, num, num_chunk, [&]( const mcnla::index_t idx, const char *ptr, const char *end ) {
+      for ( auto i = idx; i < num && (ptr = mcnla::io::detail::skipSpace(ptr, end)) < end; ++i ) {
+        ptr = mcnla::io::detail::parseValue(ptr, end, a[i]);
+        ++count[i];
+      }
+    });
+    for ( auto i = 0; i < num; ++i ) {
+      ASSERT_EQ(count[i], 1) << "num_chunk = " << num_chunk << ", i = " << i;
+      ASSERT_EQ(a[i], std::strtod(val[i], nullptr)) << "num_chunk = " << num_chunk << ", i = " << i;
+    }
+  }
+
+  std::remove(file);
+}
+
+TEST(MatrixMarketParseTest, Surplus) {
+  using ValType = double;
+  const char *file = "matrix_market_parse_surplus.mtx";
+
+  // Writes data with one more value than the header declares
+  {
+    std::ofstream fout(file);
+    fout << "%%MatrixMarket matrix array real general\n3 1\n1\n2\n3\n4\n";
+  }
+
+  mcnla::matrix::DenseVector<ValType> a;
+  mcnla::io::parseMatrixMarket(a, file);
+  std::remove(file);
+
+  ASSERT_EQ(a.len(), 3);
+  for ( auto i = 0; i < 3; ++i ) {
+    EXPECT_EQ(a(i), i+1) << "i = " << i;
+  }
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <mcnla/core/io.hpp>
+#include <mcnla/core/la.hpp>
+#include <mcnla/core/mpi.hpp>
+#include <mcnla/isvd/sketcher/row_block_gaussian_projection_sketcher.hpp>
+
+#define MATRIX_A_PATH MCNLA_DATA_PATH "/a.mtx"
+
+static void traceSomething() {
+  using ValType = double;
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_root = 0;
+
+  // Reads data
+  mcnla::matrix::DenseMatrixRowMajor<ValType> a;
+  mcnla::io::loadMatrixMarket(a, MATRIX_A_PATH);
+
+  // Sets parameters
+  mcnla::isvd::Parameters<ValType> parameters(mpi_root, mpi_comm);
+  parameters.setSize(a).setRank(6).setOverRank(6).setNumSketchEach(1);
+  parameters.sync();
+
+  // Initializes sketcher
+  mcnla::isvd::RowBlockGaussianProjectionSketcher<ValType> sketcher(parameters);
+  sketcher.initialize();
+  auto aj  = a(parameters.rowrange(), ""_);
+  auto qij = parameters.createCollectionQj();
+
+  // Runs
+  mcnla::utility::Tracer::instance().start();
+  sketcher(aj, qij);
+  mcnla::matrix::DenseMatrixRowMajor<ValType> b(a.ncol(), a.ncol());
+  mcnla::la::mm(a.t(), a, b);
+  mcnla::mpi::allreduce(b, MPI_SUM, mpi_comm);
+  mcnla::utility::Tracer::instance().stop();
+}
+
+TEST(TraceTest, Events) {
+  traceSomething();
+  const auto &events = mcnla::utility::Tracer::instance().events();
+
+  // Checks stage
+  auto stage = std::find_if(events.begin(), events.end(), [](const mcnla::utility::TraceEvent &event) {
+    return event.category == "stage";
+  });
+  ASSERT_NE(stage, events.end());
+  EXPECT_EQ(stage->depth, 0);
+  EXPECT_LE(stage->begin, stage->end);
+
+  // Checks phases
+  std::vector<std::string> phases;
+  for ( const auto &event : events ) {
+    if ( event.category == "phase" ) {
+      phases.push_back(event.name);
+      EXPECT_EQ(event.depth, stage->depth+1);
+      EXPECT_GE(event.begin, stage->begin - 1e-3);
+      EXPECT_LE(event.end,   stage->end   + 1e-3);
+    }
+  }
+  ASSERT_EQ(phases.size(), 2);
+  EXPECT_EQ(phases[0], "random generating");
+  EXPECT_EQ(phases[1], "projection");
+
+  // Checks BLAS & MPI
+  bool has_gemm = false, has_mpi = false;
+  for ( const auto &event : events ) {
+    if ( event.category == "blas" && event.name == "gemm" && event.depth == 0 ) {
+      has_gemm = true;
+      EXPECT_GT(event.bytes, 0);
+    }
+    if ( event.category == "mpi" && event.name == "MPI_Allreduce" ) {
+      has_mpi = true;
+      EXPECT_GT(event.bytes, 0);
+    }
+  }
+  EXPECT_TRUE(has_gemm);
+  EXPECT_TRUE(has_mpi);
+
+  // Checks disabled
+  const auto num_event = events.size();
+  mcnla::matrix::DenseMatrixRowMajor<double> c(4, 4), d(4, 4);
+  mcnla::la::mm(c, c, d);
+  EXPECT_EQ(events.size(), num_event);
+}
+
+TEST(TraceTest, Binary) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto file = "trace_" + std::to_string(mpi_size) + "_" + std::to_string(mpi_rank) + ".bin";
+
+  traceSomething();
+  const auto &events = mcnla::utility::Tracer::instance().events();
+
+  // Saves & loads
+  mcnla::io::saveBinaryTrace(file.c_str(), mpi_rank);
+  mcnla::mpi_int_t rank;
+  auto events2 = mcnla::io::loadBinaryTrace(file.c_str(), rank);
+  std::remove(file.c_str());
+
+  // Checks result
+  EXPECT_EQ(rank, mpi_rank);
+  ASSERT_EQ(events2.size(), events.size());
+  for ( std::size_t i = 0; i < events.size(); ++i ) {
+    EXPECT_EQ(events2[i].name,     events[i].name)     << "i = " << i;
+    EXPECT_EQ(events2[i].category, events[i].category) << "i = " << i;
+    EXPECT_EQ(events2[i].begin,    events[i].begin)    << "i = " << i;
+    EXPECT_EQ(events2[i].end,      events[i].end)      << "i = " << i;
+    EXPECT_EQ(events2[i].bytes,    events[i].bytes)    << "i = " << i;
+    EXPECT_EQ(events2[i].depth,    events[i].depth)    << "i = " << i;
+  }
+}
+
+TEST(TraceTest, Chrome) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_root = 0;
+  const auto file = "trace_" + std::to_string(mpi_size) + ".json";
+
+  traceSomething();
+  mcnla::io::saveChromeTrace(file.c_str(), mpi_comm, mpi_root);
+
+  // Checks result
+  if ( mpi_rank == mpi_root ) {
+    std::ifstream fin(file);
+    std::stringstream sin;
+    sin << fin.rdbuf();
+    const auto json = sin.str();
+    EXPECT_EQ(json.find("{\"traceEvents\":["), 0);
+    for ( auto i = 0; i < mpi_size; ++i ) {
+      EXPECT_NE(json.find("\"rank " + std::to_string(i) + "\""), std::string::npos) << "i = " << i;
+    }
+    EXPECT_NE(json.find("\"name\":\"MPI_Allreduce\",\"cat\":\"mpi\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"gemm\",\"cat\":\"blas\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"projection\",\"cat\":\"phase\""), std::string::npos);
+    std::remove(file.c_str());
+  }
+}
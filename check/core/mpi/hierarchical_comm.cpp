@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <utility>
+#include <mcnla/core/la.hpp>
+#include <mcnla/core/mpi.hpp>
+#include <mcnla/isvd/core/parameters.hpp>
+
+static void fillVector( mcnla::matrix::DenseVector<double> &v, const mcnla::index_t seed ) {
+  for ( mcnla::index_t i = 0; i < v.len(); ++i ) {
+    v(i) = seed * 100 + i;
+  }
+}
+
+static void expectEqVector( const mcnla::matrix::DenseVector<double> &a, const mcnla::matrix::DenseVector<double> &b ) {
+  ASSERT_EQ(a.len(), b.len());
+  for ( mcnla::index_t i = 0; i < a.len(); ++i ) {
+    ASSERT_EQ(a(i), b(i)) << "(i) = (" << i << ")";
+  }
+}
+
+static void checkSplit( const MPI_Comm comm ) {
+  const auto mpi_size = mcnla::mpi::commSize(comm);
+
+  mcnla::mpi::HierarchicalComm hier_comm(comm);
+  ASSERT_FALSE(hier_comm.isNull());
+
+  // The first process of each node is the leader
+  const auto node_comm = hier_comm.nodeComm();
+  ASSERT_NE(node_comm, MPI_COMM_NULL);
+  const auto node_size = mcnla::mpi::commSize(node_comm);
+  const auto node_rank = mcnla::mpi::commRank(node_comm);
+  ASSERT_EQ(hier_comm.isLeader(), node_rank == 0);
+  ASSERT_EQ(hier_comm.leaderComm() != MPI_COMM_NULL, hier_comm.isLeader());
+
+  // The nodes are shared-memory groups
+  MPI_Comm shared_comm;
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &shared_comm);
+  int cmp;
+  MPI_Comm_compare(node_comm, shared_comm, &cmp);
+  ASSERT_TRUE(cmp == MPI_CONGRUENT || cmp == MPI_SIMILAR);
+  MPI_Comm_free(&shared_comm);
+
+  // The leaders cover all the processes
+  mcnla::mpi_int_t counts[2] = {hier_comm.isLeader(), hier_comm.isLeader() ? node_size : 0};
+  MPI_Allreduce(MPI_IN_PLACE, counts, 2, MPI_INT, MPI_SUM, comm);
+  ASSERT_EQ(counts[1], mpi_size);
+  if ( hier_comm.isLeader() ) {
+    ASSERT_EQ(mcnla::mpi::commSize(hier_comm.leaderComm()), counts[0]);
+  }
+}
+
+TEST(HierarchicalCommTest, Split) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+
+  checkSplit(mpi_comm);
+
+  // Sub-communicator
+  MPI_Comm sub_comm;
+  MPI_Comm_split(mpi_comm, mpi_rank % 2, mpi_rank, &sub_comm);
+  checkSplit(sub_comm);
+  MPI_Comm_free(&sub_comm);
+}
+
+TEST(HierarchicalCommTest, Allreduce) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+
+  mcnla::mpi::HierarchicalComm hier_comm(mpi_comm);
+
+  // Grows and shrinks the window, with lengths not divisible by the node size
+  for ( mcnla::index_t len : {1, 7, 100, 13} ) {
+    mcnla::matrix::DenseVector<double> buffer0(len), buffer1(len);
+    fillVector(buffer0, mpi_rank);
+    fillVector(buffer1, mpi_rank);
+
+    mcnla::mpi::allreduce(buffer0, MPI_SUM, mpi_comm);
+    hier_comm.allreduce(buffer1, MPI_SUM);
+    expectEqVector(buffer0, buffer1);
+  }
+
+  // Matrix
+  mcnla::matrix::DenseMatrixRowMajor<double> a0(5, 3), a1(5, 3);
+  auto a0vec = a0.vec(), a1vec = a1.vec();
+  fillVector(a0vec, mpi_rank);
+  fillVector(a1vec, mpi_rank);
+
+  mcnla::mpi::allreduce(a0, MPI_SUM, mpi_comm);
+  hier_comm.allreduce(a1, MPI_SUM);
+  expectEqVector(a0.vec(), a1.vec());
+}
+
+TEST(HierarchicalCommTest, Move) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const mcnla::index_t len = 9;
+
+  mcnla::mpi::HierarchicalComm hier_comm0(mpi_comm);
+  mcnla::matrix::DenseVector<double> buffer0(len), buffer1(len);
+  fillVector(buffer0, mpi_rank);
+  hier_comm0.allreduce(buffer0, MPI_SUM);
+
+  mcnla::mpi::HierarchicalComm hier_comm1(std::move(hier_comm0));
+  ASSERT_TRUE(hier_comm0.isNull());
+  ASSERT_FALSE(hier_comm1.isNull());
+
+  mcnla::mpi::HierarchicalComm hier_comm2;
+  ASSERT_TRUE(hier_comm2.isNull());
+  hier_comm2 = std::move(hier_comm1);
+  ASSERT_TRUE(hier_comm1.isNull());
+  ASSERT_FALSE(hier_comm2.isNull());
+
+  fillVector(buffer1, mpi_rank);
+  hier_comm2.allreduce(buffer1, MPI_SUM);
+  expectEqVector(buffer0, buffer1);
+}
+
+TEST(HierarchicalCommTest, Parameters) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_root = 0;
+  const mcnla::index_t len = 11;
+
+  mcnla::isvd::Parameters<double> parameters(mpi_root, mpi_comm);
+  parameters.setSize(100, 50).setRank(5).setHierarchical(true);
+  parameters.sync();
+  ASSERT_TRUE(parameters.isHierarchical());
+
+  const auto &cparameters = parameters;
+  const mcnla::mpi::HierarchicalComm &hier_comm = cparameters.hierComm();
+  ASSERT_EQ(&hier_comm, &parameters.hierComm());
+  ASSERT_FALSE(hier_comm.isNull());
+
+  mcnla::matrix::DenseVector<double> buffer0(len), buffer1(len);
+  fillVector(buffer0, mpi_rank);
+  fillVector(buffer1, mpi_rank);
+
+  mcnla::mpi::allreduce(buffer0, MPI_SUM, mpi_comm);
+  cparameters.allreduce(buffer1, MPI_SUM);
+  expectEqVector(buffer0, buffer1);
+}
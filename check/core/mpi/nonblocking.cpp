@@ -0,0 +1,357 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <mcnla/core/la.hpp>
+#include <mcnla/core/mpi.hpp>
+
+static void fillVector( mcnla::matrix::DenseVector<double> &v, const mcnla::index_t seed ) {
+  for ( mcnla::index_t i = 0; i < v.len(); ++i ) {
+    v(i) = seed * 100 + i;
+  }
+}
+
+static void expectEqVector( const mcnla::matrix::DenseVector<double> &a, const mcnla::matrix::DenseVector<double> &b ) {
+  ASSERT_EQ(a.len(), b.len());
+  for ( mcnla::index_t i = 0; i < a.len(); ++i ) {
+    ASSERT_EQ(a(i), b(i)) << "(i) = (" << i << ")";
+  }
+}
+
+TEST(NonblockingTest, Allgather) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const mcnla::index_t len = 5;
+
+  mcnla::matrix::DenseVector<double> send(len), recv0(len*mpi_size), recv1(len*mpi_size);
+  fillVector(send, mpi_rank);
+
+  mcnla::mpi::allgather(send, recv0, mpi_comm);
+  auto request = mcnla::mpi::iallgather(send, recv1, mpi_comm);
+  ASSERT_FALSE(request.isNull());
+  request.wait();
+  ASSERT_TRUE(request.isNull());
+
+  expectEqVector(recv0, recv1);
+}
+
+TEST(NonblockingTest, Allreduce) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const mcnla::index_t len = 7;
+
+  mcnla::matrix::DenseVector<double> send(len), recv0(len), recv1(len);
+  fillVector(send, mpi_rank);
+
+  mcnla::mpi::allreduce(send, recv0, MPI_SUM, mpi_comm);
+  mcnla::mpi::iallreduce(send, recv1, MPI_SUM, mpi_comm).wait();
+  expectEqVector(recv0, recv1);
+
+  // In-place
+  mcnla::matrix::DenseVector<double> buffer0(len), buffer1(len);
+  fillVector(buffer0, mpi_rank);
+  fillVector(buffer1, mpi_rank);
+
+  mcnla::mpi::allreduce(buffer0, MPI_MAX, mpi_comm);
+  mcnla::mpi::iallreduce(buffer1, MPI_MAX, mpi_comm).wait();
+  expectEqVector(buffer0, buffer1);
+
+  // Matrix
+  mcnla::matrix::DenseMatrixColMajor<double> a(3, 4), b0(3, 4), b1(3, 4);
+  auto avec = a.vec();
+  fillVector(avec, mpi_rank);
+
+  mcnla::mpi::allreduce(a, b0, MPI_SUM, mpi_comm);
+  mcnla::mpi::iallreduce(a, b1, MPI_SUM, mpi_comm).wait();
+  expectEqVector(b0.vec(), b1.vec());
+}
+
+TEST(NonblockingTest, Alltoall) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const mcnla::index_t len = 3;
+
+  mcnla::matrix::DenseVector<double> send(len*mpi_size), recv0(len*mpi_size), recv1(len*mpi_size);
+  fillVector(send, mpi_rank);
+
+  mcnla::mpi::alltoall(send, recv0, mpi_comm);
+  mcnla::mpi::ialltoall(send, recv1, mpi_comm).wait();
+  expectEqVector(recv0, recv1);
+
+  // In-place
+  mcnla::matrix::DenseVector<double> buffer0(len*mpi_size), buffer1(len*mpi_size);
+  fillVector(buffer0, mpi_rank);
+  fillVector(buffer1, mpi_rank);
+
+  mcnla::mpi::alltoall(buffer0, mpi_comm);
+  mcnla::mpi::ialltoall(buffer1, mpi_comm).wait();
+  expectEqVector(buffer0, buffer1);
+}
+
+TEST(NonblockingTest, Bcast) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_root = mcnla::mpi::commSize(mpi_comm) - 1;
+  const mcnla::index_t len = 6;
+
+  mcnla::matrix::DenseVector<double> buffer0(len), buffer1(len);
+  fillVector(buffer0, mpi_rank);
+  fillVector(buffer1, mpi_rank);
+
+  mcnla::mpi::bcast(buffer0, mpi_root, mpi_comm);
+  mcnla::mpi::ibcast(buffer1, mpi_root, mpi_comm).wait();
+  expectEqVector(buffer0, buffer1);
+}
+
+TEST(NonblockingTest, Gather) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const auto mpi_root = mpi_size - 1;
+  const mcnla::index_t len = 4;
+
+  mcnla::matrix::DenseVector<double> send(len), recv0(len*mpi_size), recv1(len*mpi_size);
+  fillVector(send, mpi_rank);
+  fillVector(recv0, -1);
+  fillVector(recv1, -1);
+
+  mcnla::mpi::gather(send, recv0, mpi_root, mpi_comm);
+  mcnla::mpi::igather(send, recv1, mpi_root, mpi_comm).wait();
+  expectEqVector(recv0, recv1);
+}
+
+TEST(NonblockingTest, Gatherv) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const auto mpi_root = mpi_size - 1;
+
+  std::vector<mcnla::mpi_int_t> counts(mpi_size), displs(mpi_size);
+  mcnla::mpi_int_t total = 0;
+  for ( auto i = 0; i < mpi_size; ++i ) {
+    counts[i] = i + 1;
+    displs[i] = total;
+    total += counts[i];
+  }
+
+  mcnla::matrix::DenseVector<double> send(counts[mpi_rank]), recv0(total), recv1(total);
+  fillVector(send, mpi_rank);
+  fillVector(recv0, -1);
+  fillVector(recv1, -1);
+
+  mcnla::mpi::gatherv(send, recv0, counts.data(), displs.data(), mpi_root, mpi_comm);
+  mcnla::mpi::igatherv(send, recv1, counts.data(), displs.data(), mpi_root, mpi_comm).wait();
+  expectEqVector(recv0, recv1);
+}
+
+TEST(NonblockingTest, Reduce) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_root = mcnla::mpi::commSize(mpi_comm) - 1;
+  const mcnla::index_t len = 5;
+
+  mcnla::matrix::DenseVector<double> send(len), recv0(len), recv1(len);
+  fillVector(send, mpi_rank);
+  fillVector(recv0, -1);
+  fillVector(recv1, -1);
+
+  mcnla::mpi::reduce(send, recv0, MPI_SUM, mpi_root, mpi_comm);
+  mcnla::mpi::ireduce(send, recv1, MPI_SUM, mpi_root, mpi_comm).wait();
+  expectEqVector(recv0, recv1);
+
+  // In-place
+  mcnla::matrix::DenseVector<double> buffer0(len), buffer1(len);
+  fillVector(buffer0, mpi_rank);
+  fillVector(buffer1, mpi_rank);
+
+  mcnla::mpi::reduce(buffer0, MPI_MIN, mpi_root, mpi_comm);
+  mcnla::mpi::ireduce(buffer1, MPI_MIN, mpi_root, mpi_comm).wait();
+  expectEqVector(buffer0, buffer1);
+}
+
+TEST(NonblockingTest, ReduceScatterBlock) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const mcnla::index_t len = 3;
+
+  mcnla::matrix::DenseVector<double> send(len*mpi_size), recv0(len), recv1(len);
+  fillVector(send, mpi_rank);
+
+  mcnla::mpi::reduceScatterBlock(send, recv0, MPI_SUM, mpi_comm);
+  mcnla::mpi::ireduceScatterBlock(send, recv1, MPI_SUM, mpi_comm).wait();
+  expectEqVector(recv0, recv1);
+}
+
+TEST(NonblockingTest, Scatter) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const auto mpi_root = mpi_size - 1;
+  const mcnla::index_t len = 4;
+
+  mcnla::matrix::DenseVector<double> send(len*mpi_size), recv0(len), recv1(len);
+  fillVector(send, mpi_rank);
+
+  mcnla::mpi::scatter(send, recv0, mpi_root, mpi_comm);
+  mcnla::mpi::iscatter(send, recv1, mpi_root, mpi_comm).wait();
+  expectEqVector(recv0, recv1);
+}
+
+TEST(NonblockingTest, Scatterv) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const auto mpi_root = mpi_size - 1;
+
+  std::vector<mcnla::mpi_int_t> counts(mpi_size), displs(mpi_size);
+  mcnla::mpi_int_t total = 0;
+  for ( auto i = 0; i < mpi_size; ++i ) {
+    counts[i] = mpi_size - i;
+    displs[i] = total;
+    total += counts[i];
+  }
+
+  mcnla::matrix::DenseVector<double> send(total), recv0(counts[mpi_rank]), recv1(counts[mpi_rank]);
+  fillVector(send, mpi_rank);
+
+  mcnla::mpi::scatterv(send, recv0, counts.data(), displs.data(), mpi_root, mpi_comm);
+  mcnla::mpi::iscatterv(send, recv1, counts.data(), displs.data(), mpi_root, mpi_comm).wait();
+  expectEqVector(recv0, recv1);
+}
+
+TEST(NonblockingTest, SendRecv) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const auto mpi_next = (mpi_rank + 1) % mpi_size;
+  const auto mpi_prev = (mpi_rank + mpi_size - 1) % mpi_size;
+  const mcnla::index_t len = 6;
+
+  mcnla::matrix::DenseVector<double> send(len), recv0(len), recv1(len);
+  fillVector(send, mpi_rank);
+
+  // Blocking ring (even ranks send first)
+  if ( mpi_size == 1 ) {
+    mcnla::la::copy(send, recv0);
+  } else if ( mpi_rank % 2 == 0 ) {
+    mcnla::mpi::send(send, mpi_next, 0, mpi_comm);
+    mcnla::mpi::recv(recv0, mpi_prev, 0, mpi_comm);
+  } else {
+    mcnla::mpi::recv(recv0, mpi_prev, 0, mpi_comm);
+    mcnla::mpi::send(send, mpi_next, 0, mpi_comm);
+  }
+
+  // Nonblocking ring
+  auto recv_request = mcnla::mpi::irecv(recv1, mpi_prev, 1, mpi_comm);
+  auto send_request = mcnla::mpi::isend(send, mpi_next, 1, mpi_comm);
+  auto status = recv_request.wait();
+  send_request.wait();
+
+  ASSERT_EQ(status.MPI_SOURCE, mpi_prev);
+  ASSERT_EQ(status.MPI_TAG, 1);
+  expectEqVector(recv0, recv1);
+}
+
+TEST(NonblockingTest, WaitAll) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const mcnla::index_t len = 4;
+
+  mcnla::matrix::DenseVector<double> send(len), recv0(len), recv1(len), recv2(len*mpi_size), recv3(len*mpi_size);
+  fillVector(send, mpi_rank);
+  mcnla::mpi::allreduce(send, recv0, MPI_SUM, mpi_comm);
+  mcnla::mpi::allgather(send, recv2, mpi_comm);
+
+  // Vector of requests
+  {
+    std::vector<mcnla::mpi::Request> requests;
+    requests.push_back(mcnla::mpi::iallreduce(send, recv1, MPI_SUM, mpi_comm));
+    requests.push_back(mcnla::mpi::iallgather(send, recv3, mpi_comm));
+    mcnla::mpi::waitAll(requests);
+    for ( auto &request : requests ) {
+      ASSERT_TRUE(request.isNull());
+    }
+    expectEqVector(recv0, recv1);
+    expectEqVector(recv2, recv3);
+  }
+
+  // Variadic
+  {
+    fillVector(recv1, -1);
+    fillVector(recv3, -1);
+    auto request1 = mcnla::mpi::iallreduce(send, recv1, MPI_SUM, mpi_comm);
+    auto request3 = mcnla::mpi::iallgather(send, recv3, mpi_comm);
+    mcnla::mpi::waitAll(request1, request3);
+    ASSERT_TRUE(request1.isNull());
+    ASSERT_TRUE(request3.isNull());
+    expectEqVector(recv0, recv1);
+    expectEqVector(recv2, recv3);
+  }
+}
+
+TEST(NonblockingTest, TestAll) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const mcnla::index_t len = 4;
+
+  mcnla::matrix::DenseVector<double> send(len), recv0(len), recv1(len);
+  fillVector(send, mpi_rank);
+  mcnla::mpi::allreduce(send, recv0, MPI_SUM, mpi_comm);
+
+  std::vector<mcnla::mpi::Request> requests;
+  requests.push_back(mcnla::mpi::iallreduce(send, recv1, MPI_SUM, mpi_comm));
+  requests.emplace_back();
+  while ( !mcnla::mpi::testAll(requests) ) {}
+  ASSERT_TRUE(requests[0].isNull());
+  ASSERT_TRUE(mcnla::mpi::testAll(requests));
+  expectEqVector(recv0, recv1);
+
+  // Single request
+  mcnla::mpi::Request request = mcnla::mpi::iallreduce(send, recv1, MPI_SUM, mpi_comm);
+  while ( !request.test() ) {}
+  ASSERT_TRUE(request.isNull());
+  ASSERT_TRUE(request.test());
+  expectEqVector(recv0, recv1);
+}
+
+TEST(NonblockingTest, WaitSome) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_root = mcnla::mpi::commSize(mpi_comm) - 1;
+  const mcnla::index_t len = 4;
+
+  mcnla::matrix::DenseVector<double> send(len), recv0(len), recv1(len), buffer0(len), buffer1(len);
+  fillVector(send, mpi_rank);
+  fillVector(buffer0, mpi_rank);
+  fillVector(buffer1, mpi_rank);
+  mcnla::mpi::allreduce(send, recv0, MPI_SUM, mpi_comm);
+  mcnla::mpi::bcast(buffer0, mpi_root, mpi_comm);
+
+  std::vector<mcnla::mpi::Request> requests;
+  requests.push_back(mcnla::mpi::iallreduce(send, recv1, MPI_SUM, mpi_comm));
+  requests.push_back(mcnla::mpi::ibcast(buffer1, mpi_root, mpi_comm));
+
+  std::vector<bool> completed(requests.size(), false);
+  std::vector<mcnla::mpi_int_t> indices;
+  mcnla::mpi_int_t num_completed = 0;
+  while ( num_completed < static_cast<mcnla::mpi_int_t>(requests.size()) ) {
+    auto count = mcnla::mpi::waitSome(requests, indices);
+    ASSERT_GT(count, 0);
+    ASSERT_EQ(static_cast<mcnla::mpi_int_t>(indices.size()), count);
+    for ( auto idx : indices ) {
+      ASSERT_FALSE(completed[idx]);
+      ASSERT_TRUE(requests[idx].isNull());
+      completed[idx] = true;
+    }
+    num_completed += count;
+  }
+
+  // All requests are null
+  ASSERT_EQ(mcnla::mpi::waitSome(requests, indices), 0);
+  ASSERT_TRUE(indices.empty());
+
+  expectEqVector(recv0, recv1);
+  expectEqVector(buffer0, buffer1);
+}
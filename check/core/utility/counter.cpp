@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <mcnla/core/la.hpp>
+#include <mcnla/core/utility/counter.hpp>
+
+TEST(CounterTest, Diagonal) {
+  using ValType = double;
+  const mcnla::index_t m = 8, n = 5;
+  const auto &counter = mcnla::utility::Counter::instance();
+
+  mcnla::matrix::DenseVector<ValType> d(m);
+  mcnla::matrix::DenseMatrixColMajor<ValType> b(m, n), c(m, n);
+  for ( auto i = 0; i < m; ++i ) {
+    d(i) = i+1;
+  }
+  mcnla::la::memset0(b);
+
+  // C := D * B
+  auto flops = counter.flops(), bytes = counter.bytes();
+  mcnla::la::mm(d.diag(), b, c);
+  EXPECT_DOUBLE_EQ(counter.flops() - flops, 2.0 * m * n);
+  EXPECT_DOUBLE_EQ(counter.bytes() - bytes, sizeof(ValType) * (m + 3.0 * m * n));
+
+  // B := inv(D) * B
+  flops = counter.flops(), bytes = counter.bytes();
+  mcnla::la::sm(d.diag().inv(), b);
+  EXPECT_DOUBLE_EQ(counter.flops() - flops, 1.0 * m * n);
+  EXPECT_DOUBLE_EQ(counter.bytes() - bytes, sizeof(ValType) * (m + 2.0 * m * n));
+}
+
+TEST(CounterTest, Thread) {
+  using ValType = double;
+  const mcnla::index_t m = 8, n = 5;
+  const auto &counter = mcnla::utility::Counter::instance();
+
+  mcnla::matrix::DenseMatrixColMajor<ValType> a(m, n), c(m, m);
+  mcnla::la::memset0(a);
+
+  // Counts the operations of another thread
+  const auto flops = counter.flops();
+  double thread_flops = 0.0;
+  std::thread thread([&]() {
+    const auto flops0 = mcnla::utility::Counter::instance().flops();
+    mcnla::la::mm(a, a.t(), c);
+    thread_flops = mcnla::utility::Counter::instance().flops() - flops0;
+  });
+  thread.join();
+
+  EXPECT_DOUBLE_EQ(thread_flops, 2.0 * m * m * n);
+  EXPECT_EQ(counter.flops(), flops);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <mcnla/core/matrix.hpp>
+#include <mcnla/core/utility/memory_pool.hpp>
+
+TEST(MemoryPoolTest, Reuse) {
+  using ValType = double;
+  auto &pool = mcnla::utility::MemoryPool::instance();
+  mcnla::utility::MemoryBackendGuard guard(mcnla::utility::MemoryBackend::POOL);
+
+  const auto stats0 = pool.stats();
+  const ValType *ptr;
+  {
+    mcnla::matrix::DenseVector<ValType> vec(100);
+    ptr = vec.valPtr();
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % 64, 0);
+
+    const auto stats = pool.stats();
+    EXPECT_EQ(stats.allocations - stats0.allocations, 1);
+    EXPECT_EQ(stats.bytes_requested - stats0.bytes_requested, 100 * sizeof(ValType));
+    EXPECT_GE(stats.bytes_in_use - stats0.bytes_in_use, 100 * sizeof(ValType));
+    EXPECT_GE(stats.peak_bytes, stats.bytes_in_use);
+  }
+
+  const auto stats1 = pool.stats();
+  EXPECT_EQ(stats1.deallocations - stats0.deallocations, 1);
+  EXPECT_EQ(stats1.bytes_in_use, stats0.bytes_in_use);
+  EXPECT_GT(stats1.bytes_cached, 0);
+  EXPECT_GT(stats1.fragmentation(), 0.0);
+  EXPECT_LE(stats1.fragmentation(), 1.0);
+
+  {
+    mcnla::matrix::DenseVector<ValType> vec(99);  // in the same size class
+    EXPECT_EQ(vec.valPtr(), ptr);
+    EXPECT_EQ(pool.stats().reuses - stats1.reuses, 1);
+  }
+
+  pool.release();
+  EXPECT_EQ(pool.stats().bytes_cached, 0);
+}
+
+TEST(MemoryPoolTest, Backend) {
+  using ValType = double;
+  auto &pool = mcnla::utility::MemoryPool::instance();
+
+  EXPECT_EQ(mcnla::utility::memoryBackend(), mcnla::utility::MemoryBackend::SYSTEM);
+  {
+    mcnla::utility::MemoryBackendGuard guard(mcnla::utility::MemoryBackend::POOL);
+    EXPECT_EQ(mcnla::utility::memoryBackend(), mcnla::utility::MemoryBackend::POOL);
+    {
+      mcnla::utility::MemoryBackendGuard guard2(mcnla::utility::MemoryBackend::SYSTEM);
+      EXPECT_EQ(mcnla::utility::memoryBackend(), mcnla::utility::MemoryBackend::SYSTEM);
+
+      const auto allocations = pool.stats().allocations;
+      mcnla::matrix::DenseVector<ValType> vec(100);
+      EXPECT_EQ(pool.stats().allocations, allocations);
+    }
+    EXPECT_EQ(mcnla::utility::memoryBackend(), mcnla::utility::MemoryBackend::POOL);
+  }
+  EXPECT_EQ(mcnla::utility::memoryBackend(), mcnla::utility::MemoryBackend::SYSTEM);
+
+  // Sets the global memory backend
+  mcnla::utility::setMemoryBackend(mcnla::utility::MemoryBackend::POOL);
+  {
+    const auto allocations = pool.stats().allocations;
+    mcnla::matrix::DenseVector<ValType> vec(100);
+    EXPECT_EQ(pool.stats().allocations - allocations, 1);
+  }
+  mcnla::utility::setMemoryBackend(mcnla::utility::MemoryBackend::SYSTEM);
+}
+
+TEST(MemoryPoolTest, Numa) {
+  using ValType = double;
+  const mcnla::index_t len = 1 << 20;
+  mcnla::utility::MemoryBackendGuard guard(mcnla::utility::MemoryBackend::NUMA);
+
+  const auto allocations = mcnla::utility::Counter::instance().allocations();
+  mcnla::matrix::DenseVector<ValType> vec(len);
+  EXPECT_EQ(mcnla::utility::Counter::instance().allocations() - allocations, 1);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(vec.valPtr()) % 4096, 0);
+
+  // Checks first touch
+  for ( auto i = 0; i < len; ++i ) {
+    ASSERT_EQ(vec(i), 0.0) << "i = " << i;
+  }
+}
+
+TEST(MemoryPoolTest, HugePage) {
+  auto &pool = mcnla::utility::MemoryPool::instance();
+  const std::size_t huge_bytes = std::size_t(4) << 20;
+  pool.release();
+
+  // Aligns the large blocks to huge pages
+  pool.setHugePage(true);
+  EXPECT_TRUE(pool.isHugePage());
+  auto ptr = pool.allocate(huge_bytes);
+  ASSERT_NE(ptr, nullptr);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % (std::size_t(1) << 21), 0);
+  pool.deallocate(ptr, huge_bytes);
+  pool.release();
+
+  // Toggles huge pages while other threads allocate
+  std::vector<std::thread> threads;
+  for ( auto t = 0; t < 4; ++t ) {
+    threads.emplace_back([&pool, huge_bytes]() {
+      for ( auto i = 0; i < 16; ++i ) {
+        auto ptr = pool.allocate(huge_bytes);
+        EXPECT_NE(ptr, nullptr);
+        pool.deallocate(ptr, huge_bytes);
+        pool.release();
+      }
+    });
+  }
+  for ( auto i = 0; i < 10000; ++i ) {
+    pool.setHugePage(i % 2);
+  }
+  for ( auto &thread : threads ) {
+    thread.join();
+  }
+
+  pool.setHugePage(false);
+  EXPECT_FALSE(pool.isHugePage());
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <mcnla/isvd/converter.hpp>
+#include <mcnla/core/io/matrix_market.hpp>
+
+#define MATRIX_Q_PATH MCNLA_DATA_PATH "/q.mtx"
+
+TEST(MatrixRowBlockConverterTest, Test) {
+  using ValType = double;
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto mpi_root = 0;
+
+  // Reads data
+  mcnla::matrix::DenseMatrixRowMajor<ValType> q_true;
+  mcnla::io::loadMatrixMarket(q_true, MATRIX_Q_PATH);
+
+  // Gets size
+  const mcnla::index_t m  = q_true.nrow();
+  const mcnla::index_t k  = q_true.ncol() / 2;
+  const mcnla::index_t p  = q_true.ncol() - k;
+  const mcnla::index_t Nj = 1;
+
+  // Sets parameters
+  mcnla::isvd::Parameters<ValType> parameters(mpi_root, mpi_comm);
+  parameters.setSize(m, m).setRank(k).setOverRank(p).setNumSketchEach(Nj);
+  parameters.sync();
+
+  // Initializes converter
+  mcnla::isvd::MatrixToRowBlockConverter<double> pre_converter(parameters);
+  mcnla::isvd::MatrixFromRowBlockConverter<double> post_converter(parameters);
+  mcnla::isvd::MatrixFromRowBlockToAllConverter<double> all_converter(parameters);
+  pre_converter.initialize();
+  post_converter.initialize();
+  all_converter.initialize();
+
+  // Creates matrices
+  auto q     = parameters.createMatrixQbar();
+  auto qj    = parameters.createMatrixQbarj();
+  auto q_out = parameters.createMatrixQbar();
+  auto q_all = parameters.createMatrixQbar();
+
+  // Copies data
+  mcnla::la::copy(q_true, q);
+
+  // Converts
+  pre_converter(q, qj);
+  post_converter(qj, q_out);
+  all_converter(qj, q_all);
+
+  // Checks result
+  ASSERT_NE(q_all.valPtr(), qj.valPtr());
+  for ( auto i = 0; i < m; ++i ) {
+    for ( auto j = 0; j < k+p; ++j ) {
+      ASSERT_EQ(q_all(i, j), q_true(i, j)) << "(i, j) = (" << i << ", " << j << ")";
+    }
+  }
+  if ( mpi_rank == mpi_root ) {
+    ASSERT_NE(q_out.valPtr(), qj.valPtr());
+    for ( auto i = 0; i < m; ++i ) {
+      for ( auto j = 0; j < k+p; ++j ) {
+        ASSERT_EQ(q_out(i, j), q_true(i, j)) << "(i, j) = (" << i << ", " << j << ")";
+      }
+    }
+  }
+}
+
+TEST(MatrixRowBlockConverterTest, ZeroCopy) {
+  using ValType = double;
+  const auto mpi_comm = MPI_COMM_SELF;
+  const auto mpi_root = 0;
+
+  // Each MPI node converts on its own communicator, which has a single MPI node
+
+  // Reads data
+  mcnla::matrix::DenseMatrixRowMajor<ValType> q_true;
+  mcnla::io::loadMatrixMarket(q_true, MATRIX_Q_PATH);
+
+  // Gets size
+  const mcnla::index_t m  = q_true.nrow();
+  const mcnla::index_t k  = q_true.ncol() / 2;
+  const mcnla::index_t p  = q_true.ncol() - k;
+  const mcnla::index_t Nj = 1;
+
+  // Sets parameters
+  mcnla::isvd::Parameters<ValType> parameters(mpi_root, mpi_comm);
+  parameters.setSize(m, m).setRank(k).setOverRank(p).setNumSketchEach(Nj);
+  parameters.sync();
+
+  // Initializes converter
+  mcnla::isvd::MatrixToRowBlockConverter<double> pre_converter(parameters);
+  mcnla::isvd::MatrixFromRowBlockConverter<double> post_converter(parameters);
+  mcnla::isvd::CollectionToRowBlockConverter<double> collection_converter(parameters);
+  pre_converter.initialize();
+  post_converter.initialize();
+  collection_converter.initialize();
+
+  // Creates matrices
+  auto q = parameters.createMatrixQbar();
+  auto collection_q = parameters.createCollectionQ();
+  mcnla::matrix::DenseMatrixRowMajor<ValType> qj, q_out;
+  mcnla::matrix::DenseMatrixCollectionColBlockRowMajor<ValType> collection_qj;
+
+  // Copies data
+  mcnla::la::copy(q_true, q);
+
+  // Converts
+  pre_converter(q, qj);
+  post_converter(qj, q_out);
+  collection_converter(collection_q, collection_qj);
+
+  // Checks result
+  ASSERT_EQ(qj.valPtr(), q.valPtr());
+  ASSERT_EQ(q_out.valPtr(), q.valPtr());
+  ASSERT_EQ(collection_qj.sizes(), collection_q.sizes());
+  ASSERT_EQ(collection_qj.unfold().valPtr(), collection_q.unfold().valPtr());
+}
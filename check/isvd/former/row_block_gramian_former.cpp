@@ -78,3 +78,65 @@ TEST(RowBlockGramianFormerTest, Test) {
     }
   }
 }
+
+TEST(RowBlockGramianFormerTest, ValuesOnly) {
+  using ValType = double;
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_root = 0;
+
+  // Reads data
+  mcnla::matrix::DenseMatrixRowMajor<ValType> a;
+  mcnla::matrix::DenseMatrixRowMajor<ValType> q_true;
+  mcnla::io::loadMatrixMarket(a, MATRIX_A_PATH);
+  mcnla::io::loadMatrixMarket(q_true, MATRIX_Q_PATH);
+
+  // Checks size
+  ASSERT_EQ(a.nrow(), q_true.nrow());
+
+  // Gets size
+  const mcnla::index_t m  = a.nrow();
+  const mcnla::index_t n  = a.ncol();
+  const mcnla::index_t k  = q_true.ncol() / 2;
+  const mcnla::index_t p  = q_true.ncol() - k;
+  const mcnla::index_t Nj = 1;
+
+  // Sets parameters
+  mcnla::isvd::Parameters<ValType> parameters(mpi_root, mpi_comm);
+  parameters.setSize(m, n).setRank(k).setOverRank(p).setNumSketchEach(Nj);
+  parameters.sync();
+
+  // Initializes former
+  mcnla::isvd::RowBlockGramianFormer<ValType, true> former(parameters);
+  mcnla::isvd::RowBlockGramianFormer<ValType, true> former_values(parameters);
+  former_values.setValuesOnly(true);
+  former.initialize();
+  former_values.initialize();
+
+  // Initializes converter
+  mcnla::isvd::MatrixToRowBlockConverter<double> pre_converter(parameters);
+  pre_converter.initialize();
+
+  // Creates matrices
+  auto q  = parameters.createMatrixQbar();
+  auto qj = parameters.createMatrixQbarj();
+  auto aj = a(parameters.rowrange(), ""_);
+
+  // Copies data
+  mcnla::la::copy(q_true, q);
+
+  // Integrates
+  pre_converter(q, qj);
+  former(aj, qj);
+  former_values(aj, qj);
+
+  // Checks result
+  const auto &s        = former.vectorS();
+  const auto &s_values = former_values.vectorS();
+  ASSERT_EQ(s_values.len(), k);
+  for ( auto i = 0; i < k; ++i ) {
+    ASSERT_NEAR(s_values(i), s(i), 1e-10 * s(0)) << "i = " << i;
+    if ( i > 0 ) {
+      ASSERT_GE(s_values(i-1), s_values(i)) << "i = " << i;
+    }
+  }
+}
@@ -74,3 +74,217 @@ TEST(RowBlockKolmogorovNagumoIntegratorTest, Test) {
     }
   }
 }
+
+// The shared setup of the integrator variants
+class RowBlockKolmogorovNagumoIntegratorVariantTest : public testing::Test {
+
+ protected:
+
+  using ValType = double;
+
+  const MPI_Comm mpi_comm = MPI_COMM_WORLD;
+  const mcnla::mpi_int_t mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const mcnla::mpi_int_t mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const mcnla::mpi_int_t mpi_root = 0;
+
+  mcnla::matrix::DenseMatrixCollectionColBlockRowMajor<ValType> qi_true;
+  mcnla::matrix::DenseMatrixRowMajor<ValType> qbar_true;
+
+  mcnla::index_t m, k, N, Nj;
+
+  mcnla::isvd::Parameters<ValType> parameters{mpi_root, mpi_comm};
+
+  mcnla::matrix::DenseMatrixCollectionColBlockRowMajor<ValType> qij;
+  mcnla::matrix::DenseMatrixRowMajor<ValType> qbar, qbarj;
+
+  void SetUp() override {
+    // Reads data
+    mcnla::io::loadMatrixMarket(qi_true, COLLECTION_Q_PATH);
+    mcnla::io::loadMatrixMarket(qbar_true, MATRIX_Q_PATH);
+
+    // Checks size
+    ASSERT_EQ(qi_true.nrow(), qbar_true.nrow());
+    ASSERT_EQ(qi_true.ncol(), qbar_true.ncol());
+
+    // Gets size
+    m  = qi_true.nrow();
+    k  = qi_true.ncol();
+    N  = qi_true.nmat();
+    Nj = N / mpi_size;
+    ASSERT_EQ(N % mpi_size, 0);
+  }
+
+  // Sets the parameters and distributes the leading k columns of the sketches
+  void sync() {
+    parameters.setSize(m, k).setRank(k).setOverRank(0).setNumSketchEach(Nj);
+    parameters.sync();
+
+    mcnla::isvd::CollectionToRowBlockConverter<ValType> pre_converter(parameters);
+    pre_converter.initialize();
+
+    auto qi = parameters.createCollectionQ();
+    qij     = parameters.createCollectionQj();
+    qbar    = parameters.createMatrixQbar();
+    qbarj   = parameters.createMatrixQbarj();
+
+    for ( auto i = 0; i < Nj; i++ ) {
+      mcnla::la::copy(qi_true(mpi_rank*Nj + i)(""_, {0, k}), qi(i));
+    }
+    pre_converter(qi, qij);
+  }
+
+  // Integrates and gathers Qbar to the root
+  void integrate( mcnla::isvd::RowBlockKolmogorovNagumoIntegrator<ValType> &integrator ) {
+    mcnla::isvd::MatrixFromRowBlockConverter<ValType> post_converter(parameters);
+    post_converter.initialize();
+
+    integrator(qij, qbarj);
+    post_converter(qbarj, qbar);
+  }
+
+  // Creates an orthonormal Qbar orthogonal to the sketches (requires N*k < m)
+  mcnla::matrix::DenseMatrixRowMajor<ValType> createOrthogonalQbar() {
+    mcnla::matrix::DenseMatrixRowMajor<ValType> qs(m, N*k);
+    for ( auto i = 0; i < N; ++i ) {
+      mcnla::la::copy(qi_true(i)(""_, {0, k}), qs(""_, {i*k, (i+1)*k}));
+    }
+
+    // eig( Qs * Qs' ) = Z' * S * Z; the leading rows of Z span the null space of Qs'
+    mcnla::matrix::DenseSymmetricMatrixRowMajor<ValType> z(m);
+    mcnla::matrix::DenseVector<ValType> s(m);
+    mcnla::la::memset0(z.full());
+    mcnla::la::rk(qs, z);
+    mcnla::la::syev<'V'>(z, s);
+
+    mcnla::matrix::DenseMatrixRowMajor<ValType> qbar0(m, k);
+    for ( auto ir = 0; ir < m; ++ir ) {
+      for ( auto ic = 0; ic < k; ++ic ) {
+        qbar0(ir, ic) = z.full()(ic, ir);
+      }
+    }
+    return qbar0;
+  }
+
+  // Checks Qbar entrywise
+  void checkQbar() {
+    if ( mpi_rank == mpi_root ) {
+      ASSERT_EQ(qbar.sizes(), qbar_true.sizes());
+      for ( auto ir = 0; ir < m; ++ir ) {
+        for ( auto ic = 0; ic < k; ++ic ) {
+          ASSERT_NEAR(qbar(ir, ic), qbar_true(ir, ic), 1e-8) << "(ir, ic) =  (" << ir << ", " << ic << ")";
+        }
+      }
+    }
+  }
+
+  // Checks the subspace: k - norm( Qbar0' * Qbar )_F^2 = 0
+  void checkSubspace( const mcnla::matrix::DenseMatrixRowMajor<ValType> &qbar0, const ValType tol ) {
+    if ( mpi_rank == mpi_root ) {
+      ASSERT_EQ(qbar.sizes(), qbar0.sizes());
+      mcnla::matrix::DenseMatrixRowMajor<ValType> qtq(k, k);
+      mcnla::la::mm(qbar0.t(), qbar, qtq);
+      ASSERT_NEAR(mcnla::la::dot(qtq.vec()), k, tol);
+    }
+  }
+
+};
+
+TEST_F(RowBlockKolmogorovNagumoIntegratorVariantTest, Momentum) {
+  sync();
+
+  mcnla::isvd::RowBlockKolmogorovNagumoIntegrator<ValType> integrator0(parameters, 256, 1e-4);
+  integrator0.initialize();
+  integrate(integrator0);
+
+  mcnla::isvd::RowBlockKolmogorovNagumoIntegrator<ValType> integrator(parameters, 256, 1e-4, 0.9);
+  integrator.initialize();
+  integrate(integrator);
+
+  // Converges in fewer iterations than without momentum
+  ASSERT_LT(integrator.iteration(), integrator0.iteration());
+  checkSubspace(qbar_true, 1e-3);
+}
+
+TEST_F(RowBlockKolmogorovNagumoIntegratorVariantTest, Hierarchical) {
+  parameters.setHierarchical(true);
+  sync();
+
+  mcnla::isvd::RowBlockKolmogorovNagumoIntegrator<ValType> integrator(parameters, 256, 1e-4);
+  integrator.initialize();
+  integrate(integrator);
+
+  ASSERT_LT(integrator.iteration(), integrator.maxIteration());
+  checkQbar();
+}
+
+TEST_F(RowBlockKolmogorovNagumoIntegratorVariantTest, WarmStart) {
+  sync();
+
+  mcnla::isvd::RowBlockKolmogorovNagumoIntegrator<ValType> integrator(parameters, 256, 1e-6);
+  integrator.initialize();
+  integrate(integrator);
+  const auto qbar0 = qbar.copy();
+  const auto iteration0 = integrator.iteration();
+
+  // Integrates again from the previous result
+  const auto qbar0j = qbarj.copy();
+  integrator.setInitialQbar(qbar0j);
+  integrate(integrator);
+
+  ASSERT_LT(integrator.iteration(), iteration0);
+  checkSubspace(qbar0, 1e-4);
+}
+
+TEST_F(RowBlockKolmogorovNagumoIntegratorVariantTest, WarmStartOrthogonal) {
+  // Uses two columns of each sketch, so that the sketches do not span the whole space
+  k = 2;
+  sync();
+
+  mcnla::isvd::RowBlockKolmogorovNagumoIntegrator<ValType> integrator(parameters, 256, 1e-4);
+  integrator.initialize();
+  integrate(integrator);
+  const auto qbar0 = qbar.copy();
+  const auto iteration0 = integrator.iteration();
+
+  // Integrates again from a Qbar orthogonal to the sketches, which falls back to Q0
+  const auto qbar_orth = createOrthogonalQbar();
+  const auto qbar_orthj = qbar_orth(parameters.rowrange(), ""_);
+  integrator.setInitialQbar(qbar_orthj);
+  integrate(integrator);
+
+  ASSERT_EQ(integrator.iteration(), iteration0);
+  checkSubspace(qbar0, 1e-8);
+}
+
+TEST_F(RowBlockKolmogorovNagumoIntegratorVariantTest, Callback) {
+  sync();
+
+  mcnla::isvd::RowBlockKolmogorovNagumoIntegrator<ValType> integrator(parameters, 256, 1e-4);
+  integrator.initialize();
+
+  // Stops after 5 iterations
+  integrator.setCallback([]( const mcnla::isvd::IterationRecord<ValType> &record ) { return record.iteration == 4; });
+  integrate(integrator);
+
+  ASSERT_EQ(integrator.iteration(), 5);
+  ASSERT_EQ(integrator.records().size(), 5);
+  for ( auto i = 0; i < 5; ++i ) {
+    const auto &record = integrator.records()[i];
+    ASSERT_EQ(record.iteration, i);
+    ASSERT_GT(record.residual, 0.0);
+    ASSERT_GE(record.compute_time, 0.0);
+    ASSERT_GE(record.comm_time, 0.0);
+  }
+}
+
+TEST_F(RowBlockKolmogorovNagumoIntegratorVariantTest, MixedPrecision) {
+  sync();
+
+  mcnla::isvd::RowBlockKolmogorovNagumoIntegrator<ValType> integrator(parameters, 256, 1e-4);
+  integrator.setMixedPrecision(true);
+  integrator.initialize();
+  integrate(integrator);
+
+  ASSERT_LT(integrator.iteration(), integrator.maxIteration());
+  checkSubspace(qbar_true, 1e-3);
+}
@@ -37,3 +37,110 @@ TEST(RowBlockGaussianProjectionSketcherTest, Test) {
   // Sketches
   sketcher(aj, qij);
 }
+
+TEST(RowBlockGaussianProjectionSketcherTest, Tile) {
+  using ValType = double;
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_root = 0;
+  const mcnla::index_t seed = 1234;
+
+  // Reads data
+  mcnla::matrix::DenseMatrixRowMajor<ValType> a;
+  mcnla::io::loadMatrixMarket(a, MATRIX_A_PATH);
+
+  // Gets size
+  const mcnla::index_t m  = a.nrow();
+  const mcnla::index_t n  = a.ncol();
+  const mcnla::index_t k  = 6;
+  const mcnla::index_t p  = 6;
+  const mcnla::index_t Nj = 3;
+  const mcnla::index_t l  = k+p;
+
+  // Sets parameters
+  mcnla::isvd::Parameters<ValType> parameters(mpi_root, mpi_comm);
+  parameters.setSize(m, n).setRank(k).setOverRank(p).setNumSketchEach(Nj);
+  parameters.sync();
+
+  const mcnla::index_t N  = parameters.numSketch();
+  const mcnla::index_t Nt = (N-1) / 2 + 1;
+
+  // Initializes sketcher
+  mcnla::isvd::RowBlockGaussianProjectionSketcher<ValType> sketcher(parameters, seed);
+  ASSERT_EQ(sketcher.memoryRequirement(), sizeof(ValType) * n * l * N);
+  sketcher.setNumTile(2);
+  ASSERT_EQ(sketcher.memoryRequirement(), sizeof(ValType) * n * l * Nt);
+  sketcher.initialize();
+
+  // Creates matrices
+  auto aj  = a(parameters.rowrange(), ""_);
+  auto qij = parameters.createCollectionQj();
+  auto qij_true = parameters.createCollectionQj();
+
+  // Sketches
+  sketcher(aj, qij);
+  ASSERT_EQ(sketcher.times().size(), 2);
+
+  // Sketches tile by tile
+  mcnla::random::Streams streams(seed);
+  mcnla::matrix::DenseMatrixRowMajor<ValType> omegas(n, l * Nt);
+  for ( mcnla::index_t i = 0; i < N; i += Nt ) {
+    const mcnla::matrix::IdxRange range = {i, std::min(i+Nt, N)};
+    auto qijt_true = qij_true(range);
+    mcnla::random::gaussian(streams, omegas.vec());
+    mcnla::la::mm(aj, omegas(""_, {0_i, range.len() * l}), qijt_true.unfold());
+  }
+
+  // Checks result
+  for ( auto i = 0; i < parameters.nrowRank(); ++i ) {
+    for ( auto j = 0; j < l * N; ++j ) {
+      ASSERT_EQ(qij.unfold()(i, j), qij_true.unfold()(i, j)) << "(i, j) = (" << i << ", " << j << ")";
+    }
+  }
+}
+
+TEST(RowBlockGaussianProjectionSketcherTest, Count) {
+  using ValType = double;
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_root = 0;
+
+  // Reads data
+  mcnla::matrix::DenseMatrixRowMajor<ValType> a;
+  mcnla::io::loadMatrixMarket(a, MATRIX_A_PATH);
+
+  // Gets size
+  const mcnla::index_t m  = a.nrow();
+  const mcnla::index_t n  = a.ncol();
+  const mcnla::index_t k  = 6;
+  const mcnla::index_t p  = 6;
+  const mcnla::index_t Nj = 3;
+  const mcnla::index_t l  = k+p;
+
+  // Sets parameters
+  mcnla::isvd::Parameters<ValType> parameters(mpi_root, mpi_comm);
+  parameters.setSize(m, n).setRank(k).setOverRank(p).setNumSketchEach(Nj);
+  parameters.sync();
+  const mcnla::index_t mj = parameters.nrowRank();
+  const mcnla::index_t N  = parameters.numSketch();
+
+  // Initializes sketcher
+  mcnla::isvd::RowBlockGaussianProjectionSketcher<ValType> sketcher(parameters);
+  sketcher.initialize();
+  EXPECT_EQ(sketcher.flops(), 0.0);
+
+  // Creates matrices
+  auto aj  = a(parameters.rowrange(), ""_);
+  auto qij = parameters.createCollectionQj();
+
+  // Sketches
+  sketcher(aj, qij);
+
+  // Checks result
+  EXPECT_DOUBLE_EQ(sketcher.flops(), 2.0 * mj * n * l * N);
+  EXPECT_DOUBLE_EQ(sketcher.bytesMoved(), sizeof(ValType) * (1.0 * mj * n + 1.0 * n * l * N + 2.0 * mj * l * N));
+  EXPECT_EQ(sketcher.commBytes(), 0.0);
+  EXPECT_GE(sketcher.gflops(), 0.0);
+
+  // Sketches again
+  sketcher(aj, qij);
+  EXPECT_DOUBLE_EQ(sketcher.flops(), 2.0 * mj * n * l * N);
+}
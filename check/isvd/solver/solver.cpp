@@ -0,0 +1,490 @@
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <gtest/gtest.h>
+#include <mcnla/isvd/core/configuration.hpp>
+#include <mcnla/isvd/solver.hpp>
+#include <mcnla/core/io/matrix_market.hpp>
+
+#ifdef _OPENMP
+  #include <omp.h>
+#endif  // _OPENMP
+
+#define MATRIX_A_PATH MCNLA_DATA_PATH "/a.mtx"
+
+TEST(SolverTest, RowBlock) {
+  using ValType = double;
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_root = 0;
+  const mcnla::index_t seed = 1234;
+
+  // Reads data
+  mcnla::matrix::DenseMatrixRowMajor<ValType> a;
+  mcnla::io::loadMatrixMarket(a, MATRIX_A_PATH);
+
+  // Gets size
+  const mcnla::index_t m  = a.nrow();
+  const mcnla::index_t n  = a.ncol();
+  const mcnla::index_t k  = 10;
+  const mcnla::index_t p  = 12;
+  const mcnla::index_t Nj = 2;
+
+  // Sets parameters
+  mcnla::isvd::Parameters<ValType> parameters(mpi_root, mpi_comm);
+  parameters.setSize(m, n).setRank(k).setOverRank(p).setNumSketchEach(Nj);
+  parameters.sync();
+
+  // Initializes solver
+  mcnla::isvd::Solver<mcnla::isvd::RowBlockGaussianProjectionSketcher<ValType>,
+                      mcnla::isvd::RowBlockGramianOrthogonalizer<ValType>,
+                      mcnla::isvd::RowBlockKolmogorovNagumoIntegrator<ValType>,
+                      mcnla::isvd::RowBlockGramianFormer<ValType, true>> solver(parameters);
+  solver.sketcher().setSeed(seed);
+  solver.initialize();
+
+  // Initializes stages
+  mcnla::isvd::RowBlockGaussianProjectionSketcher<ValType> sketcher(parameters, seed);
+  mcnla::isvd::RowBlockGramianOrthogonalizer<ValType> orthogonalizer(parameters);
+  mcnla::isvd::RowBlockKolmogorovNagumoIntegrator<ValType> integrator(parameters);
+  mcnla::isvd::RowBlockGramianFormer<ValType, true> former(parameters);
+  sketcher.initialize();
+  orthogonalizer.initialize();
+  integrator.initialize();
+  former.initialize();
+
+  // Creates matrices
+  auto aj    = a(parameters.rowrange(), ""_);
+  auto qij   = parameters.createCollectionQj();
+  auto qbarj = parameters.createMatrixQbarj();
+
+  // Runs
+  solver(aj);
+  sketcher(aj, qij);
+  orthogonalizer(qij);
+  integrator(qij, qbarj);
+  former(aj, qbarj);
+
+  // Checks workspace
+  ASSERT_EQ(solver.workspaceSize(), qij.unfold().pitch() * parameters.nrowEach() + qbarj.pitch() * parameters.nrowEach());
+
+  // Checks result
+  ASSERT_TRUE(solver.isComputed());
+  ASSERT_EQ(solver.integrator().iteration(), integrator.iteration());
+  ASSERT_EQ(solver.former().vectorS().sizes(), former.vectorS().sizes());
+  for ( auto i = 0; i < k; ++i ) {
+    ASSERT_EQ(solver.former().vectorS()(i), former.vectorS()(i)) << "i = " << i;
+  }
+  ASSERT_EQ(solver.former().matrixUj().sizes(), former.matrixUj().sizes());
+  for ( auto ir = 0; ir < parameters.nrowRank(); ++ir ) {
+    for ( auto ic = 0; ic < k; ++ic ) {
+      ASSERT_EQ(solver.former().matrixUj()(ir, ic), former.matrixUj()(ir, ic)) << "(ir, ic) =  (" << ir << ", " << ic << ")";
+    }
+  }
+}
+
+TEST(SolverTest, ColBlock) {
+  using ValType = double;
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const auto mpi_root = 0;
+  const mcnla::index_t seed = 1234;
+
+  // Reads data
+  mcnla::matrix::DenseMatrixColMajor<ValType> a;
+  mcnla::io::loadMatrixMarket(a, MATRIX_A_PATH);
+
+  // Gets size
+  const mcnla::index_t m  = a.nrow();
+  const mcnla::index_t n  = a.ncol();
+  const mcnla::index_t k  = 10;
+  const mcnla::index_t p  = 12;
+  const mcnla::index_t Nj = 2;
+
+  // Sets parameters
+  mcnla::isvd::Parameters<ValType> parameters(mpi_root, mpi_comm);
+  parameters.setSize(m, n).setRank(k).setOverRank(p).setNumSketchEach(Nj);
+  parameters.sync();
+
+  // Initializes solver
+  mcnla::isvd::Solver<mcnla::isvd::ColBlockGaussianProjectionSketcher<ValType>,
+                      mcnla::isvd::RowBlockGramianOrthogonalizer<ValType>,
+                      mcnla::isvd::RowBlockKolmogorovNagumoIntegrator<ValType>,
+                      mcnla::isvd::ColBlockGramianFormer<ValType, true>> solver(parameters);
+  solver.sketcher().setSeed(seed);
+  solver.initialize();
+
+  // Initializes stages
+  mcnla::isvd::ColBlockGaussianProjectionSketcher<ValType> sketcher(parameters, seed);
+  mcnla::isvd::RowBlockGramianOrthogonalizer<ValType> orthogonalizer(parameters);
+  mcnla::isvd::RowBlockKolmogorovNagumoIntegrator<ValType> integrator(parameters);
+  mcnla::isvd::ColBlockGramianFormer<ValType, true> former(parameters);
+  mcnla::isvd::CollectionFromPartialSumToRowBlockConverter<ValType> so_converter(parameters);
+  mcnla::isvd::MatrixFromRowBlockToAllConverter<ValType> if_converter(parameters);
+  sketcher.initialize();
+  orthogonalizer.initialize();
+  integrator.initialize();
+  former.initialize();
+  so_converter.initialize();
+  if_converter.initialize();
+
+  // Creates matrices
+  auto ajc   = a(""_, parameters.colrange());
+  auto qijp  = parameters.createCollectionQjp();
+  auto qij   = parameters.createCollectionQj();
+  auto qbarj = parameters.createMatrixQbarj();
+  auto qbar  = parameters.createMatrixQbar();
+
+  // Runs
+  solver(ajc);
+  sketcher(ajc, qijp);
+  so_converter(qijp, qij);
+  orthogonalizer(qij);
+  integrator(qij, qbarj);
+  if_converter(qbarj, qbar);
+  former(ajc, qbar);
+
+  // Checks workspace
+  const mcnla::index_t size_qijp  = qijp.unfold().pitch() * parameters.nrowTotal();
+  const mcnla::index_t size_qij   = qij.unfold().pitch() * parameters.nrowEach();
+  const mcnla::index_t size_qbarj = qbarj.pitch() * parameters.nrowEach();
+  const mcnla::index_t size_qbar  = qbar.pitch() * parameters.nrowTotal();
+  if ( mpi_size > 1 ) {
+    ASSERT_EQ(solver.workspaceSize(), std::max(size_qijp, size_qbar) + std::max(size_qij, size_qbarj));
+  } else {
+    ASSERT_EQ(solver.workspaceSize(), size_qijp + size_qbarj);
+  }
+  ASSERT_LT(solver.workspaceSize(), size_qijp + size_qij + size_qbarj + size_qbar);
+
+  // Checks result
+  ASSERT_TRUE(solver.isComputed());
+  ASSERT_EQ(solver.integrator().iteration(), integrator.iteration());
+  ASSERT_EQ(solver.former().vectorS().sizes(), former.vectorS().sizes());
+  for ( auto i = 0; i < k; ++i ) {
+    ASSERT_EQ(solver.former().vectorS()(i), former.vectorS()(i)) << "i = " << i;
+  }
+  ASSERT_EQ(solver.former().matrixU().sizes(), former.matrixU().sizes());
+  for ( auto ir = 0; ir < m; ++ir ) {
+    for ( auto ic = 0; ic < k; ++ic ) {
+      ASSERT_EQ(solver.former().matrixU()(ir, ic), former.matrixU()(ir, ic)) << "(ir, ic) =  (" << ir << ", " << ic << ")";
+    }
+  }
+}
+
+TEST(SolverTest, Plan) {
+  using ValType = double;
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_root = 0;
+  const mcnla::index_t seed = 1234;
+
+  // Reads data
+  mcnla::matrix::DenseMatrixRowMajor<ValType> a;
+  mcnla::io::loadMatrixMarket(a, MATRIX_A_PATH);
+
+  // Gets size
+  const mcnla::index_t m  = a.nrow();
+  const mcnla::index_t n  = a.ncol();
+  const mcnla::index_t k  = 10;
+  const mcnla::index_t p  = 12;
+  const mcnla::index_t Nj = 2;
+
+  // Sets parameters
+  mcnla::isvd::Parameters<ValType> parameters(mpi_root, mpi_comm);
+  parameters.setSize(m, n).setRank(k).setOverRank(p).setNumSketchEach(Nj);
+  parameters.sync();
+
+  // Initializes solver
+  mcnla::isvd::Solver<mcnla::isvd::RowBlockGaussianProjectionSketcher<ValType>,
+                      mcnla::isvd::RowBlockGramianOrthogonalizer<ValType>,
+                      mcnla::isvd::RowBlockKolmogorovNagumoIntegrator<ValType>,
+                      mcnla::isvd::RowBlockGramianFormer<ValType, true>> solver(parameters);
+  solver.sketcher().setSeed(seed);
+  solver.initialize();
+
+  // Runs
+  auto aj = a(parameters.rowrange(), ""_);
+  solver(aj);
+  ASSERT_EQ(solver.allocations(), 0);
+  auto s = solver.former().vectorS().copy();
+  auto uj = solver.former().matrixUj().copy();
+  const auto iteration = solver.integrator().iteration();
+
+  // Runs again
+  solver(aj);
+  ASSERT_EQ(solver.allocations(), 0);
+
+  // Checks result
+  ASSERT_EQ(solver.integrator().iteration(), iteration);
+  for ( auto i = 0; i < k; ++i ) {
+    ASSERT_EQ(solver.former().vectorS()(i), s(i)) << "i = " << i;
+  }
+  for ( auto ir = 0; ir < parameters.nrowRank(); ++ir ) {
+    for ( auto ic = 0; ic < k; ++ic ) {
+      ASSERT_EQ(solver.former().matrixUj()(ir, ic), uj(ir, ic)) << "(ir, ic) =  (" << ir << ", " << ic << ")";
+    }
+  }
+}
+
+TEST(SolverTest, MemoryLimit) {
+  using ValType = double;
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_root = 0;
+
+  // Reads data
+  mcnla::matrix::DenseMatrixRowMajor<ValType> a;
+  mcnla::io::loadMatrixMarket(a, MATRIX_A_PATH);
+
+  // Gets size
+  const mcnla::index_t m  = a.nrow();
+  const mcnla::index_t n  = a.ncol();
+  const mcnla::index_t k  = 10;
+  const mcnla::index_t p  = 12;
+  const mcnla::index_t Nj = 4;
+
+  // Sets parameters
+  mcnla::isvd::Parameters<ValType> parameters(mpi_root, mpi_comm);
+  parameters.setSize(m, n).setRank(k).setOverRank(p).setNumSketchEach(Nj);
+  parameters.sync();
+
+  using SolverType = mcnla::isvd::Solver<mcnla::isvd::RowBlockGaussianProjectionSketcher<ValType>,
+                                         mcnla::isvd::RowBlockGramianOrthogonalizer<ValType>,
+                                         mcnla::isvd::RowBlockKolmogorovNagumoIntegrator<ValType>,
+                                         mcnla::isvd::RowBlockGramianFormer<ValType, true>>;
+
+  // Gets memory requirement
+  SolverType solver0(parameters);
+  const auto bytes = solver0.memoryRequirement();
+  const auto bytes_sketcher = solver0.sketcher().memoryRequirement();
+  solver0.initialize();
+  ASSERT_EQ(bytes, solver0.sketcher().memoryRequirement() + solver0.orthogonalizer().memoryRequirement()
+                 + solver0.integrator().memoryRequirement() + solver0.former().memoryRequirement()
+                 + sizeof(ValType) * solver0.workspaceSize());
+
+  // Sets memory limit
+  const auto limit = bytes - bytes_sketcher / 2;
+  parameters.setMemoryLimit(limit);
+  parameters.sync();
+
+  // Initializes solver
+  SolverType solver(parameters);
+  solver.initialize();
+  ASSERT_GT(solver.sketcher().numTile(), 1);
+  ASSERT_LE(solver.memoryRequirement(), limit);
+  ASSERT_TRUE(solver.fitsMemoryLimit());
+
+  // Runs
+  auto aj = a(parameters.rowrange(), ""_);
+  solver(aj);
+  ASSERT_TRUE(solver.isComputed());
+  for ( auto i = 0; i < k; ++i ) {
+    ASSERT_GT(solver.former().vectorS()(i), 0) << "i = " << i;
+  }
+
+  // Sets an unreachable memory limit
+  parameters.setMemoryLimit(1);
+  parameters.sync();
+  SolverType solver2(parameters);
+  solver2.initialize();
+  ASSERT_FALSE(solver2.fitsMemoryLimit());
+}
+
+TEST(SolverTest, Registry) {
+  using ValType = double;
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_root = 0;
+  const mcnla::index_t seed = 1234;
+
+  // Reads data
+  mcnla::matrix::DenseMatrixRowMajor<ValType> a;
+  mcnla::io::loadMatrixMarket(a, MATRIX_A_PATH);
+
+  // Gets size
+  const mcnla::index_t m  = a.nrow();
+  const mcnla::index_t n  = a.ncol();
+  const mcnla::index_t k  = 10;
+  const mcnla::index_t p  = 12;
+  const mcnla::index_t Nj = 2;
+
+  // Sets parameters
+  mcnla::isvd::Parameters<ValType> parameters(mpi_root, mpi_comm);
+  parameters.setSize(m, n).setRank(k).setOverRank(p).setNumSketchEach(Nj);
+  parameters.sync();
+
+  // Creates solvers
+  const auto &registry = mcnla::isvd::SolverRegistry<mcnla::isvd::RowBlockDistTag, ValType>::instance();
+  ASSERT_EQ(registry.entries().size(), 30);
+  ASSERT_EQ(registry.create("RowBlockGaussianProjectionSketcher", "RowBlockGramianOrthogonalizer",
+                            "NoSuchIntegrator", "RowBlockGramianFormer", parameters), nullptr);
+  auto solver0 = registry.create("RowBlockGaussianProjectionSketcher", "RowBlockGramianOrthogonalizer",
+                                 "RowBlockWenYinIntegrator", "RowBlockGramianFormer", parameters);
+  ASSERT_NE(solver0, nullptr);
+
+  mcnla::isvd::Solver<mcnla::isvd::RowBlockGaussianProjectionSketcher<ValType>,
+                      mcnla::isvd::RowBlockGramianOrthogonalizer<ValType>,
+                      mcnla::isvd::RowBlockWenYinIntegrator<ValType>,
+                      mcnla::isvd::RowBlockGramianFormer<ValType, true>> solver(parameters);
+
+  // Initializes solvers
+  ASSERT_TRUE(solver0->setSeed(seed));
+  ASSERT_TRUE(solver0->setMaxIteration(64));
+  ASSERT_TRUE(solver0->setTolerance(1e-4));
+  solver0->initialize();
+  solver.sketcher().setSeed(seed);
+  solver.integrator().setMaxIteration(64).setTolerance(1e-4);
+  solver.initialize();
+
+  // Runs
+  auto aj = a(parameters.rowrange(), ""_);
+  (*solver0)(aj);
+  solver(aj);
+
+  // Checks result
+  std::ostringstream name0, name;
+  name0 << solver0->integrator();
+  name  << solver.integrator();
+  ASSERT_EQ(name0.str(), name.str());
+  ASSERT_TRUE(solver0->isComputed());
+  ASSERT_EQ(solver0->workspaceSize(), solver.workspaceSize());
+  ASSERT_EQ(solver0->iteration(), solver.integrator().iteration());
+  for ( auto i = 0; i < k; ++i ) {
+    ASSERT_EQ(solver0->vectorS()(i), solver.former().vectorS()(i)) << "i = " << i;
+  }
+  ASSERT_EQ(solver0->matrixU().sizes(), solver.former().matrixUj().sizes());
+  ASSERT_EQ(solver0->matrixV().sizes(), solver.former().matrixVj().sizes());
+  for ( auto ir = 0; ir < parameters.nrowRank(); ++ir ) {
+    for ( auto ic = 0; ic < k; ++ic ) {
+      ASSERT_EQ(solver0->matrixU()(ir, ic), solver.former().matrixUj()(ir, ic))
+          << "(ir, ic) =  (" << ir << ", " << ic << ")";
+    }
+  }
+
+  // Checks the solvers without parameters
+  auto solver1 = registry.create("RowBlockGaussianProjectionSketcher", "RowBlockGramianOrthogonalizer",
+                                 "RowBlockReductionIntegrator", "RowBlockGramianFormer", parameters);
+  ASSERT_NE(solver1, nullptr);
+  ASSERT_FALSE(solver1->setTolerance(1e-4));
+  ASSERT_FALSE(solver1->setMaxIteration(64));
+}
+
+TEST(SolverTest, Configuration) {
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  const auto file = "configuration_" + std::to_string(mpi_size) + "_" + std::to_string(mpi_rank) + ".cfg";
+
+  // Saves configuration
+  mcnla::isvd::Configuration config;
+  config.rank           = 5;
+  config.num_sketch     = 24;
+  config.over_rank      = 7;
+  config.tolerance      = 1e-4;
+  config.max_iteration  = 64;
+  config.num_thread     = 2;
+  config.sketcher       = "RowBlockGaussianProjectionSketcher";
+  config.orthogonalizer = "RowBlockGramianOrthogonalizer";
+  config.integrator     = "RowBlockWenYinIntegrator";
+  config.former         = "RowBlockGramianFormer";
+  config.time           = 1.5;
+  config.error          = 0.25;
+  config.save(file.c_str());
+
+  // Loads configuration
+  mcnla::isvd::Configuration config2;
+  ASSERT_TRUE(config2.load(file.c_str()));
+  std::remove(file.c_str());
+
+  // Checks result
+  EXPECT_EQ(config2.rank,           config.rank);
+  EXPECT_EQ(config2.num_sketch,     config.num_sketch);
+  EXPECT_EQ(config2.over_rank,      config.over_rank);
+  EXPECT_EQ(config2.tolerance,      config.tolerance);
+  EXPECT_EQ(config2.max_iteration,  config.max_iteration);
+  EXPECT_EQ(config2.num_thread,     config.num_thread);
+  EXPECT_EQ(config2.sketcher,       config.sketcher);
+  EXPECT_EQ(config2.orthogonalizer, config.orthogonalizer);
+  EXPECT_EQ(config2.integrator,     config.integrator);
+  EXPECT_EQ(config2.former,         config.former);
+  EXPECT_EQ(config2.time,           config.time);
+  EXPECT_EQ(config2.error,          config.error);
+
+  // Checks missing file
+  EXPECT_FALSE(config2.load("no_such_file.cfg"));
+}
+
+TEST(SolverTest, Batch) {
+  using ValType = double;
+  const auto mpi_comm = MPI_COMM_WORLD;
+  const auto mpi_root = 0;
+  const auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  const mcnla::index_t seed = 1234;
+
+  // Reads data
+  mcnla::matrix::DenseMatrixColMajor<ValType> a;
+  mcnla::io::loadMatrixMarket(a, MATRIX_A_PATH);
+
+  // Gets size
+  const mcnla::index_t m    = a.nrow();
+  const mcnla::index_t n    = a.ncol();
+  const mcnla::index_t k    = 10;
+  const mcnla::index_t p    = 12;
+  const mcnla::index_t N    = 4;
+  const mcnla::index_t nmat = 2 * mpi_size + 1;
+
+  // Sets parameters
+  mcnla::isvd::Parameters<ValType> parameters(mpi_root, mpi_comm);
+  parameters.setSize(m, n).setRank(k).setOverRank(p).setNumSketch(N);
+  parameters.sync();
+
+  // Initializes solver
+  using SketcherType       = mcnla::isvd::GaussianProjectionSketcher<ValType>;
+  using OrthogonalizerType = mcnla::isvd::GramianOrthogonalizer<ValType>;
+  using IntegratorType     = mcnla::isvd::KolmogorovNagumoIntegrator<ValType>;
+  using FormerType         = mcnla::isvd::GramianFormer<ValType, true>;
+  mcnla::isvd::BatchSolver<SketcherType, OrthogonalizerType, IntegratorType, FormerType> batch_solver(parameters, nmat, seed);
+  batch_solver.initialize();
+
+  // Distributes the batch
+  const auto range = batch_solver.batchRange();
+  int nmat_sum = range.len();
+  MPI_Allreduce(MPI_IN_PLACE, &nmat_sum, 1, MPI_INT, MPI_SUM, mpi_comm);
+  ASSERT_EQ(nmat_sum, nmat);
+
+  // Creates matrices
+  mcnla::matrix::DenseMatrixCollectionColBlockColMajor<ValType> collection_a(m, n, range.len());
+  for ( auto i = 0; i < range.len(); ++i ) {
+    mcnla::la::copy(a, collection_a(i));
+  }
+
+  // Runs (with more threads than solvers)
+#ifdef _OPENMP
+  const auto num_thread = omp_get_max_threads();
+  omp_set_num_threads(num_thread + 2);
+#endif  // _OPENMP
+  batch_solver(collection_a);
+#ifdef _OPENMP
+  omp_set_num_threads(num_thread);
+#endif  // _OPENMP
+  ASSERT_TRUE(batch_solver.isComputed());
+
+  // Initializes the solver of a single matrix
+  mcnla::isvd::Parameters<ValType> matrix_parameters(0, MPI_COMM_SELF);
+  matrix_parameters.setSize(m, n).setRank(k).setOverRank(p).setNumSketch(N);
+  matrix_parameters.sync();
+  mcnla::isvd::Solver<SketcherType, OrthogonalizerType, IntegratorType, FormerType> solver(matrix_parameters);
+  solver.initialize();
+
+  // Checks result
+  for ( auto i = 0; i < range.len(); ++i ) {
+    solver.sketcher().setSeed(seed + range.begin + i);
+    solver(collection_a(i));
+    ASSERT_EQ(batch_solver.iterations()[i], solver.integrator().iteration()) << "i = " << i;
+    for ( auto j = 0; j < k; ++j ) {
+      ASSERT_NEAR(batch_solver.matrixS()(j, i), solver.former().vectorS()(j), 1e-8) << "(i, j) = (" << i << ", " << j << ")";
+    }
+    for ( auto ir = 0; ir < m; ++ir ) {
+      for ( auto ic = 0; ic < k; ++ic ) {
+        ASSERT_NEAR(batch_solver.collectionU()(i)(ir, ic), solver.former().matrixU()(ir, ic), 1e-8)
+            << "(i, ir, ic) = (" << i << ", " << ir << ", " << ic << ")";
+      }
+    }
+  }
+}
@@ -11,5 +11,6 @@
 #include <mcnla/core/io/def.hpp>
 #include <mcnla/core/io/binary.hpp>
 #include <mcnla/core/io/matrix_market.hpp>
+#include <mcnla/core/io/trace.hpp>
 
 #endif  // MCNLA_CORE_IO_HPP_
@@ -0,0 +1,226 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/io/binary/dense_map.hpp
+/// @brief   Map dense data from a binary file.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_IO_BINARY_DENSE_MAP_HPP_
+#define MCNLA_CORE_IO_BINARY_DENSE_MAP_HPP_
+
+#include <mcnla/core/io/binary/def.hpp>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mcnla/core/matrix.hpp>
+#include <mcnla/core/utility/memory_map.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The I/O namespace.
+//
+namespace io {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace
+//
+namespace detail {
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+// Reads the dimensions and returns the position of the values
+template <typename _Val>
+inline std::size_t readBinaryDims(
+          std::int64_t *dims,
+    const std::int64_t ndim,
+    const char *file
+) noexcept {
+  // Open file
+  std::ifstream fin(file);
+  if ( fin.fail() ) {
+    std::cerr << "Unable to open " << file << "!" << std::endl;
+    std::abort();
+  }
+
+  // Check header
+  detail::checkHeader<DenseTag, _Val>(fin);
+  std::int64_t num;
+
+  // Get dimension
+  fin.read(static_cast<char*>(static_cast<void*>(&num)), sizeof(num));
+  mcnla_assert_eq(num, ndim);
+  static_cast<void>(ndim);
+
+  // Get size
+  fin.read(static_cast<char*>(static_cast<void*>(dims)), num * sizeof(num));
+
+  // Get position
+  const std::size_t pos = fin.tellg();
+
+  // Close file
+  fin.close();
+  return pos;
+}
+
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  io_module
+/// Map a dense vector from a binary file.
+///
+/// The vector views the file without reading nor copying (see @ref utility::mapFile "mapFile").
+///
+/// @attention  Writing a read-only vector causes a segmentation fault.
+/// @attention  Aborts if the file cannot be opened or mapped.
+///
+template <typename _Val>
+void mapBinary(
+          DenseVector<_Val> &vector,
+    const char *file,
+    const utility::MapMode mode = utility::MapMode::READ_ONLY
+) noexcept {
+  std::int64_t dims[1];
+  const auto pos = detail::readBinaryDims<_Val>(dims, 1, file);
+  vector.reconstruct(dims[0], 1, Array<_Val>(file, pos, dims[0], mode));
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val>
+inline void mapBinary(
+          DenseVector<_Val> &&vector,
+    const char *file,
+    const utility::MapMode mode = utility::MapMode::READ_ONLY
+) noexcept {
+  mapBinary(vector, file, mode);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  io_module
+/// Map a dense matrix from a binary file.
+///
+/// The matrix views the file without reading nor copying (see @ref utility::mapFile "mapFile").
+///
+/// @note  The data will be mapped in storage layout.
+///
+/// @attention  Writing a read-only matrix causes a segmentation fault.
+/// @attention  Aborts if the file cannot be opened or mapped.
+///
+template <typename _Val, Trans _trans>
+void mapBinary(
+          DenseMatrix<_Val, _trans> &matrix,
+    const char *file,
+    const utility::MapMode mode = utility::MapMode::READ_ONLY
+) noexcept {
+  std::int64_t dims[2];
+  const auto pos = detail::readBinaryDims<_Val>(dims, 2, file);
+  const index_t dim0 = dims[0], dim1 = dims[1];
+  Array<_Val> val(file, pos, dim0 * dim1, mode);
+  if ( !isTrans(_trans) ) {
+    matrix.reconstruct(dim0, dim1, dim0, val);
+  } else {
+    matrix.reconstruct(dim1, dim0, dim0, val);
+  }
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val, Trans _trans>
+inline void mapBinary(
+          DenseMatrix<_Val, _trans> &&matrix,
+    const char *file,
+    const utility::MapMode mode = utility::MapMode::READ_ONLY
+) noexcept {
+  mapBinary(matrix, file, mode);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  io_module
+/// Map a dense sub-matrix from a binary file.
+///
+/// Only the byte range of the columns is mapped, so that each MPI node maps its own block and the MPI nodes on the same
+/// machine share the page cache.
+///
+/// @note  The data will be mapped in storage layout.
+///
+/// @attention  Writing a read-only matrix causes a segmentation fault.
+/// @attention  Aborts if the file cannot be opened or mapped.
+///
+template <typename _Val, Trans _trans>
+void mapBinaryColBlock(
+          DenseMatrix<_Val, _trans> &colblock,
+    const char *file,
+    const IdxRange &colrange,
+    const utility::MapMode mode = utility::MapMode::READ_ONLY
+) noexcept {
+  static_assert(_trans == Trans::NORMAL, "This routine is only available in column-major matrices.");
+
+  std::int64_t dims[2];
+  const auto pos = detail::readBinaryDims<_Val>(dims, 2, file);
+  const index_t dim0 = dims[0];
+  mcnla_assert_ge(colrange.begin, 0);
+  mcnla_assert_le(colrange.end, dims[1]);
+
+  const std::size_t offset = sizeof(_Val) * dim0 * colrange.begin;
+  colblock.reconstruct(dim0, colrange.len(), dim0, Array<_Val>(file, pos + offset, dim0 * colrange.len(), mode));
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val, Trans _trans>
+inline void mapBinaryColBlock(
+          DenseMatrix<_Val, _trans> &&colblock,
+    const char *file,
+    const IdxRange &colrange,
+    const utility::MapMode mode = utility::MapMode::READ_ONLY
+) noexcept {
+  mapBinaryColBlock(colblock, file, colrange, mode);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  io_module
+/// Map a dense sub-matrix from a binary file.
+///
+/// Only the byte range of the rows is mapped, so that each MPI node maps its own block and the MPI nodes on the same machine
+/// share the page cache.
+///
+/// @note  The data will be mapped in storage layout.
+///
+/// @attention  Writing a read-only matrix causes a segmentation fault.
+/// @attention  Aborts if the file cannot be opened or mapped.
+///
+template <typename _Val, Trans _trans>
+void mapBinaryRowBlock(
+          DenseMatrix<_Val, _trans> &rowblock,
+    const char *file,
+    const IdxRange &rowrange,
+    const utility::MapMode mode = utility::MapMode::READ_ONLY
+) noexcept {
+  static_assert(_trans == Trans::TRANS, "This routine is only available in row-major matrices.");
+  mapBinaryColBlock(rowblock.t(), file, rowrange, mode);
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val, Trans _trans>
+inline void mapBinaryRowBlock(
+          DenseMatrix<_Val, _trans> &&rowblock,
+    const char *file,
+    const IdxRange &rowrange,
+    const utility::MapMode mode = utility::MapMode::READ_ONLY
+) noexcept {
+  mapBinaryRowBlock(rowblock, file, rowrange, mode);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace io
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_IO_BINARY_DENSE_MAP_HPP_
@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/io/binary/dense_save_block.hpp
+/// @brief   Save dense data into a binary file (row-block version).
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_IO_BINARY_DENSE_SAVE_BLOCK_HPP_
+#define MCNLA_CORE_IO_BINARY_DENSE_SAVE_BLOCK_HPP_
+
+#include <mcnla/core/io/binary/def.hpp>
+#include <sstream>
+#include <mcnla/core/matrix.hpp>
+#include <mcnla/core/mpi/def.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The I/O namespace.
+//
+namespace io {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  io_module
+/// Save a distributed dense matrix into a binary file.
+///
+/// Each process writes its own column-block directly into the file by collective MPI-IO. The blocks are stacked in the
+/// order of the MPI ranks.
+///
+/// @attention  The number of rows of @a colblock should be the same for all MPI nodes.
+/// @attention  This routine is collective over @a comm.
+///
+/// @note  The file will be stored in storage layout.
+///
+template <typename _Val, Trans _trans>
+void saveBinaryColBlock(
+    const DenseMatrix<_Val, _trans> &colblock,
+    const char *file,
+    const MPI_Comm comm,
+    const char *comment = ""
+) noexcept {
+  static_assert(_trans == Trans::NORMAL, "This routine is only available in column-major matrices.");
+  mcnla_assert_true(colblock.isShrunk());
+  mcnla_assert_mpi_count(colblock.nelem() * sizeof(_Val));
+
+  constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  constexpr const MPI_Datatype idxtype  = traits::MpiValTraits<index_t>::datatype;
+
+  // Compute offset
+  const index_t dim0 = colblock.dim0();
+  const index_t dim1 = colblock.dim1();
+  index_t offset = 0, dim1_total;
+  mcnla_assert_pass(MPI_Exscan(&dim1, &offset, 1, idxtype, MPI_SUM, comm));
+  mcnla_assert_pass(MPI_Allreduce(&dim1, &dim1_total, 1, idxtype, MPI_SUM, comm));
+  if ( mpi::commRank(comm) == 0 ) {
+    offset = 0;
+  }
+
+  // Make header
+  std::ostringstream sout;
+  detail::writeHeader<DenseTag, _Val>(sout, comment);
+  std::int64_t num = 2;
+  sout.write(static_cast<const char*>(static_cast<const void*>(&num)), sizeof(num));
+  num = dim0;
+  sout.write(static_cast<const char*>(static_cast<const void*>(&num)), sizeof(num));
+  num = dim1_total;
+  sout.write(static_cast<const char*>(static_cast<const void*>(&num)), sizeof(num));
+  const auto header = sout.str();
+
+  // Open file
+  MPI_File fh;
+  mcnla_assert_pass(MPI_File_open(comm, file, MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fh));
+  mcnla_assert_pass(MPI_File_set_size(fh, 0));
+
+  // Write header
+  if ( mpi::commRank(comm) == 0 ) {
+    mcnla_assert_pass(MPI_File_write_at(fh, 0, header.data(), header.size(), MPI_CHAR, MPI_STATUS_IGNORE));
+  }
+
+  // Write values
+  const MPI_Offset disp = header.size() + MPI_Offset(dim0) * offset * sizeof(_Val);
+  mcnla_assert_pass(MPI_File_write_at_all(fh, disp, colblock.valPtr(), colblock.nelem(), datatype, MPI_STATUS_IGNORE));
+
+  // Close file
+  mcnla_assert_pass(MPI_File_close(&fh));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  io_module
+/// Save a distributed dense matrix into a binary file.
+///
+/// Each process writes its own row-block directly into the file by collective MPI-IO. The blocks are stacked in the order
+/// of the MPI ranks.
+///
+/// @attention  The number of columns of @a rowblock should be the same for all MPI nodes.
+/// @attention  This routine is collective over @a comm.
+///
+/// @note  The file will be stored in storage layout.
+///
+template <typename _Val, Trans _trans>
+void saveBinaryRowBlock(
+    const DenseMatrix<_Val, _trans> &rowblock,
+    const char *file,
+    const MPI_Comm comm,
+    const char *comment = ""
+) noexcept {
+  static_assert(_trans == Trans::TRANS, "This routine is only available in row-major matrices.");
+  saveBinaryColBlock(rowblock.t(), file, comm, comment);
+}
+
+}  // namespace io
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_IO_BINARY_DENSE_SAVE_BLOCK_HPP_
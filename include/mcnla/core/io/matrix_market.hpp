@@ -14,5 +14,9 @@
 #include <mcnla/core/io/matrix_market/coo_save.hpp>
 
 #include <mcnla/core/io/matrix_market/dense_load_block.hpp>
+#include <mcnla/core/io/matrix_market/dense_save_block.hpp>
+
+#include <mcnla/core/io/matrix_market/dense_parse.hpp>
+#include <mcnla/core/io/matrix_market/coo_parse.hpp>
 
 #endif  // MCNLA_CORE_IO_MATRIX_MATKET_HPP_
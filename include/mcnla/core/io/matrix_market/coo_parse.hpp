@@ -0,0 +1,143 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/io/matrix_market/coo_parse.hpp
+/// @brief   Parse COO data from a Matrix Market file in parallel.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_IO_MATRIX_MARKET_COO_PARSE_HPP_
+#define MCNLA_CORE_IO_MATRIX_MARKET_COO_PARSE_HPP_
+
+#include <mcnla/core/io/def.hpp>
+#include <mcnla/core/io/matrix_market/parser.hpp>
+#include <mcnla/core/matrix.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The I/O namespace.
+//
+namespace io {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  io_module
+/// Parse a COO vector from a Matrix Market file in parallel.
+///
+/// Same as @ref loadMatrixMarket, but the file is mapped into memory and parsed by all OpenMP threads. The file should
+/// store one entry per line.
+///
+/// @note  If @a vector is empty, the memory will be allocated.
+/// @note  The file storage major should be the same as @a vector.
+///
+/// @attention  Aborts if the file cannot be opened or has fewer entries than its header declares.
+///
+template <typename _Val>
+void parseMatrixMarket(
+    CooVector<_Val> &vector,
+    const char *file
+) noexcept {
+  // Map file and get size
+  index_t sizes[3];
+  const auto text = detail::mapMatrixMarket(file, sizes, 3);
+  const index_t m = sizes[0], nnz = sizes[2];
+
+  // Allocate memory
+  if ( vector.isEmpty() ) {
+    vector.reconstruct(m, nnz);
+  } else {
+    mcnla_assert_eq(vector.dims(), std::make_tuple(m));
+    mcnla_assert_eq(vector.nnz(), nnz);
+  }
+
+  // Read values
+  auto val  = vector.valPtr();
+  auto idx0 = vector.idx0Ptr();
+  detail::parseLines(text, nnz, [=]( const index_t idx, const char *ptr, const char *end ) {
+    index_t x, y;
+    for ( index_t i = idx; i < nnz && (ptr = detail::skipSpace(ptr, end)) < end; ++i ) {
+      ptr = detail::parseIndex(ptr, end, x);
+      ptr = detail::parseIndex(ptr, end, y);
+      ptr = detail::parseValue(ptr, end, val[i]);
+      idx0[i] = x-1;
+    }
+  });
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val>
+inline void parseMatrixMarket(
+    CooVector<_Val> &&vector,
+    const char *file
+) noexcept {
+  parseMatrixMarket(vector, file);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  io_module
+/// Parse a COO matrix from a Matrix Market file in parallel.
+///
+/// Same as @ref loadMatrixMarket, but the file is mapped into memory and parsed by all OpenMP threads. The file should
+/// store one entry per line.
+///
+/// @note  If @a matrix is empty, the memory will be allocated.
+/// @note  The file storage major should be the same as @a matrix.
+///
+/// @attention  Aborts if the file cannot be opened or has fewer entries than its header declares.
+///
+template <typename _Val, Trans _trans>
+void parseMatrixMarket(
+    CooMatrix<_Val, _trans> &matrix,
+    const char *file
+) noexcept {
+  // Map file and get size
+  index_t sizes[3];
+  const auto text = detail::mapMatrixMarket(file, sizes, 3);
+  const index_t m = sizes[0], n = sizes[1], nnz = sizes[2];
+
+  // Allocate memory
+  if ( matrix.isEmpty() ) {
+    if ( !isTrans(_trans) ) {
+      matrix.reconstruct(m, n, nnz);
+    } else {
+      matrix.reconstruct(n, m, nnz);
+    }
+  } else {
+    mcnla_assert_eq(matrix.dims(), std::make_tuple(m, n));
+    mcnla_assert_eq(matrix.nnz(), nnz);
+  }
+
+  // Read values
+  auto val  = matrix.valPtr();
+  auto idx0 = matrix.idx0Ptr();
+  auto idx1 = matrix.idx1Ptr();
+  detail::parseLines(text, nnz, [=]( const index_t idx, const char *ptr, const char *end ) {
+    index_t x, y;
+    for ( index_t i = idx; i < nnz && (ptr = detail::skipSpace(ptr, end)) < end; ++i ) {
+      ptr = detail::parseIndex(ptr, end, x);
+      ptr = detail::parseIndex(ptr, end, y);
+      ptr = detail::parseValue(ptr, end, val[i]);
+      idx0[i] = x-1;
+      idx1[i] = y-1;
+    }
+  });
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val, Trans _trans>
+inline void parseMatrixMarket(
+    CooMatrix<_Val, _trans> &&matrix,
+    const char *file
+) noexcept {
+  parseMatrixMarket(matrix, file);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace io
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_IO_MATRIX_MARKET_COO_PARSE_HPP_
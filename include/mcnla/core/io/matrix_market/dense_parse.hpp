@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/io/matrix_market/dense_parse.hpp
+/// @brief   Parse dense data from a Matrix Market file in parallel.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_IO_MATRIX_MARKET_DENSE_PARSE_HPP_
+#define MCNLA_CORE_IO_MATRIX_MARKET_DENSE_PARSE_HPP_
+
+#include <mcnla/core/io/def.hpp>
+#include <mcnla/core/io/matrix_market/parser.hpp>
+#include <mcnla/core/matrix.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The I/O namespace.
+//
+namespace io {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  io_module
+/// Parse a dense vector from a Matrix Market file in parallel.
+///
+/// Same as @ref loadMatrixMarket, but the file is mapped into memory and parsed by all OpenMP threads. The file should
+/// store one value per line.
+///
+/// @note  If @a vector is empty, the memory will be allocated.
+/// @note  The file should be stored in column-major.
+///
+/// @attention  Aborts if the file cannot be opened or has fewer entries than its header declares.
+///
+template <typename _Val>
+void parseMatrixMarket(
+    DenseVector<_Val> &vector,
+    const char *file
+) noexcept {
+  // Map file and get size
+  index_t sizes[2];
+  const auto text = detail::mapMatrixMarket(file, sizes, 2);
+  const index_t m = sizes[0];
+
+  // Allocate memory
+  if ( vector.isEmpty() ) {
+    vector.reconstruct(m);
+  } else {
+    mcnla_assert_eq(vector.sizes(), std::make_tuple(m));
+  }
+
+  // Read values
+  detail::parseLines(text, m, [&vector, m]( const index_t idx, const char *ptr, const char *end ) {
+    for ( index_t i = idx; i < m && (ptr = detail::skipSpace(ptr, end)) < end; ++i ) {
+      ptr = detail::parseValue(ptr, end, vector(i));
+    }
+  });
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val>
+inline void parseMatrixMarket(
+    DenseVector<_Val> &&vector,
+    const char *file
+) noexcept {
+  parseMatrixMarket(vector, file);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  io_module
+/// Parse a dense matrix from a Matrix Market file in parallel.
+///
+/// Same as @ref loadMatrixMarket, but the file is mapped into memory and parsed by all OpenMP threads. The file should
+/// store one value per line.
+///
+/// @note  If @a matrix is empty, the memory will be allocated.
+/// @note  The file should be stored in column-major.
+///
+/// @attention  Aborts if the file cannot be opened or has fewer entries than its header declares.
+///
+template <typename _Val, Trans _trans>
+void parseMatrixMarket(
+    DenseMatrix<_Val, _trans> &matrix,
+    const char *file
+) noexcept {
+  // Map file and get size
+  index_t sizes[2];
+  const auto text = detail::mapMatrixMarket(file, sizes, 2);
+  const index_t m = sizes[0], n = sizes[1];
+
+  // Allocate memory
+  if ( matrix.isEmpty() ) {
+    matrix.reconstruct(m, n);
+  } else {
+    mcnla_assert_eq(matrix.sizes(), std::make_tuple(m, n));
+  }
+
+  // Read values
+  detail::parseLines(text, m * n, [&matrix, m, n]( const index_t idx, const char *ptr, const char *end ) {
+    for ( index_t i = idx % m, j = idx / m; j < n && (ptr = detail::skipSpace(ptr, end)) < end; ) {
+      ptr = detail::parseValue(ptr, end, matrix(i, j));
+      if ( ++i == m ) {
+        i = 0;
+        ++j;
+      }
+    }
+  });
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val, Trans _trans>
+inline void parseMatrixMarket(
+    DenseMatrix<_Val, _trans> &&matrix,
+    const char *file
+) noexcept {
+  parseMatrixMarket(matrix, file);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace io
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_IO_MATRIX_MARKET_DENSE_PARSE_HPP_
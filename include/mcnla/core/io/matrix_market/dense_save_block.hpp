@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/io/matrix_market/dense_save_block.hpp
+/// @brief   Save dense data into a Matrix Market file (row-block version).
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_IO_MATRIX_MARKET_DENSE_SAVE_BLOCK_HPP_
+#define MCNLA_CORE_IO_MATRIX_MARKET_DENSE_SAVE_BLOCK_HPP_
+
+#include <mcnla/core/io/def.hpp>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <mcnla/core/matrix.hpp>
+#include <mcnla/core/mpi/def.hpp>
+#include <mcnla/core/utility/traits.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The I/O namespace.
+//
+namespace io {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace
+//
+namespace detail {
+
+/// The width of each value (including the newline) in distributed Matrix Market files.
+static constexpr index_t kMatrixMarketValLen = 25;
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  io_module
+/// Save a distributed dense matrix into a Matrix Market file.
+///
+/// Each process writes its own row-block directly into the file by collective MPI-IO. The blocks are stacked in the order
+/// of the MPI ranks. Each value is written with a fixed width, so that the position of each value is known in advance.
+///
+/// @attention  The number of columns of @a rowblock should be the same for all MPI nodes.
+/// @attention  This routine is collective over @a comm.
+///
+/// @note  The file will be stored in column-major.
+///
+template <typename _Val, Trans _trans>
+void saveMatrixMarketRowBlock(
+    const DenseMatrix<_Val, _trans> &rowblock,
+    const char *file,
+    const MPI_Comm comm
+) noexcept {
+  static_assert(traits::ValTraits<_Val>::is_real, "This routine is only available in real matrices.");
+
+  constexpr const MPI_Datatype idxtype = traits::MpiValTraits<index_t>::datatype;
+  constexpr const index_t len = detail::kMatrixMarketValLen;
+
+  // Compute offset
+  const index_t nrow = rowblock.nrow();
+  const index_t ncol = rowblock.ncol();
+  index_t offset = 0, nrow_total;
+  mcnla_assert_pass(MPI_Exscan(&nrow, &offset, 1, idxtype, MPI_SUM, comm));
+  mcnla_assert_pass(MPI_Allreduce(&nrow, &nrow_total, 1, idxtype, MPI_SUM, comm));
+  if ( mpi::commRank(comm) == 0 ) {
+    offset = 0;
+  }
+
+  // Make header
+  const std::string header = "%%MatrixMarket matrix array real general\n"
+                           + std::to_string(nrow_total) + " " + std::to_string(ncol) + "\n";
+
+  // Format values (column by column)
+  mcnla_assert_mpi_count(rowblock.nelem() * len);
+  std::vector<char> buffer(rowblock.nelem() * len + 1);
+  auto ptr = buffer.data();
+  for ( index_t j = 0; j < ncol; ++j ) {
+    for ( index_t i = 0; i < nrow; ++i ) {
+      std::snprintf(ptr, len+1, "%24.16e\n", double(rowblock(i, j)));
+      ptr += len;
+    }
+  }
+
+  // Open file
+  MPI_File fh;
+  mcnla_assert_pass(MPI_File_open(comm, file, MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fh));
+  mcnla_assert_pass(MPI_File_set_size(fh, 0));
+
+  // Write header
+  if ( mpi::commRank(comm) == 0 ) {
+    mcnla_assert_pass(MPI_File_write_at(fh, 0, header.data(), header.size(), MPI_CHAR, MPI_STATUS_IGNORE));
+  }
+
+  // Set view (one segment per column)
+  MPI_Datatype filetype;
+  mcnla_assert_pass(MPI_Type_create_hvector(ncol, nrow * len, MPI_Aint(nrow_total) * len, MPI_CHAR, &filetype));
+  mcnla_assert_pass(MPI_Type_commit(&filetype));
+  const MPI_Offset disp = header.size() + MPI_Offset(offset) * len;
+  mcnla_assert_pass(MPI_File_set_view(fh, disp, MPI_CHAR, filetype, "native", MPI_INFO_NULL));
+
+  // Write values
+  mcnla_assert_pass(MPI_File_write_all(fh, buffer.data(), rowblock.nelem() * len, MPI_CHAR, MPI_STATUS_IGNORE));
+
+  // Close file
+  mcnla_assert_pass(MPI_Type_free(&filetype));
+  mcnla_assert_pass(MPI_File_close(&fh));
+}
+
+}  // namespace io
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_IO_MATRIX_MARKET_DENSE_SAVE_BLOCK_HPP_
@@ -0,0 +1,296 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/io/matrix_market/parser.hpp
+/// @brief   The parallel Matrix Market parser.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_IO_MATRIX_MARKET_PARSER_HPP_
+#define MCNLA_CORE_IO_MATRIX_MARKET_PARSER_HPP_
+
+#include <mcnla/core/io/def.hpp>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+#include <mcnla/core/utility/memory_map.hpp>
+
+#ifdef _OPENMP
+  #include <omp.h>
+#endif  // _OPENMP
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The I/O namespace.
+//
+namespace io {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace
+//
+namespace detail {
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+// The mapped text of a Matrix Market file
+struct MatrixMarketText {
+  std::shared_ptr<char> text;
+  const char *begin = nullptr;
+  const char *end   = nullptr;
+};
+
+// Checks if the character is a white space
+static inline bool isSpace( const char c ) noexcept {
+  return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+}
+
+// Skips the white spaces
+static inline const char* skipSpace( const char *ptr, const char *end ) noexcept {
+  while ( ptr < end && isSpace(*ptr) ) {
+    ++ptr;
+  }
+  return ptr;
+}
+
+// Skips to the next line
+static inline const char* skipLine( const char *ptr, const char *end ) noexcept {
+  while ( ptr < end && *ptr != '\n' ) {
+    ++ptr;
+  }
+  return (ptr < end) ? ptr+1 : ptr;
+}
+
+// Parses an index
+static inline const char* parseIndex( const char *ptr, const char *end, index_t &idx ) noexcept {
+  ptr = skipSpace(ptr, end);
+  mcnla_assert_true(ptr < end && *ptr >= '0' && *ptr <= '9');
+  idx = 0;
+  while ( ptr < end && *ptr >= '0' && *ptr <= '9' ) {
+    idx = idx * 10 + (*ptr++ - '0');
+  }
+  return ptr;
+}
+
+// The limits of the exact conversion of the real numbers
+template <typename _Val> struct RealTraits;
+template <> struct RealTraits<float> {
+  static constexpr std::uint64_t max_mantissa = std::uint64_t(1) << 24;
+  static constexpr int max_exponent = 10;
+  static inline float convert( const std::string &str ) noexcept { return std::strtof(str.c_str(), nullptr); }
+};
+template <> struct RealTraits<double> {
+  static constexpr std::uint64_t max_mantissa = std::uint64_t(1) << 53;
+  static constexpr int max_exponent = 22;
+  static inline double convert( const std::string &str ) noexcept { return std::strtod(str.c_str(), nullptr); }
+};
+
+// Parses a real number
+//
+// The decimal numbers whose digits and power of ten are both exactly representable are converted by a single multiplication
+// or division, which is correctly rounded; the others are converted by the C library.
+template <typename _Val>
+static inline const char* parseReal( const char *ptr, const char *end, _Val &val ) noexcept {
+  ptr = skipSpace(ptr, end);
+  const char *last = ptr;
+  while ( last < end && !isSpace(*last) ) {
+    ++last;
+  }
+  mcnla_assert_gt(last - ptr, 0);
+
+  // Parses the digits
+  const char *it = ptr;
+  const bool negative = (*it == '-');
+  if ( *it == '-' || *it == '+' ) {
+    ++it;
+  }
+  std::uint64_t mantissa = 0;
+  int exponent = 0, num_digit = 0;
+  bool exact = true;
+  for ( ; it < last && *it >= '0' && *it <= '9'; ++it, ++num_digit ) {
+    mantissa = mantissa * 10 + (*it - '0');
+  }
+  if ( it < last && *it == '.' ) {
+    for ( ++it; it < last && *it >= '0' && *it <= '9'; ++it, ++num_digit, --exponent ) {
+      mantissa = mantissa * 10 + (*it - '0');
+    }
+  }
+  if ( it < last && (*it == 'e' || *it == 'E') ) {
+    index_t num_exp;
+    const bool exp_negative = (it+1 < last && it[1] == '-');
+    it += (it+1 < last && (it[1] == '-' || it[1] == '+')) ? 2 : 1;
+    if ( it < last && *it >= '0' && *it <= '9' ) {
+      it = parseIndex(it, last, num_exp);
+      exponent += exp_negative ? -num_exp : num_exp;
+    } else {
+      exact = false;
+    }
+  }
+  exact = exact && it == last && num_digit > 0 && num_digit <= 19 && mantissa <= RealTraits<_Val>::max_mantissa &&
+          exponent >= -RealTraits<_Val>::max_exponent && exponent <= RealTraits<_Val>::max_exponent;
+
+  if ( exact ) {
+    static constexpr _Val kPow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    val = (exponent >= 0) ? _Val(mantissa) * kPow10[exponent] : _Val(mantissa) / kPow10[-exponent];
+    if ( negative ) {
+      val = -val;
+    }
+  } else {
+    val = RealTraits<_Val>::convert(std::string(ptr, last));
+  }
+  return last;
+}
+
+// Parses a value
+template <typename _Val>
+static inline const char* parseValue( const char *ptr, const char *end, _Val &val ) noexcept {
+  return parseReal(ptr, end, val);
+}
+
+template <typename _Val>
+static inline const char* parseValue( const char *ptr, const char *end, std::complex<_Val> &val ) noexcept {
+  _Val re, im;
+  ptr = parseReal(ptr, end, re);
+  ptr = parseReal(ptr, end, im);
+  val = std::complex<_Val>(re, im);
+  return ptr;
+}
+
+// Maps a Matrix Market file and parses its sizes
+//
+// The banner and the comments are skipped, and the text begins after the size line.
+static inline MatrixMarketText mapMatrixMarket(
+    const char *file,
+    index_t *sizes,
+    const index_t num_size
+) noexcept {
+  MatrixMarketText text;
+
+  // Get file size
+  std::ifstream fin(file, std::ios::binary | std::ios::ate);
+  if ( fin.fail() ) {
+    std::cerr << "Unable to open " << file << "!" << std::endl;
+    std::abort();
+  }
+  const std::size_t bytes = fin.tellg();
+  fin.close();
+
+  // Map file
+  text.text = utility::mapFile<char>(file, 0, bytes);
+  if ( bytes > 0 && !text.text ) {
+    std::cerr << "Unable to map " << file << "!" << std::endl;
+    std::abort();
+  }
+  text.begin = text.text.get();
+  text.end   = text.begin + bytes;
+
+  // Skip comment
+  while ( text.begin < text.end && *text.begin == '%' ) {
+    text.begin = skipLine(text.begin, text.end);
+  }
+
+  // Get size
+  for ( index_t i = 0; i < num_size; ++i ) {
+    text.begin = parseIndex(text.begin, text.end, sizes[i]);
+  }
+  text.begin = skipLine(text.begin, text.end);
+
+  return text;
+}
+
+// Counts the non-empty lines
+static inline index_t countLines( const char *ptr, const char *end ) noexcept {
+  index_t num = 0;
+  while ( (ptr = skipSpace(ptr, end)) < end ) {
+    ++num;
+    ptr = skipLine(ptr, end);
+  }
+  return num;
+}
+
+// Parses the lines in parallel
+//
+// The text is split into @a num_chunk line-aligned chunks. The lines of each chunk are counted first to get the index of its
+// first entry, and then @a func( idx, begin, end ) parses the entries of the chunk starting from the index.
+//
+// @note  The text may contain more than @a num entries; @a func should stop at @a num.
+// @note  Aborts if the text contains fewer than @a num entries.
+template <class _Func>
+inline void parseLines(
+    const MatrixMarketText &text,
+    const index_t num,
+    const index_t num_chunk,
+    _Func func
+) noexcept {
+  mcnla_assert_gt(num_chunk, 0);
+
+  // Split the text
+  const std::size_t bytes = text.end - text.begin;
+  std::vector<const char*> bounds(num_chunk+1);
+  bounds[0] = text.begin;
+  for ( index_t i = 1; i < num_chunk; ++i ) {
+    const char *ptr = text.begin + bytes * i / num_chunk;
+    if ( ptr < bounds[i-1] ) {
+      ptr = bounds[i-1];
+    } else if ( ptr > text.begin && ptr[-1] != '\n' ) {
+      ptr = skipLine(ptr, text.end);
+    }
+    bounds[i] = ptr;
+  }
+  bounds[num_chunk] = text.end;
+
+  // Count the entries
+  std::vector<index_t> idxs(num_chunk+1, 0);
+#ifdef _OPENMP
+  #pragma omp parallel for
+#endif  // _OPENMP
+  for ( index_t i = 0; i < num_chunk; ++i ) {
+    idxs[i+1] = countLines(bounds[i], bounds[i+1]);
+  }
+  std::partial_sum(idxs.begin(), idxs.end(), idxs.begin());
+  if ( idxs[num_chunk] < num ) {
+    std::cerr << "Unable to parse " << num << " entries, only " << idxs[num_chunk] << " found!" << std::endl;
+    std::abort();
+  }
+
+  // Parse the entries
+#ifdef _OPENMP
+  #pragma omp parallel for
+#endif  // _OPENMP
+  for ( index_t i = 0; i < num_chunk; ++i ) {
+    func(idxs[i], bounds[i], bounds[i+1]);
+  }
+}
+
+// Parses the lines in parallel, one chunk per OpenMP thread
+template <class _Func>
+inline void parseLines(
+    const MatrixMarketText &text,
+    const index_t num,
+    _Func func
+) noexcept {
+#ifdef _OPENMP
+  parseLines(text, num, omp_get_max_threads(), func);
+#else  // _OPENMP
+  parseLines(text, num, 1, func);
+#endif  // _OPENMP
+}
+
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace detail
+
+}  // namespace io
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_IO_MATRIX_MARKET_PARSER_HPP_
@@ -0,0 +1,257 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/io/trace.hpp
+/// @brief   Save and load the trace events.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_IO_TRACE_HPP_
+#define MCNLA_CORE_IO_TRACE_HPP_
+
+#include <mcnla/core/io/def.hpp>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <mcnla/core/mpi/def.hpp>
+#include <mcnla/core/utility/tracer.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The I/O namespace.
+//
+namespace io {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace
+//
+namespace detail {
+
+static constexpr const char* kTraceMagic = "MCNLATRC";
+static constexpr index_t kTraceMagicLen = 8;
+
+template <typename _Type>
+inline void writeTraceValue(
+    std::ostream &fout,
+    const _Type value
+) noexcept {
+  fout.write(static_cast<const char*>(static_cast<const void*>(&value)), sizeof(value));
+}
+
+template <typename _Type>
+inline _Type readTraceValue(
+    std::istream &fin
+) noexcept {
+  _Type value = 0;
+  fin.read(static_cast<char*>(static_cast<void*>(&value)), sizeof(value));
+  return value;
+}
+
+inline void writeTraceString(
+    std::ostream &fout,
+    const std::string &str
+) noexcept {
+  writeTraceValue<std::int32_t>(fout, str.size());
+  fout.write(str.data(), str.size());
+}
+
+inline std::string readTraceString(
+    std::istream &fin
+) noexcept {
+  std::string str(readTraceValue<std::int32_t>(fin), '\0');
+  fin.read(&str[0], str.size());
+  return str;
+}
+
+inline void writeTraceEvents(
+    std::ostream &fout,
+    const std::vector<utility::TraceEvent> &events
+) noexcept {
+  writeTraceValue<std::int64_t>(fout, events.size());
+  for ( const auto &event : events ) {
+    writeTraceString(fout, event.name);
+    writeTraceString(fout, event.category);
+    writeTraceValue(fout, event.begin);
+    writeTraceValue(fout, event.end);
+    writeTraceValue(fout, event.bytes);
+    writeTraceValue(fout, event.depth);
+  }
+}
+
+inline std::vector<utility::TraceEvent> readTraceEvents(
+    std::istream &fin
+) noexcept {
+  std::vector<utility::TraceEvent> events(readTraceValue<std::int64_t>(fin));
+  for ( auto &event : events ) {
+    event.name     = readTraceString(fin);
+    event.category = readTraceString(fin);
+    event.begin    = readTraceValue<double>(fin);
+    event.end      = readTraceValue<double>(fin);
+    event.bytes    = readTraceValue<std::int64_t>(fin);
+    event.depth    = readTraceValue<std::int32_t>(fin);
+  }
+  return events;
+}
+
+inline void writeJsonString(
+    std::ostream &fout,
+    const std::string &str
+) noexcept {
+  fout << '"';
+  for ( auto c : str ) {
+    if ( c == '"' || c == '\\' ) {
+      fout << '\\';
+    }
+    fout << c;
+  }
+  fout << '"';
+}
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  io_module
+/// Write the trace events into a stream in Chrome trace format.
+///
+/// The events of the i-th MPI node are shown as the process `rank i`. The timestamps are written in microseconds.
+///
+/// @param  fout    The stream.
+/// @param  events  The events of each MPI node.
+///
+/// @see  https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+///
+inline void writeChromeTrace(
+    std::ostream &fout,
+    const std::vector<std::vector<utility::TraceEvent>> &events
+) noexcept {
+  fout << "{\"traceEvents\":[\n";
+  const char *sep = "";
+  fout << std::fixed << std::setprecision(3);
+  for ( std::size_t rank = 0; rank < events.size(); ++rank ) {
+    fout << sep << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank << ",\"tid\":0,"
+         << "\"args\":{\"name\":\"rank " << rank << "\"}}";
+    sep = ",\n";
+    for ( const auto &event : events[rank] ) {
+      fout << sep << "{\"name\":";
+      detail::writeJsonString(fout, event.name);
+      fout << ",\"cat\":";
+      detail::writeJsonString(fout, event.category);
+      fout << ",\"ph\":\"X\",\"pid\":" << rank << ",\"tid\":0"
+           << ",\"ts\":" << event.begin * 1e6 << ",\"dur\":" << (event.end - event.begin) * 1e6
+           << ",\"args\":{\"bytes\":" << event.bytes << ",\"depth\":" << event.depth << "}}";
+    }
+  }
+  fout << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  io_module
+/// Save the trace events of all MPI nodes into a file in Chrome trace format.
+///
+/// The events are gathered to the root rank, which writes the file. The file can be opened in `chrome://tracing` or
+/// Perfetto.
+///
+/// @attention  This routine is collective over @a comm.
+///
+/// @see  utility::Tracer
+///
+inline void saveChromeTrace(
+    const char *file,
+    const MPI_Comm comm,
+    const mpi_int_t root = 0
+) noexcept {
+  const auto mpi_rank = mpi::commRank(comm);
+  const auto mpi_size = mpi::commSize(comm);
+
+  // Serialize the events
+  std::ostringstream sout;
+  detail::writeTraceEvents(sout, utility::Tracer::instance().events());
+  const auto data = sout.str();
+  mcnla_assert_mpi_count(data.size());
+
+  // Gather the events
+  mpi_int_t count = data.size();
+  std::vector<mpi_int_t> counts(mpi_size), displs(mpi_size);
+  mcnla_assert_pass(MPI_Gather(&count, 1, MPI_INT, counts.data(), 1, MPI_INT, root, comm));
+  std::string buffer;
+  if ( mpi_rank == root ) {
+    std::size_t total = 0;
+    for ( mpi_int_t i = 0; i < mpi_size; ++i ) {
+      displs[i] = total;
+      total += counts[i];
+    }
+    mcnla_assert_mpi_count(total);
+    buffer.resize(total);
+  }
+  mcnla_assert_pass(MPI_Gatherv(data.data(), count, MPI_CHAR, &buffer[0], counts.data(), displs.data(), MPI_CHAR,
+                                root, comm));
+
+  // Write the file
+  if ( mpi_rank == root ) {
+    std::vector<std::vector<utility::TraceEvent>> events(mpi_size);
+    for ( mpi_int_t i = 0; i < mpi_size; ++i ) {
+      std::istringstream sin(buffer.substr(displs[i], counts[i]));
+      events[i] = detail::readTraceEvents(sin);
+    }
+    std::ofstream fout(file);
+    mcnla_assert_false(fout.fail());
+    writeChromeTrace(fout, events);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  io_module
+/// Save the trace events of this MPI node into a binary file.
+///
+/// Each MPI node writes its own file without communication; the files are merged into a Chrome trace offline by the
+/// `trace2json` program.
+///
+/// @param  file  The file name.
+/// @param  rank  The MPI rank of this node.
+///
+/// @see  loadBinaryTrace
+///
+inline void saveBinaryTrace(
+    const char *file,
+    const mpi_int_t rank
+) noexcept {
+  std::ofstream fout(file, std::ios::binary);
+  mcnla_assert_false(fout.fail());
+  fout.write(detail::kTraceMagic, detail::kTraceMagicLen);
+  detail::writeTraceValue<std::int32_t>(fout, rank);
+  detail::writeTraceEvents(fout, utility::Tracer::instance().events());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  io_module
+/// Load the trace events from a binary file.
+///
+/// @param  file  The file name.
+/// @param  rank  The MPI rank of the saving node.
+///
+/// @see  saveBinaryTrace
+///
+inline std::vector<utility::TraceEvent> loadBinaryTrace(
+    const char *file,
+    mpi_int_t &rank
+) noexcept {
+  std::ifstream fin(file, std::ios::binary);
+  mcnla_assert_false(fin.fail());
+  char magic[detail::kTraceMagicLen];
+  fin.read(magic, detail::kTraceMagicLen);
+  mcnla_assert_false(strncmp(magic, detail::kTraceMagic, detail::kTraceMagicLen));
+  rank = detail::readTraceValue<std::int32_t>(fin);
+  return detail::readTraceEvents(fin);
+}
+
+}  // namespace io
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_IO_TRACE_HPP_
@@ -10,6 +10,8 @@
 
 #include <mcnla/core/def.hpp>
 #include <mcnla/core/matrix/def.hpp>
+#include <mcnla/core/utility/counter.hpp>
+#include <mcnla/core/utility/tracer.hpp>
 #include <mcnla/core/utility/traits.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
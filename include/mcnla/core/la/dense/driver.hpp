@@ -15,5 +15,6 @@
 #include <mcnla/core/la/dense/driver/geqrfg.hpp>
 #include <mcnla/core/la/dense/driver/gesvd.hpp>
 #include <mcnla/core/la/dense/driver/syev.hpp>
+#include <mcnla/core/la/dense/driver/syevr.hpp>
 
 #endif  // MCNLA_CORE_LA_DENSE_DRIVER_HPP_
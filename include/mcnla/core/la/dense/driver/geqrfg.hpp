@@ -145,6 +145,10 @@ void DenseGeqrfgDriver<_jobq, _jobr, _Val, _trans>::compute(
     mcnla_assert_eq(r.sizes(), std::make_tuple(ncolQ(), ncol_));
   }
 
+  const double m = std::max(nrow_, ncol_), n = std::min(nrow_, ncol_);
+  const double flops = (2*m*n*n - 2*n*n*n/3) * ((_jobq != 'N') ? 2 : 1);
+  utility::TraceSpan span("geqrfg", "lapack", utility::countFlops(flops, sizeof(_Val) * m * n));
+
   if ( !isTrans(_trans) ) {
     mcnla_assert_pass(detail::geqrf(nrow_, ncol_, a.valPtr(), a.pitch(), tau.valPtr(), work_.valPtr(), work_.len()));
   } else {
@@ -181,6 +181,10 @@ void DenseGesvdDriver<_jobu, _jobvt, _Val, _trans>::compute(
   auto u_pitch  = (u.pitch()  > 0) ? u.pitch()  : 1;
   auto vt_pitch = (vt.pitch() > 0) ? vt.pitch() : 1;
 
+  const double m = std::max(nrow_, ncol_), n = std::min(nrow_, ncol_);
+  const double flops = (__jobu == 'N' && __jobvt == 'N') ? (4*m*n*n - 4*n*n*n/3) : (14*m*n*n + 8*n*n*n);
+  utility::TraceSpan span("gesvd", "lapack", utility::countFlops(flops, sizeof(_Val) * m * n));
+
   if ( !isTrans(_trans) ) {
     mcnla_assert_pass(detail::gesvd(__jobu, __jobvt, nrow_, ncol_, a.valPtr(), a.pitch(),
                                     s.valPtr(), u.valPtr(), u_pitch, vt.valPtr(), vt_pitch,
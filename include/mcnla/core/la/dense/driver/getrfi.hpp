@@ -119,6 +119,9 @@ void DenseGetrfiDriver<_Val, _trans>::compute(
 ) noexcept {
   mcnla_assert_eq(a.sizes(), this->sizes());
 
+  const double n = size_;
+  utility::TraceSpan span("getrfi", "lapack", utility::countFlops(2*n*n*n, sizeof(_Val) * n * n));
+
   mcnla_assert_pass(detail::getrf(size_, size_, a.valPtr(), a.pitch(), ipiv_.valPtr()));
   mcnla_assert_pass(detail::getri(size_, a.valPtr(), a.pitch(), ipiv_.valPtr(), work_.valPtr(), work_.len()));
 }
@@ -155,6 +155,10 @@ void DenseSyevDriver<_jobz, _Val, _trans, _uplo>::compute(
   mcnla_assert_eq(w.len(), size_);
   mcnla_assert_true(w.isShrunk());
 
+  const double n = size_;
+  const double flops = (__jobz == 'N') ? (4*n*n*n/3) : (9*n*n*n);
+  utility::TraceSpan span("syev", "lapack", utility::countFlops(flops, sizeof(_Val) * n * n));
+
   mcnla_assert_pass(detail::syev(__jobz, toUploChar(_uplo, _trans), size_, a.valPtr(), a.pitch(),
                                  w.valPtr(), work_.valPtr(), work_.len(), rwork_.valPtr()));
 }
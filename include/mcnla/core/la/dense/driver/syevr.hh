@@ -0,0 +1,136 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/la/dense/driver/syevr.hh
+/// @brief   The definition of LAPACK SYEVR driver.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_LA_DENSE_DRIVER_SYEVR_DRIVER_HH_
+#define MCNLA_CORE_LA_DENSE_DRIVER_SYEVR_DRIVER_HH_
+
+#include <mcnla/core/la/def.hpp>
+#include <tuple>
+#include <mcnla/core/matrix.hpp>
+#include <mcnla/core/utility/traits.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The linear algebra namespace
+//
+namespace la {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  la_dense_lapack_ls_module
+/// @brief  The partial eigenvalue decomposition driver of symmetric / Hermitian matrices.
+///
+/// Computes only the largest eigenvalues (and eigenvectors) by the MRRR algorithm, sorted in descending order.
+///
+/// @see  mcnla::la::DenseSyevDriver
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo>
+class DenseSyevrDriver {
+
+  static_assert(_jobz == 'N' || _jobz == 'V', "Job undefined!");
+
+ private:
+
+  using ValType        = _Val;
+  using MatrixType     = DenseSymmetricMatrix<_Val, _trans, _uplo>;
+  using ZMatrixType    = DenseMatrix<_Val, _trans>;
+  using VectorType     = DenseVector<_Val>;
+  using RealVectorType = DenseVector<RealValT<_Val>>;
+  using IdxVectorType  = DenseVector<index_t>;
+
+  static constexpr bool is_real_ = traits::ValTraits<ValType>::is_real;
+
+ protected:
+
+  /// The dimension.
+  index_t size_;
+
+  /// The number of computed eigenvalues.
+  index_t num_;
+
+  /// The workspace.
+  VectorType work_;
+
+  /// The real workspace.
+  RealVectorType rwork_;
+
+  /// The integer workspace.
+  IdxVectorType iwork_;
+
+  /// The support of the eigenvectors.
+  IdxVectorType isuppz_;
+
+ public:
+
+  // Constructor
+  inline DenseSyevrDriver() noexcept;
+  inline DenseSyevrDriver( const index_t size, const index_t num ) noexcept;
+  inline DenseSyevrDriver( const MatrixType &a, const index_t num ) noexcept;
+
+  // Operators
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+  template <class _TypeA, class _TypeW, class _TypeZ>
+  inline void operator()( _TypeA &&a, _TypeW &&w, _TypeZ &&z ) noexcept;
+#else  // DOXYGEN_SHOULD_SKIP_THIS
+  inline void operator()( MatrixType &a, RealVectorType &w, ZMatrixType &z ) noexcept;
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+  // Computes eigenvalues
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+  template <class _TypeA, class _TypeW>
+  inline void computeValues( _TypeA &&a, _TypeW &&w ) noexcept;
+#else  // DOXYGEN_SHOULD_SKIP_THIS
+  inline void computeValues( MatrixType &a, RealVectorType &w ) noexcept;
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+  // Resizes
+  template <typename ..._Args>
+  inline void reconstruct( _Args... args ) noexcept;
+
+  // Get sizes
+  inline std::tuple<index_t, index_t> sizes() const noexcept;
+  inline index_t num() const noexcept;
+
+  // Gets workspaces
+  inline       VectorType& getWork() noexcept;
+  inline const VectorType& getWork() const noexcept;
+  inline       RealVectorType& getRwork() noexcept;
+  inline const RealVectorType& getRwork() const noexcept;
+  inline       IdxVectorType& getIwork() noexcept;
+  inline const IdxVectorType& getIwork() const noexcept;
+
+ protected:
+
+  // Computes
+  template <JobOption __jobz = _jobz>
+  inline void compute( MatrixType &a, RealVectorType &w, ZMatrixType &z ) noexcept;
+
+  // Queries workspace size
+  inline index_t query() noexcept;
+  inline index_t rquery() noexcept;
+  inline index_t iquery() noexcept;
+
+};
+
+/// @ingroup  la_dense_lapack_ls_module
+/// @see  DenseSyevrDriver
+template <JobOption _jobz, typename _Val, Uplo _uplo = Uplo::UPPER>
+using DenseSyevrDriverColMajor = DenseSyevrDriver<_jobz, _Val, Trans::NORMAL, _uplo>;
+
+/// @ingroup  la_dense_lapack_ls_module
+template <JobOption _jobz, typename _Val, Uplo _uplo = Uplo::LOWER>
+/// @see  DenseSyevrDriver
+using DenseSyevrDriverRowMajor = DenseSyevrDriver<_jobz, _Val, Trans::TRANS, _uplo>;
+
+}  // namespace la
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_LA_DENSE_DRIVER_SYEVR_DRIVER_HH_
@@ -0,0 +1,269 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/la/dense/driver/syevr.hpp
+/// @brief   The LAPACK SYEVR driver.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_LA_DENSE_DRIVER_SYEVR_HPP_
+#define MCNLA_CORE_LA_DENSE_DRIVER_SYEVR_HPP_
+
+#include <mcnla/core/la/dense/driver/syevr.hh>
+#include <algorithm>
+#include <mcnla/core/la/raw/lapack/syevr.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The linear algebra namespace
+//
+namespace la {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Default constructor.
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo>
+DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::DenseSyevrDriver() noexcept
+  : size_(0),
+    num_(0),
+    work_(),
+    rwork_(),
+    iwork_(),
+    isuppz_() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Construct with given size information.
+///
+/// @param  size  The dimension of the matrix.
+/// @param  num   The number of the largest eigenvalues to be computed.
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo>
+DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::DenseSyevrDriver(
+    const index_t size,
+    const index_t num
+) noexcept
+  : size_(size),
+    num_(num),
+    work_(query()),
+    rwork_(rquery()),
+    iwork_(iquery()),
+    isuppz_(2 * num) {
+  mcnla_assert_gt(size_, 0);
+  mcnla_assert_gele(num_, 1, size_);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Construct with given size information.
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo>
+DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::DenseSyevrDriver(
+    const MatrixType &a,
+    const index_t num
+) noexcept
+  : DenseSyevrDriver(a.nrow(), num) {
+  mcnla_assert_true(a.isSquare());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  compute
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo>
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <class _TypeA, class _TypeW, class _TypeZ>
+void DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::operator()(
+    _TypeA &&a,
+    _TypeW &&w,
+    _TypeZ &&z
+#else  // DOXYGEN_SHOULD_SKIP_THIS
+void DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::operator()(
+    MatrixType &a,
+    RealVectorType &w,
+    ZMatrixType &z
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+) noexcept {
+  compute(a, w, z);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Computes eigenvalues only.
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo>
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <class _TypeA, class _TypeW>
+void DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::computeValues(
+    _TypeA &&a,
+    _TypeW &&w
+#else  // DOXYGEN_SHOULD_SKIP_THIS
+void DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::computeValues(
+    MatrixType &a,
+    RealVectorType &w
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+) noexcept {
+  ZMatrixType z;
+  compute<'N'>(a, w, z);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Reconstruct the driver.
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo> template <typename ..._Args>
+void DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::reconstruct(
+    _Args... args
+) noexcept {
+  *this = DenseSyevrDriver<_jobz, _Val, _trans, _uplo>(args...);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the sizes.
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo>
+std::tuple<index_t, index_t> DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::sizes() const noexcept {
+  return std::make_tuple(size_, size_);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of computed eigenvalues.
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo>
+index_t DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::num() const noexcept {
+  return num_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the workspace
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo>
+DenseVector<_Val>& DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::getWork() noexcept {
+  return work_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  getWork
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo>
+const DenseVector<_Val>& DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::getWork() const noexcept {
+  return work_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the real workspace
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo>
+DenseVector<RealValT<_Val>>& DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::getRwork() noexcept {
+  return rwork_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  getRwork
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo>
+const DenseVector<RealValT<_Val>>& DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::getRwork() const noexcept {
+  return rwork_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the integer workspace
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo>
+DenseVector<index_t>& DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::getIwork() noexcept {
+  return iwork_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  getIwork
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo>
+const DenseVector<index_t>& DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::getIwork() const noexcept {
+  return iwork_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Computes the largest eigenvalues and eigenvectors.
+///
+/// The first #num entries of @a w are the largest eigenvalues in descending order.
+///
+/// @attention  The eigenvectors are Stored in columnwise for column-major storage, in rowwise for row-major storage.
+/// @attention  Matrix @a a will be destroyed!
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo> template <JobOption __jobz>
+void DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::compute(
+    MatrixType &a,
+    RealVectorType &w,
+    ZMatrixType &z
+) noexcept {
+  mcnla_assert_eq(a.sizes(), this->sizes());
+  mcnla_assert_eq(w.len(), size_);
+  mcnla_assert_true(w.isShrunk());
+
+  if ( __jobz == 'V' ) {
+    mcnla_assert_eq(z.sizes(), (!isTrans(_trans) ? std::make_tuple(size_, num_) : std::make_tuple(num_, size_)));
+  }
+
+  const auto z_pitch = (__jobz == 'V') ? z.pitch() : size_;
+
+  const double n = size_, k = num_;
+  const double flops = 4*n*n*n/3 + ((__jobz == 'N') ? 0 : (2*n*n*k));
+  utility::TraceSpan span("syevr", "lapack", utility::countFlops(flops, sizeof(_Val) * n * n));
+  index_t m;
+  mcnla_assert_pass(detail::syevr(__jobz, 'I', toUploChar(_uplo, _trans), size_, a.valPtr(), a.pitch(), 0, 0,
+                                  size_-num_+1, size_, 0, &m, w.valPtr(), z.valPtr(), z_pitch, isuppz_.valPtr(),
+                                  work_.valPtr(), work_.len(), rwork_.valPtr(), rwork_.len(),
+                                  iwork_.valPtr(), iwork_.len()));
+  mcnla_assert_eq(m, num_);
+
+  // Sorts in descending order
+  std::reverse(w.valPtr(), w.valPtr() + num_);
+  if ( __jobz == 'V' ) {
+    for ( index_t i = 0; i < num_/2; ++i ) {
+      std::swap_ranges(z.valPtr() + i * z_pitch, z.valPtr() + i * z_pitch + size_, z.valPtr() + (num_-1-i) * z_pitch);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Query the optimal workspace size.
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo>
+index_t DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::query() noexcept {
+  ValType lwork; RealValT<_Val> lrwork; index_t liwork, m;
+  mcnla_assert_pass(detail::syevr(_jobz, 'I', toUploChar(_uplo, _trans), size_, nullptr, size_, 0, 0,
+                                  size_-num_+1, size_, 0, &m, nullptr, nullptr, size_, nullptr,
+                                  &lwork, -1, &lrwork, -1, &liwork, -1));
+  return std::real(lwork);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Query the optimal real workspace size.
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo>
+index_t DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::rquery() noexcept {
+  if ( is_real_ ) {
+    return 0;
+  }
+  ValType lwork; RealValT<_Val> lrwork; index_t liwork, m;
+  mcnla_assert_pass(detail::syevr(_jobz, 'I', toUploChar(_uplo, _trans), size_, nullptr, size_, 0, 0,
+                                  size_-num_+1, size_, 0, &m, nullptr, nullptr, size_, nullptr,
+                                  &lwork, -1, &lrwork, -1, &liwork, -1));
+  return lrwork;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Query the optimal integer workspace size.
+///
+template <JobOption _jobz, typename _Val, Trans _trans, Uplo _uplo>
+index_t DenseSyevrDriver<_jobz, _Val, _trans, _uplo>::iquery() noexcept {
+  ValType lwork; RealValT<_Val> lrwork; index_t liwork, m;
+  mcnla_assert_pass(detail::syevr(_jobz, 'I', toUploChar(_uplo, _trans), size_, nullptr, size_, 0, 0,
+                                  size_-num_+1, size_, 0, &m, nullptr, nullptr, size_, nullptr,
+                                  &lwork, -1, &lrwork, -1, &liwork, -1));
+  return liwork;
+}
+
+}  // namespace la
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_LA_DENSE_DRIVER_SYEVR_HPP_
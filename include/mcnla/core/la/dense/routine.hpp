@@ -46,6 +46,7 @@
 
 // LAPACK auxiliary
 #include <mcnla/core/la/dense/routine/lacpy.hpp>
+#include <mcnla/core/la/dense/routine/lag2.hpp>
 #include <mcnla/core/la/dense/routine/larnv.hpp>
 
 #endif  // MCNLA_CORE_LA_DENSE_ROUTINE_HPP_
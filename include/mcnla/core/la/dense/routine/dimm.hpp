@@ -49,6 +49,9 @@ inline void dimmImpl2(
   mcnla_assert_eq(a.size(), c.nrow());
   mcnla_assert_eq(b.sizes(), c.sizes());
 
+  const double m = c.nrow(), n = c.ncol();
+  utility::TraceSpan span("dimm", "blas", utility::countFlops(2*m*n, sizeof(_Val) * (a.size() + 3*m*n)));
+
   index_t idiag[1] = {0};
   diamm('N', c.nrow(), c.ncol(), a.size(), alpha, "D NC",
         a.valPtr(), a.size(), idiag, 1, b.valPtr(), b.pitch(), beta, c.valPtr(), c.pitch());
@@ -66,6 +69,9 @@ inline void dimmImpl2(
   mcnla_assert_eq(a.size(), c.nrow());
   mcnla_assert_eq(b.sizes(), c.sizes());
 
+  const double m = c.nrow(), n = c.ncol();
+  utility::TraceSpan span("dimm", "blas", utility::countFlops(2*m*n, sizeof(_Val) * (a.size() + 3*m*n)));
+
   auto da = a.vec();
   for ( index_t i = 0; i < da.len(); ++i ) {
     la::axpby(b(i, ""_), c(i, ""_), da(i) * alpha, beta);
@@ -83,6 +89,9 @@ inline void dimmImpl2(
   mcnla_assert_eq(a.size(), c.ncol());
   mcnla_assert_eq(b.sizes(), c.sizes());
 
+  const double m = c.nrow(), n = c.ncol();
+  utility::TraceSpan span("dimm", "blas", utility::countFlops(2*m*n, sizeof(_Val) * (a.size() + 3*m*n)));
+
   auto da = a.vec();
   for ( index_t i = 0; i < da.len(); ++i ) {
     la::axpby(b(""_, i), c(""_, i), da(i) * alpha, beta);
@@ -185,6 +194,9 @@ inline void dimmImpl0(
 ) noexcept {
   mcnla_assert_eq(a.size(), c.nrow());
 
+  const double m = c.nrow(), n = c.ncol();
+  utility::TraceSpan span("dimm", "blas", utility::countFlops(m*n, sizeof(_Val) * (a.size() + 2*m*n)));
+
   auto da = a.vec();
   for ( index_t i = 0; i < da.len(); ++i ) {
     la::scal(c(i, ""_), da(i) * alpha);
@@ -199,6 +211,9 @@ inline void dimmImpl0(
 ) noexcept {
   mcnla_assert_eq(a.size(), c.ncol());
 
+  const double m = c.nrow(), n = c.ncol();
+  utility::TraceSpan span("dimm", "blas", utility::countFlops(m*n, sizeof(_Val) * (a.size() + 2*m*n)));
+
   auto da = a.vec();
   for ( index_t i = 0; i < da.len(); ++i ) {
     la::scal(c(""_, i), da(i) * alpha);
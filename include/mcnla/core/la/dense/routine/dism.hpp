@@ -46,6 +46,9 @@ inline void dismImpl2(
 ) noexcept {
   mcnla_assert_eq(a.size(), b.nrow());
 
+  const double m = b.nrow(), n = b.ncol();
+  utility::TraceSpan span("dism", "blas", utility::countFlops(m*n, sizeof(_Val) * (a.size() + 2*m*n)));
+
   index_t idiag[1] = {0};
   diasm('N', b.nrow(), b.ncol(), alpha, "TLNC",
         a.valPtr(), a.size(), idiag, 1, b.valPtr(), b.pitch(), b.valPtr(), b.pitch());
@@ -59,6 +62,9 @@ inline void dismImpl2(
 ) noexcept {
   mcnla_assert_eq(a.size(), b.nrow());
 
+  const double m = b.nrow(), n = b.ncol();
+  utility::TraceSpan span("dism", "blas", utility::countFlops(m*n, sizeof(_Val) * (a.size() + 2*m*n)));
+
   auto da = a.vec();
   for ( index_t i = 0; i < da.len(); ++i ) {
     la::scal(b(i, ""_), alpha / da(i));
@@ -74,6 +80,9 @@ inline void dismImpl2(
 ) noexcept {
   mcnla_assert_eq(a.size(), b.ncol());
 
+  const double m = b.nrow(), n = b.ncol();
+  utility::TraceSpan span("dism", "blas", utility::countFlops(m*n, sizeof(_Val) * (a.size() + 2*m*n)));
+
   auto da = a.vec();
   for ( index_t i = 0; i < da.len(); ++i ) {
     la::scal(b(""_, i), alpha / da(i));
@@ -44,6 +44,9 @@ inline void gemmImpl2(
   mcnla_assert_eq(c.ncol(), b.ncol());
   mcnla_assert_eq(a.ncol(), b.nrow());
 
+  const double m = c.nrow(), n = c.ncol(), k = a.ncol();
+  utility::TraceSpan span("gemm", "blas", utility::countFlops(2*m*n*k, sizeof(_Val) * (m*k + k*n + 2*m*n)));
+
   gemm(toTransChar<_Val>(_transa), toTransChar<_Val>(_transb), c.nrow(), c.ncol(), a.ncol(),
        alpha, a.valPtr(), a.pitch(), b.valPtr(), b.pitch(), beta, c.valPtr(), c.pitch());
 }
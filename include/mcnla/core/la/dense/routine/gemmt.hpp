@@ -44,6 +44,9 @@ inline void gemmtImpl1(
   mcnla_assert_eq(c.size(), b.ncol());
   mcnla_assert_eq(a.ncol(), b.nrow());
 
+  const double n = c.size(), k = a.ncol();
+  utility::TraceSpan span("gemmt", "blas", utility::countFlops(n*(n+1)*k, sizeof(_Val) * (2*n*k + n*n)));
+
   gemmt(toUploChar(_uplo, _transc), toTransChar<_Val>(_transa), toTransChar<_Val>(_transb), c.size(), a.ncol(),
         alpha, a.valPtr(), a.pitch(), b.valPtr(), b.pitch(), beta, c.valPtr(), c.pitch());
 }
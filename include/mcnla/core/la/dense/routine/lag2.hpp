@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/la/dense/routine/lag2.hpp
+/// @brief   The LAPACK LAG2 routine.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_LA_DENSE_ROUTINE_LAG2_HPP_
+#define MCNLA_CORE_LA_DENSE_ROUTINE_LAG2_HPP_
+
+#include <mcnla/core/la/def.hpp>
+#include <mcnla/core/matrix.hpp>
+#include <mcnla/core/la/raw/lapack/lacpy.hpp>
+#include <mcnla/core/la/raw/lapack/lag2.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The linear algebra namespace
+//
+namespace la {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace
+//
+namespace detail {
+
+//@{
+
+// ========================================================================================================================== //
+// Impl1
+//
+
+template <typename _ValA, typename _ValB, Trans _trans>
+inline void lag2Impl(
+    const DenseMatrix<_ValA, _trans> &a,
+          DenseMatrix<_ValB, _trans> &b
+) noexcept {
+  mcnla_assert_eq(a.sizes(), b.sizes());
+  mcnla_assert_pass(detail::lag2(a.dim0(), a.dim1(), a.valPtr(), a.pitch(), b.valPtr(), b.pitch()));
+}
+
+template <typename _Val, Trans _trans>
+inline void lag2Impl(
+    const DenseMatrix<_Val, _trans> &a,
+          DenseMatrix<_Val, _trans> &b
+) noexcept {
+  mcnla_assert_eq(a.sizes(), b.sizes());
+  detail::lacpy('A', a.dim0(), a.dim1(), a.valPtr(), a.pitch(), b.valPtr(), b.pitch());
+}
+
+//@}
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  la_dense_lapack_aux_module
+/// @brief  Converts a matrix to another precision.
+///
+/// Converts a double precision matrix to single precision, or a single precision matrix to double precision. The matrix is
+/// simply copied if both precisions are the same.
+///
+/// @attention  The entries of @a a should not overflow in single precision.
+///
+template <typename _ValA, typename _ValB, Trans _trans>
+inline void lag2(
+    const DenseMatrix<_ValA, _trans> &a,
+          DenseMatrix<_ValB, _trans> &b
+) noexcept {
+  detail::lag2Impl(a, b);
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _ValA, typename _ValB, Trans _trans>
+inline void lag2(
+    const DenseMatrix<_ValA, _trans> &a,
+          DenseMatrix<_ValB, _trans> &&b
+) noexcept {
+  detail::lag2Impl(a, b);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace la
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_LA_DENSE_ROUTINE_LAG2_HPP_
@@ -44,6 +44,9 @@ inline void symmImpl3(
   mcnla_assert_eq(a.size(), c.nrow());
   mcnla_assert_eq(b.sizes(), c.sizes());
 
+  const double m = c.nrow(), n = c.ncol();
+  utility::TraceSpan span("symm", "blas", utility::countFlops(2*m*m*n, sizeof(_Val) * (m*m + 3*m*n)));
+
   symm('L', toUploChar(_uplo, _transa), c.nrow(), c.ncol(),
        alpha, a.valPtr(), a.pitch(), b.valPtr(), b.pitch(), beta, c.valPtr(), c.pitch());
 }
@@ -59,6 +62,9 @@ inline void symmImpl3(
   mcnla_assert_eq(a.size(), c.ncol());
   mcnla_assert_eq(b.sizes(), c.sizes());
 
+  const double m = c.nrow(), n = c.ncol();
+  utility::TraceSpan span("symm", "blas", utility::countFlops(2*m*n*n, sizeof(_Val) * (n*n + 3*m*n)));
+
   symm('R', toUploChar(_uplo, _transa), c.nrow(), c.ncol(),
        alpha, a.valPtr(), a.pitch(), b.valPtr(), b.pitch(), beta, c.valPtr(), c.pitch());
 }
@@ -42,6 +42,9 @@ inline void syrkImpl2(
 ) noexcept {
   mcnla_assert_eq(c.size(), a.nrow());
 
+  const double n = c.nrow(), k = a.ncol();
+  utility::TraceSpan span("syrk", "blas", utility::countFlops(n*(n+1)*k, sizeof(_Val) * (n*k + n*n)));
+
   syrk(toUploChar(_uplo, _transc), toTransChar<_Val>(_transa), c.nrow(), a.ncol(),
        alpha, a.valPtr(), a.pitch(), beta, c.valPtr(), c.pitch());
 }
@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/la/raw/lapack/lag2.hpp
+/// @brief   The LAPACK LAG2S and LAG2D.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_LA_RAW_LAPACK_LAG2_HPP_
+#define MCNLA_CORE_LA_RAW_LAPACK_LAG2_HPP_
+
+#include <mcnla/core/la/def.hpp>
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <mcnla/core/la/raw/plugin/lapack_plugin_begin.h>
+
+extern void dlag2s_( const FORTRAN_INT m, const FORTRAN_INT n, const FORTRAN_REAL8 a, const FORTRAN_INT lda,
+                     FORTRAN_REAL4 sa, const FORTRAN_INT ldsa, FORTRAN_INT info );
+extern void slag2d_( const FORTRAN_INT m, const FORTRAN_INT n, const FORTRAN_REAL4 sa, const FORTRAN_INT ldsa,
+                     FORTRAN_REAL8 a, const FORTRAN_INT lda, FORTRAN_INT info );
+extern void zlag2c_( const FORTRAN_INT m, const FORTRAN_INT n, const FORTRAN_COMP8 a, const FORTRAN_INT lda,
+                     FORTRAN_COMP4 sa, const FORTRAN_INT ldsa, FORTRAN_INT info );
+extern void clag2z_( const FORTRAN_INT m, const FORTRAN_INT n, const FORTRAN_COMP4 sa, const FORTRAN_INT ldsa,
+                     FORTRAN_COMP8 a, const FORTRAN_INT lda, FORTRAN_INT info );
+
+#include <mcnla/core/la/raw/plugin/lapack_plugin_end.h>
+
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The linear algebra namespace
+//
+namespace la {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace
+//
+namespace detail {
+
+//@{
+static inline index_t lag2(
+    const index_t m, const index_t n, const double *a, const index_t lda, float *sa, const index_t ldsa
+) noexcept { index_t info; dlag2s_(&m, &n, a, &lda, sa, &ldsa, &info); return info; }
+static inline index_t lag2(
+    const index_t m, const index_t n, const float *sa, const index_t ldsa, double *a, const index_t lda
+) noexcept { index_t info; slag2d_(&m, &n, sa, &ldsa, a, &lda, &info); return info; }
+static inline index_t lag2(
+    const index_t m, const index_t n, const std::complex<double> *a, const index_t lda, std::complex<float> *sa,
+    const index_t ldsa
+) noexcept { index_t info; zlag2c_(&m, &n, a, &lda, sa, &ldsa, &info); return info; }
+static inline index_t lag2(
+    const index_t m, const index_t n, const std::complex<float> *sa, const index_t ldsa, std::complex<double> *a,
+    const index_t lda
+) noexcept { index_t info; clag2z_(&m, &n, sa, &ldsa, a, &lda, &info); return info; }
+//@}
+
+}  // namespace detail
+
+}  // namespace la
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_LA_RAW_LAPACK_LAG2_HPP_
@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/la/raw/lapack/syevr.hpp
+/// @brief   The LAPACK SYEVR.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_LA_RAW_LAPACK_SYEVR_HPP_
+#define MCNLA_CORE_LA_RAW_LAPACK_SYEVR_HPP_
+
+#include <mcnla/core/la/def.hpp>
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <mcnla/core/la/raw/plugin/lapack_plugin_begin.h>
+
+extern void ssyevr_( const FORTRAN_CHAR1 jobz, const FORTRAN_CHAR1 range, const FORTRAN_CHAR1 uplo, const FORTRAN_INT n,
+                     FORTRAN_REAL4 a, const FORTRAN_INT lda, const FORTRAN_REAL4 vl, const FORTRAN_REAL4 vu,
+                     const FORTRAN_INT il, const FORTRAN_INT iu, const FORTRAN_REAL4 abstol, FORTRAN_INT m, FORTRAN_REAL4 w,
+                     FORTRAN_REAL4 z, const FORTRAN_INT ldz, FORTRAN_INT isuppz, FORTRAN_REAL4 work, const FORTRAN_INT lwork,
+                     FORTRAN_INT iwork, const FORTRAN_INT liwork, FORTRAN_INT info );
+extern void dsyevr_( const FORTRAN_CHAR1 jobz, const FORTRAN_CHAR1 range, const FORTRAN_CHAR1 uplo, const FORTRAN_INT n,
+                     FORTRAN_REAL8 a, const FORTRAN_INT lda, const FORTRAN_REAL8 vl, const FORTRAN_REAL8 vu,
+                     const FORTRAN_INT il, const FORTRAN_INT iu, const FORTRAN_REAL8 abstol, FORTRAN_INT m, FORTRAN_REAL8 w,
+                     FORTRAN_REAL8 z, const FORTRAN_INT ldz, FORTRAN_INT isuppz, FORTRAN_REAL8 work, const FORTRAN_INT lwork,
+                     FORTRAN_INT iwork, const FORTRAN_INT liwork, FORTRAN_INT info );
+extern void cheevr_( const FORTRAN_CHAR1 jobz, const FORTRAN_CHAR1 range, const FORTRAN_CHAR1 uplo, const FORTRAN_INT n,
+                     FORTRAN_COMP4 a, const FORTRAN_INT lda, const FORTRAN_REAL4 vl, const FORTRAN_REAL4 vu,
+                     const FORTRAN_INT il, const FORTRAN_INT iu, const FORTRAN_REAL4 abstol, FORTRAN_INT m, FORTRAN_REAL4 w,
+                     FORTRAN_COMP4 z, const FORTRAN_INT ldz, FORTRAN_INT isuppz, FORTRAN_COMP4 work, const FORTRAN_INT lwork,
+                     FORTRAN_REAL4 rwork, const FORTRAN_INT lrwork, FORTRAN_INT iwork, const FORTRAN_INT liwork,
+                     FORTRAN_INT info );
+extern void zheevr_( const FORTRAN_CHAR1 jobz, const FORTRAN_CHAR1 range, const FORTRAN_CHAR1 uplo, const FORTRAN_INT n,
+                     FORTRAN_COMP8 a, const FORTRAN_INT lda, const FORTRAN_REAL8 vl, const FORTRAN_REAL8 vu,
+                     const FORTRAN_INT il, const FORTRAN_INT iu, const FORTRAN_REAL8 abstol, FORTRAN_INT m, FORTRAN_REAL8 w,
+                     FORTRAN_COMP8 z, const FORTRAN_INT ldz, FORTRAN_INT isuppz, FORTRAN_COMP8 work, const FORTRAN_INT lwork,
+                     FORTRAN_REAL8 rwork, const FORTRAN_INT lrwork, FORTRAN_INT iwork, const FORTRAN_INT liwork,
+                     FORTRAN_INT info );
+
+#include <mcnla/core/la/raw/plugin/lapack_plugin_end.h>
+
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The linear algebra namespace
+//
+namespace la {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace
+//
+namespace detail {
+
+//@{
+static inline index_t syevr(
+    const char jobz, const char range, const char uplo, const index_t n, float *a, const index_t lda,
+    const float vl, const float vu, const index_t il, const index_t iu, const float abstol, index_t *m, float *w,
+    float *z, const index_t ldz, index_t *isuppz, float *work, const index_t lwork, float *rwork, const index_t lrwork,
+    index_t *iwork, const index_t liwork
+) noexcept {
+  static_cast<void>(rwork); static_cast<void>(lrwork); index_t info;
+  ssyevr_(&jobz, &range, &uplo, &n, a, &lda, &vl, &vu, &il, &iu, &abstol, m, w, z, &ldz, isuppz, work, &lwork,
+          iwork, &liwork, &info);
+  return info;
+}
+static inline index_t syevr(
+    const char jobz, const char range, const char uplo, const index_t n, double *a, const index_t lda,
+    const double vl, const double vu, const index_t il, const index_t iu, const double abstol, index_t *m, double *w,
+    double *z, const index_t ldz, index_t *isuppz, double *work, const index_t lwork, double *rwork, const index_t lrwork,
+    index_t *iwork, const index_t liwork
+) noexcept {
+  static_cast<void>(rwork); static_cast<void>(lrwork); index_t info;
+  dsyevr_(&jobz, &range, &uplo, &n, a, &lda, &vl, &vu, &il, &iu, &abstol, m, w, z, &ldz, isuppz, work, &lwork,
+          iwork, &liwork, &info);
+  return info;
+}
+static inline index_t syevr(
+    const char jobz, const char range, const char uplo, const index_t n, std::complex<float> *a, const index_t lda,
+    const float vl, const float vu, const index_t il, const index_t iu, const float abstol, index_t *m, float *w,
+    std::complex<float> *z, const index_t ldz, index_t *isuppz, std::complex<float> *work, const index_t lwork,
+    float *rwork, const index_t lrwork, index_t *iwork, const index_t liwork
+) noexcept {
+  index_t info;
+  cheevr_(&jobz, &range, &uplo, &n, a, &lda, &vl, &vu, &il, &iu, &abstol, m, w, z, &ldz, isuppz, work, &lwork,
+          rwork, &lrwork, iwork, &liwork, &info);
+  return info;
+}
+static inline index_t syevr(
+    const char jobz, const char range, const char uplo, const index_t n, std::complex<double> *a, const index_t lda,
+    const double vl, const double vu, const index_t il, const index_t iu, const double abstol, index_t *m, double *w,
+    std::complex<double> *z, const index_t ldz, index_t *isuppz, std::complex<double> *work, const index_t lwork,
+    double *rwork, const index_t lrwork, index_t *iwork, const index_t liwork
+) noexcept {
+  index_t info;
+  zheevr_(&jobz, &range, &uplo, &n, a, &lda, &vl, &vu, &il, &iu, &abstol, m, w, z, &ldz, isuppz, work, &lwork,
+          rwork, &lrwork, iwork, &liwork, &info);
+  return info;
+}
+//@}
+
+}  // namespace detail
+
+}  // namespace la
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_LA_RAW_LAPACK_SYEVR_HPP_
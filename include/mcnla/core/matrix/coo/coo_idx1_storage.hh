@@ -41,6 +41,7 @@ class CooIdx1Storage : private DenseStorage<_Core, _Idx> {
 
   using BaseType::DenseStorage;
   using BaseType::operator=;
+  using BaseType::isEmpty;
 
  public:
 
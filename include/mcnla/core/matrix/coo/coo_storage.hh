@@ -46,6 +46,7 @@ class CooStorage : private DenseStorage<_Core, _Val> {
 
   using BaseType::val;
   using BaseType::valPtr;
+  using BaseType::isEmpty;
 
   // Constructors
   inline CooStorage() noexcept;
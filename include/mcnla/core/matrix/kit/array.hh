@@ -9,7 +9,9 @@
 #define MCNLA_CORE_MATRIX_KIT_ARRAY_HH_
 
 #include <mcnla/core/matrix/kit/def.hpp>
+#include <cstddef>
 #include <mcnla/core/matrix/kit/array_base.hpp>
+#include <mcnla/core/utility/memory_map.hpp>
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
   #define MCNLA_ALIAS  ArrS<CpuTag, _Val>
@@ -62,6 +64,8 @@ class MCNLA_ALIAS1
   // Constructors
   inline MCNLA_ALIAS0() noexcept;
   inline MCNLA_ALIAS0( const size_t size, const index_t offset = 0 ) noexcept;
+  inline MCNLA_ALIAS0( const char *file, const std::size_t pos, const size_t size,
+                       const utility::MapMode mode = utility::MapMode::READ_ONLY ) noexcept;
 
   // Copy
   inline MCNLA_ALIAS copy() const noexcept;
@@ -9,7 +9,10 @@
 #define MCNLA_CORE_MATRIX_KIT_ARRAY_HPP_
 
 #include <mcnla/core/matrix/kit/array.hh>
+#include <cstdlib>
+#include <iostream>
 #include <mcnla/core/utility/memory.hpp>
+#include <mcnla/core/utility/memory_pool.hpp>
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
   #define MCNLA_ALIAS  ArrS<CpuTag, _Val>
@@ -39,15 +42,45 @@ MCNLA_ALIAS::MCNLA_ALIAS0() noexcept
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Construct with given size information.
 ///
+/// The array is allocated by the current memory backend (see @ref utility::memoryBackend "memoryBackend").
+///
 template <typename _Val>
 MCNLA_ALIAS::MCNLA_ALIAS0(
     const size_t size,
     const index_t offset
 ) noexcept
-  : BaseType(std::shared_ptr<_Val>(utility::malloc<_Val>(size), utility::free<_Val>), size, offset) {
+  : BaseType(utility::allocateShared<_Val>(size), size, offset) {
   mcnla_assert_false(bool(size) && !bool(**this));
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Construct by mapping a file region.
+///
+/// The array is not read nor copied; the pages are loaded from the file on the first access (see
+/// @ref utility::mapFile "mapFile"), and the page cache is shared by all processes mapping the same file.
+///
+/// @param  file  The file name.
+/// @param  pos   The position of the array in the file (in bytes).
+/// @param  size  The size of the array.
+/// @param  mode  The map mode.
+///
+/// @attention  Writing a read-only array causes a segmentation fault.
+/// @attention  Aborts if the file cannot be mapped, e.g., the file is missing or shorter than the array.
+///
+template <typename _Val>
+MCNLA_ALIAS::MCNLA_ALIAS0(
+    const char *file,
+    const std::size_t pos,
+    const size_t size,
+    const utility::MapMode mode
+) noexcept
+  : BaseType(utility::mapFile<_Val>(file, pos, size, mode), size, 0) {
+  if ( bool(size) && !bool(**this) ) {
+    std::cerr << "Unable to map " << size << " values at byte " << pos << " of " << file << "!" << std::endl;
+    std::abort();
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Copies the array.
 ///
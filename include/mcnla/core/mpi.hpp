@@ -9,8 +9,11 @@
 #define MCNLA_CORE_MPI_HPP_
 
 #include <mcnla/core/mpi/def.hpp>
+#include <mcnla/core/mpi/request.hpp>
 #include <mcnla/core/mpi/dense.hpp>
 #include <mcnla/core/mpi/coo.hpp>
+#include <mcnla/core/mpi/aggregator.hpp>
+#include <mcnla/core/mpi/hierarchical_comm.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @defgroup  mpi_dense_module  Dense MPI Module
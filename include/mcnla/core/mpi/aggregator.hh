@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/mpi/aggregator.hh
+/// @brief   The definition of MPI communication aggregator.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_MPI_AGGREGATOR_HH_
+#define MCNLA_CORE_MPI_AGGREGATOR_HH_
+
+#include <mcnla/core/mpi/def.hpp>
+#include <vector>
+#include <mcnla/core/matrix.hpp>
+#include <mcnla/core/mpi/request.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MPI namespace.
+//
+namespace mpi {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_module
+/// The MPI communication aggregator.
+///
+/// Packs several small dense objects into one contiguous buffer, so that they are reduced by a single collective call.
+///
+/// @tparam  _Val  The value type.
+///
+/// @attention  The objects are registered by view. They should not be released while registered.
+///
+template <typename _Val>
+class Aggregator {
+
+ protected:
+
+  /// The packed buffer.
+  DenseVector<_Val> buffer_;
+
+  /// The registered objects (vectorized).
+  std::vector<DenseVector<_Val>> objects_;
+
+  /// The total length of the registered objects.
+  index_t len_;
+
+ public:
+
+  // Constructors
+  inline Aggregator() noexcept;
+
+  // Registers objects
+  inline Aggregator& add( DenseVector<_Val> &vector ) noexcept;
+  inline Aggregator& add( DenseVector<_Val> &&vector ) noexcept;
+  template <Trans _trans>
+  inline Aggregator& add( DenseMatrix<_Val, _trans> &matrix ) noexcept;
+  template <Trans _trans>
+  inline Aggregator& add( DenseMatrix<_Val, _trans> &&matrix ) noexcept;
+  inline void clear() noexcept;
+
+  // Gets information
+  inline index_t len() const noexcept;
+  inline index_t nobject() const noexcept;
+
+  // Communicates
+  inline void allreduce( const MPI_Op op, const MPI_Comm comm ) noexcept;
+  inline Request iallreduce( const MPI_Op op, const MPI_Comm comm ) noexcept;
+
+  // Packs
+  inline void pack() noexcept;
+  inline void unpack() noexcept;
+
+};
+
+}  // namespace mpi
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_MPI_AGGREGATOR_HH_
@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/mpi/aggregator.hpp
+/// @brief   The MPI communication aggregator.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_MPI_AGGREGATOR_HPP_
+#define MCNLA_CORE_MPI_AGGREGATOR_HPP_
+
+#include <mcnla/core/mpi/aggregator.hh>
+#include <mcnla/core/la/dense/routine/copy.hpp>
+#include <mcnla/core/mpi/dense/allreduce.hpp>
+#include <mcnla/core/mpi/dense/iallreduce.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MPI namespace.
+//
+namespace mpi {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Default constructor.
+///
+template <typename _Val>
+Aggregator<_Val>::Aggregator() noexcept
+  : buffer_(),
+    objects_(),
+    len_(0) {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Registers a vector.
+///
+template <typename _Val>
+Aggregator<_Val>& Aggregator<_Val>::add(
+    DenseVector<_Val> &vector
+) noexcept {
+  objects_.push_back(vector);
+  len_ += vector.len();
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Registers a matrix.
+///
+/// @attention  @a matrix should be shrunk.
+///
+template <typename _Val> template <Trans _trans>
+Aggregator<_Val>& Aggregator<_Val>::add(
+    DenseMatrix<_Val, _trans> &matrix
+) noexcept {
+  mcnla_assert_true(matrix.isShrunk());
+  return add(matrix.vec());
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val>
+Aggregator<_Val>& Aggregator<_Val>::add(
+    DenseVector<_Val> &&vector
+) noexcept {
+  return add(vector);
+}
+
+template <typename _Val> template <Trans _trans>
+Aggregator<_Val>& Aggregator<_Val>::add(
+    DenseMatrix<_Val, _trans> &&matrix
+) noexcept {
+  return add(matrix);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Unregisters all objects.
+///
+/// @note  The buffer is kept for later reuse.
+///
+template <typename _Val>
+void Aggregator<_Val>::clear() noexcept {
+  objects_.clear();
+  len_ = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the total length of the registered objects.
+///
+template <typename _Val>
+index_t Aggregator<_Val>::len() const noexcept {
+  return len_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of the registered objects.
+///
+template <typename _Val>
+index_t Aggregator<_Val>::nobject() const noexcept {
+  return objects_.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Combines the registered objects from all processes and distributes the result back to all processes.
+///
+/// Packs the objects, reduces the buffer in a single collective call, and unpacks the result.
+///
+/// @attention  The objects should be registered in the same order on all MPI nodes.
+///
+template <typename _Val>
+void Aggregator<_Val>::allreduce(
+    const MPI_Op op,
+    const MPI_Comm comm
+) noexcept {
+  pack();
+  mpi::allreduce(buffer_, op, comm);
+  unpack();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Combines the registered objects from all processes and distributes the result back to all processes (nonblocking
+///         version).
+///
+/// Packs the objects and starts reducing the buffer in a single collective call.
+///
+/// @return  The request of the operation.
+///
+/// @attention  The objects should be registered in the same order on all MPI nodes.
+/// @attention  Call #unpack after the request is completed to copy the result back to the objects.
+///
+template <typename _Val>
+Request Aggregator<_Val>::iallreduce(
+    const MPI_Op op,
+    const MPI_Comm comm
+) noexcept {
+  pack();
+  return mpi::iallreduce(buffer_, op, comm);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Copies the registered objects into the buffer.
+///
+/// @note  The buffer is allocated only if its length changes.
+///
+template <typename _Val>
+void Aggregator<_Val>::pack() noexcept {
+  if ( buffer_.len() != len_ ) {
+    buffer_.reconstruct(len_);
+  }
+  index_t idx = 0;
+  for ( auto &object : objects_ ) {
+    la::copy(object, buffer_(I_{idx, idx+object.len()}));
+    idx += object.len();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Copies the buffer back to the registered objects.
+///
+template <typename _Val>
+void Aggregator<_Val>::unpack() noexcept {
+  mcnla_assert_eq(buffer_.len(), len_);
+  index_t idx = 0;
+  for ( auto &object : objects_ ) {
+    la::copy(buffer_(I_{idx, idx+object.len()}), object);
+    idx += object.len();
+  }
+}
+
+}  // namespace mpi
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_MPI_AGGREGATOR_HPP_
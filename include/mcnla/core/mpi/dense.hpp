@@ -14,6 +14,18 @@
 #include <mcnla/core/mpi/dense/bcast.hpp>
 #include <mcnla/core/mpi/dense/gather.hpp>
 #include <mcnla/core/mpi/dense/gatherv.hpp>
+#include <mcnla/core/mpi/dense/iallgather.hpp>
+#include <mcnla/core/mpi/dense/iallreduce.hpp>
+#include <mcnla/core/mpi/dense/ialltoall.hpp>
+#include <mcnla/core/mpi/dense/ibcast.hpp>
+#include <mcnla/core/mpi/dense/igather.hpp>
+#include <mcnla/core/mpi/dense/igatherv.hpp>
+#include <mcnla/core/mpi/dense/irecv.hpp>
+#include <mcnla/core/mpi/dense/ireduce.hpp>
+#include <mcnla/core/mpi/dense/ireduce_scatter_block.hpp>
+#include <mcnla/core/mpi/dense/iscatter.hpp>
+#include <mcnla/core/mpi/dense/iscatterv.hpp>
+#include <mcnla/core/mpi/dense/isend.hpp>
 #include <mcnla/core/mpi/dense/recv.hpp>
 #include <mcnla/core/mpi/dense/reduce.hpp>
 #include <mcnla/core/mpi/dense/reduce_scatter_block.hpp>
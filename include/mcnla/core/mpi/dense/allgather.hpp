@@ -35,6 +35,7 @@ inline void allgatherImpl(
 ) noexcept {
   mcnla_assert_mpi_count(count * commSize(comm) * sizeof(_Val));
   constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Allgather", "mpi", utility::countCommBytes(count * commSize(comm) * sizeof(_Val)));
   MPI_Allgather(send.valPtr(), count, datatype, recv.valPtr(), count, datatype, comm);
 }
 
@@ -36,6 +36,7 @@ inline void allreduceImpl(
 ) noexcept {
   mcnla_assert_mpi_count(count * sizeof(_Val));
   constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Allreduce", "mpi", utility::countCommBytes(count * sizeof(_Val)));
   MPI_Allreduce(send.valPtr(), recv.valPtr(), count, datatype, op, comm);
 }
 
@@ -48,6 +49,7 @@ inline void allreduceImpl(
 ) noexcept {
   mcnla_assert_mpi_count(count * sizeof(_Val));
   constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Allreduce", "mpi", utility::countCommBytes(count * sizeof(_Val)));
   MPI_Allreduce(MPI_IN_PLACE, buffer.valPtr(), count, datatype, op, comm);
 }
 
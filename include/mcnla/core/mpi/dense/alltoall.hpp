@@ -35,6 +35,7 @@ inline void alltoallImpl(
 ) noexcept {
   mcnla_assert_mpi_count(count * sizeof(_Val));
   constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Alltoall", "mpi", utility::countCommBytes(count * sizeof(_Val)));
   MPI_Alltoall(send.valPtr(), count, datatype, recv.valPtr(), count, datatype, comm);
 }
 
@@ -46,6 +47,7 @@ inline void alltoallImpl(
 ) noexcept {
   mcnla_assert_mpi_count(count * sizeof(_Val));
   constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Alltoall", "mpi", utility::countCommBytes(count * sizeof(_Val)));
   MPI_Alltoall(MPI_IN_PLACE, count, datatype, buffer.valPtr(), count, datatype, comm);
 }
 
@@ -35,6 +35,7 @@ inline void bcastImpl(
 ) noexcept {
   mcnla_assert_mpi_count(count * sizeof(_Val));
   constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Bcast", "mpi", utility::countCommBytes(count * sizeof(_Val)));
   MPI_Bcast(buffer.valPtr(), count, datatype, root, comm);
 }
 
@@ -36,6 +36,7 @@ inline void gatherImpl(
 ) noexcept {
   mcnla_assert_mpi_count(count * commSize(comm) * sizeof(_Val));
   constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Gather", "mpi", utility::countCommBytes(count * commSize(comm) * sizeof(_Val)));
   MPI_Gather(send.valPtr(), count, datatype, recv.valPtr(), count, datatype, root, comm);
 }
 
@@ -38,6 +38,7 @@ inline void gathervImpl(
 ) noexcept {
   mcnla_assert_mpi_count(sendcount * sizeof(_Val));
   constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Gatherv", "mpi", utility::countCommBytes(sendcount * sizeof(_Val)));
   MPI_Gatherv(send.valPtr(), sendcount, datatype, recv.valPtr(), recvcounts, displs, datatype, root, comm);
 }
 
@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/mpi/dense/iallgather.hpp
+/// @brief   The MPI IALLGATHER routine.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_MPI_DENSE_IALLGATHER_HPP_
+#define MCNLA_CORE_MPI_DENSE_IALLGATHER_HPP_
+
+#include <mcnla/core/mpi/def.hpp>
+#include <mcnla/core/mpi/request.hpp>
+#include <mcnla/core/matrix.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MPI namespace.
+//
+namespace mpi {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace
+//
+namespace detail {
+
+template <typename _Val>
+inline Request iallgatherImpl(
+    const DenseStorage<CpuTag, _Val> &send,
+          DenseStorage<CpuTag, _Val> &recv,
+    const mpi_int_t count,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_mpi_count(count * commSize(comm) * sizeof(_Val));
+  constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Iallgather", "mpi", utility::countCommBytes(count * commSize(comm) * sizeof(_Val)));
+  MPI_Request request;
+  MPI_Iallgather(send.valPtr(), count, datatype, recv.valPtr(), count, datatype, comm, &request);
+  return Request(request);
+}
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_dense_module
+/// @brief  Gathers values from a group of processes (nonblocking version).
+///
+/// @return  The request of the operation.
+///
+/// @attention  The dimensions of @a send should be the same for all MPI nodes.
+/// @attention  @a send and @a recv should be shrunk.
+/// @attention  The buffers should not be modified until the request is completed.
+///
+//@{
+template <typename _Val>
+inline Request iallgather(
+    const DenseVector<_Val> &send,
+          DenseVector<_Val> &recv,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(send.isShrunk());
+  mcnla_assert_true(recv.isShrunk());
+  mcnla_assert_eq(send.dim0() * commSize(comm), recv.dim0());
+  return detail::iallgatherImpl(send, recv, send.nelem(), comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request iallgather(
+    const DenseMatrix<_Val, _trans> &send,
+          DenseMatrix<_Val, _trans> &recv,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(send.isShrunk());
+  mcnla_assert_true(recv.isShrunk());
+  mcnla_assert_eq(send.dim0(),                  recv.dim0());
+  mcnla_assert_eq(send.dim1() * commSize(comm), recv.dim1());
+  return detail::iallgatherImpl(send, recv, send.nelem(), comm);
+}
+//@}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val>
+inline Request iallgather(
+    const DenseVector<_Val> &send,
+          DenseVector<_Val> &&recv,
+    const MPI_Comm comm
+) noexcept {
+  return iallgather(send, recv, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request iallgather(
+    const DenseMatrix<_Val, _trans> &send,
+          DenseMatrix<_Val, _trans> &&recv,
+    const MPI_Comm comm
+) noexcept {
+  return iallgather(send, recv, comm);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace mpi
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_MPI_DENSE_IALLGATHER_HPP_
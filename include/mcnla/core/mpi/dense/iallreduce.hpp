@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/mpi/dense/iallreduce.hpp
+/// @brief   The MPI IALLREDUCE routine.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_MPI_DENSE_IALLREDUCE_HPP_
+#define MCNLA_CORE_MPI_DENSE_IALLREDUCE_HPP_
+
+#include <mcnla/core/mpi/def.hpp>
+#include <mcnla/core/mpi/request.hpp>
+#include <mcnla/core/matrix.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MPI namespace.
+//
+namespace mpi {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace
+//
+namespace detail {
+
+template <typename _Val>
+inline Request iallreduceImpl(
+    const DenseStorage<CpuTag, _Val> &send,
+          DenseStorage<CpuTag, _Val> &recv,
+    const mpi_int_t count,
+    const MPI_Op op,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_mpi_count(count * sizeof(_Val));
+  constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Iallreduce", "mpi", utility::countCommBytes(count * sizeof(_Val)));
+  MPI_Request request;
+  MPI_Iallreduce(send.valPtr(), recv.valPtr(), count, datatype, op, comm, &request);
+  return Request(request);
+}
+
+template <typename _Val>
+inline Request iallreduceImpl(
+          DenseStorage<CpuTag, _Val> &buffer,
+    const mpi_int_t count,
+    const MPI_Op op,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_mpi_count(count * sizeof(_Val));
+  constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Iallreduce", "mpi", utility::countCommBytes(count * sizeof(_Val)));
+  MPI_Request request;
+  MPI_Iallreduce(MPI_IN_PLACE, buffer.valPtr(), count, datatype, op, comm, &request);
+  return Request(request);
+}
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_dense_module
+/// @brief  Combines values from all processes and distributes the result back to all processes (nonblocking version).
+///
+/// @return  The request of the operation.
+///
+/// @attention  The dimensions of @a send and @a recv should be the same for all MPI nodes.
+/// @attention  @a send and @a recv should be shrunk.
+/// @attention  The buffers should not be modified until the request is completed.
+///
+//@{
+template <typename _Val>
+inline Request iallreduce(
+    const DenseVector<_Val> &send,
+          DenseVector<_Val> &recv,
+    const MPI_Op op,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(send.isShrunk());
+  mcnla_assert_true(recv.isShrunk());
+  mcnla_assert_eq(send.dims(), recv.dims());
+  return detail::iallreduceImpl(send, recv, send.nelem(), op, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request iallreduce(
+    const DenseMatrix<_Val, _trans> &send,
+          DenseMatrix<_Val, _trans> &recv,
+    const MPI_Op op,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(send.isShrunk());
+  mcnla_assert_true(recv.isShrunk());
+  mcnla_assert_eq(send.dims(), recv.dims());
+  return detail::iallreduceImpl(send, recv, send.nelem(), op, comm);
+}
+//@}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val>
+inline Request iallreduce(
+    const DenseVector<_Val> &send,
+          DenseVector<_Val> &&recv,
+    const MPI_Op op,
+    const MPI_Comm comm
+) noexcept {
+  return iallreduce(send, recv, op, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request iallreduce(
+    const DenseMatrix<_Val, _trans> &send,
+          DenseMatrix<_Val, _trans> &&recv,
+    const MPI_Op op,
+    const MPI_Comm comm
+) noexcept {
+  return iallreduce(send, recv, op, comm);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_dense_module
+/// @brief  Combines values from all processes and distributes the result back to all processes (in-place nonblocking version).
+///
+/// @return  The request of the operation.
+///
+/// @attention  The dimension of @a buffer should be the same for all MPI nodes.
+/// @attention  @a buffer should be shrunk.
+/// @attention  The buffers should not be modified until the request is completed.
+///
+//@{
+template <typename _Val>
+inline Request iallreduce(
+          DenseVector<_Val> &buffer,
+    const MPI_Op op,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(buffer.isShrunk());
+  return detail::iallreduceImpl(buffer, buffer.nelem(), op, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request iallreduce(
+          DenseMatrix<_Val, _trans> &buffer,
+    const MPI_Op op,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(buffer.isShrunk());
+  return detail::iallreduceImpl(buffer, buffer.nelem(), op, comm);
+}
+//@}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val>
+inline Request iallreduce(
+          DenseVector<_Val> &&buffer,
+    const MPI_Op op,
+    const MPI_Comm comm
+) noexcept {
+  return iallreduce(buffer, op, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request iallreduce(
+          DenseMatrix<_Val, _trans> &&buffer,
+    const MPI_Op op,
+    const MPI_Comm comm
+) noexcept {
+  return iallreduce(buffer, op, comm);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace mpi
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_MPI_DENSE_IALLREDUCE_HPP_
@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/mpi/dense/ialltoall.hpp
+/// @brief   The MPI IALLTOALL routine.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_MPI_DENSE_IALLTOALL_HPP_
+#define MCNLA_CORE_MPI_DENSE_IALLTOALL_HPP_
+
+#include <mcnla/core/mpi/def.hpp>
+#include <mcnla/core/mpi/request.hpp>
+#include <mcnla/core/matrix.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MPI namespace.
+//
+namespace mpi {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace
+//
+namespace detail {
+
+template <typename _Val>
+inline Request ialltoallImpl(
+    const DenseStorage<CpuTag, _Val> &send,
+          DenseStorage<CpuTag, _Val> &recv,
+    const mpi_int_t count,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_mpi_count(count * sizeof(_Val));
+  constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Ialltoall", "mpi", utility::countCommBytes(count * sizeof(_Val)));
+  MPI_Request request;
+  MPI_Ialltoall(send.valPtr(), count, datatype, recv.valPtr(), count, datatype, comm, &request);
+  return Request(request);
+}
+
+template <typename _Val>
+inline Request ialltoallImpl(
+          DenseStorage<CpuTag, _Val> &buffer,
+    const mpi_int_t count,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_mpi_count(count * sizeof(_Val));
+  constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Ialltoall", "mpi", utility::countCommBytes(count * sizeof(_Val)));
+  MPI_Request request;
+  MPI_Ialltoall(MPI_IN_PLACE, count, datatype, buffer.valPtr(), count, datatype, comm, &request);
+  return Request(request);
+}
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_dense_module
+/// @brief  All processes send data to all (nonblocking version).
+///
+/// @return  The request of the operation.
+///
+/// @attention  The dimensions of @a send should be the same for all MPI nodes.
+/// @attention  The dimensions of @a recv should be the same for all MPI nodes.
+/// @attention  @a send and @a recv should be shrunk.
+/// @attention  The buffers should not be modified until the request is completed.
+///
+//@{
+template <typename _Val>
+inline Request ialltoall(
+    const DenseVector<_Val> &send,
+          DenseVector<_Val> &recv,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(send.isShrunk());
+  mcnla_assert_true(recv.isShrunk());
+  mcnla_assert_eq(send.dims(), recv.dims());
+  mcnla_assert_eq(send.dim0() % commSize(comm), 0);
+  return detail::ialltoallImpl(send, recv, send.nelem() / commSize(comm), comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request ialltoall(
+    const DenseMatrix<_Val, _trans> &send,
+          DenseMatrix<_Val, _trans> &recv,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(send.isShrunk());
+  mcnla_assert_true(recv.isShrunk());
+  mcnla_assert_eq(send.dims(), recv.dims());
+  mcnla_assert_eq(send.dim1() % commSize(comm), 0);
+  return detail::ialltoallImpl(send, recv, send.nelem() / commSize(comm), comm);
+}
+//@}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val>
+inline Request ialltoall(
+    const DenseVector<_Val> &send,
+          DenseVector<_Val> &&recv,
+    const MPI_Comm comm
+) noexcept {
+  return ialltoall(send, recv, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request ialltoall(
+    const DenseMatrix<_Val, _trans> &send,
+          DenseMatrix<_Val, _trans> &&recv,
+    const MPI_Comm comm
+) noexcept {
+  return ialltoall(send, recv, comm);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_dense_module
+/// @brief  All processes send data to all (in-place nonblocking version).
+///
+/// @return  The request of the operation.
+///
+/// @attention  The size of @a buffer should be the same for all MPI nodes.
+/// @attention  @a buffer should be shrunk.
+/// @attention  The buffers should not be modified until the request is completed.
+///
+//@{
+template <typename _Val>
+inline Request ialltoall(
+          DenseVector<_Val> &buffer,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(buffer.isShrunk());
+  mcnla_assert_eq(buffer.dim0() % commSize(comm), 0);
+  return detail::ialltoallImpl(buffer, buffer.nelem() / commSize(comm), comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request ialltoall(
+          DenseMatrix<_Val, _trans> &buffer,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(buffer.isShrunk());
+  mcnla_assert_eq(buffer.dim1() % commSize(comm), 0);
+  return detail::ialltoallImpl(buffer, buffer.nelem() / commSize(comm), comm);
+}
+//@}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val>
+inline Request ialltoall(
+          DenseVector<_Val> &&buffer,
+    const MPI_Comm comm
+) noexcept {
+  return ialltoall(buffer, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request ialltoall(
+          DenseMatrix<_Val, _trans> &&buffer,
+    const MPI_Comm comm
+) noexcept {
+  return ialltoall(buffer, comm);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace mpi
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_MPI_DENSE_IALLTOALL_HPP_
@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/mpi/dense/ibcast.hpp
+/// @brief   The MPI IBCAST routine.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_MPI_DENSE_IBCAST_HPP_
+#define MCNLA_CORE_MPI_DENSE_IBCAST_HPP_
+
+#include <mcnla/core/mpi/def.hpp>
+#include <mcnla/core/mpi/request.hpp>
+#include <mcnla/core/matrix.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MPI namespace.
+//
+namespace mpi {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace
+//
+namespace detail {
+
+template <typename _Val>
+inline Request ibcastImpl(
+          DenseStorage<CpuTag, _Val> &buffer,
+    const mpi_int_t count,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_mpi_count(count * sizeof(_Val));
+  constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Ibcast", "mpi", utility::countCommBytes(count * sizeof(_Val)));
+  MPI_Request request;
+  MPI_Ibcast(buffer.valPtr(), count, datatype, root, comm, &request);
+  return Request(request);
+}
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_dense_module
+/// @brief  Broadcasts a message from the process with rank root to all other processes of the group (nonblocking version).
+///
+/// @return  The request of the operation.
+///
+/// @attention  The dimensions of @a buffer should be the same for all MPI nodes.
+/// @attention  @a buffer should be shrunk.
+/// @attention  The buffers should not be modified until the request is completed.
+///
+//@{
+template <typename _Val>
+inline Request ibcast(
+          DenseVector<_Val> &buffer,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(buffer.isShrunk());
+  return detail::ibcastImpl(buffer, buffer.nelem(), root, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request ibcast(
+          DenseMatrix<_Val, _trans> &buffer,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(buffer.isShrunk());
+  return detail::ibcastImpl(buffer, buffer.nelem(), root, comm);
+}
+//@}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val>
+inline Request ibcast(
+          DenseVector<_Val> &&buffer,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  return ibcast(buffer, root, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request ibcast(
+          DenseMatrix<_Val, _trans> &&buffer,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  return ibcast(buffer, root, comm);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace mpi
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_MPI_DENSE_IBCAST_HPP_
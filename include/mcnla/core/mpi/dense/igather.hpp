@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/mpi/dense/igather.hpp
+/// @brief   The MPI IGATHER routine.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_MPI_DENSE_IGATHER_HPP_
+#define MCNLA_CORE_MPI_DENSE_IGATHER_HPP_
+
+#include <mcnla/core/mpi/def.hpp>
+#include <mcnla/core/mpi/request.hpp>
+#include <mcnla/core/matrix.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MPI namespace.
+//
+namespace mpi {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace
+//
+namespace detail {
+
+template <typename _Val>
+inline Request igatherImpl(
+    const DenseStorage<CpuTag, _Val> &send,
+          DenseStorage<CpuTag, _Val> &recv,
+    const mpi_int_t count,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_mpi_count(count * commSize(comm) * sizeof(_Val));
+  constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Igather", "mpi", utility::countCommBytes(count * commSize(comm) * sizeof(_Val)));
+  MPI_Request request;
+  MPI_Igather(send.valPtr(), count, datatype, recv.valPtr(), count, datatype, root, comm, &request);
+  return Request(request);
+}
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_dense_module
+/// @brief  Gathers values from a group of processes (nonblocking version).
+///
+/// @return  The request of the operation.
+///
+/// @attention  The dimensions of @a send should be the same for all MPI nodes.
+/// @attention  @a send and @a recv should be shrunk.
+/// @attention  The buffers should not be modified until the request is completed.
+///
+//@{
+template <typename _Val>
+inline Request igather(
+    const DenseVector<_Val> &send,
+          DenseVector<_Val> &recv,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(send.isShrunk());
+  mcnla_assert_true(recv.isShrunk());
+  if ( isCommRoot(root, comm) ) {
+    mcnla_assert_eq(send.dim0() * commSize(comm), recv.dim0());
+  }
+  return detail::igatherImpl(send, recv, send.nelem(), root, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request igather(
+    const DenseMatrix<_Val, _trans> &send,
+          DenseMatrix<_Val, _trans> &recv,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(send.isShrunk());
+  mcnla_assert_true(recv.isShrunk());
+  if ( isCommRoot(root, comm) ) {
+    mcnla_assert_eq(send.dim0(),                  recv.dim0());
+    mcnla_assert_eq(send.dim1() * commSize(comm), recv.dim1());
+  }
+  return detail::igatherImpl(send, recv, send.nelem(), root, comm);
+}
+//@}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val>
+inline Request igather(
+    const DenseVector<_Val> &send,
+          DenseVector<_Val> &&recv,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  return igather(send, recv, root, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request igather(
+    const DenseMatrix<_Val, _trans> &send,
+          DenseMatrix<_Val, _trans> &&recv,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  return igather(send, recv, root, comm);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace mpi
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_MPI_DENSE_IGATHER_HPP_
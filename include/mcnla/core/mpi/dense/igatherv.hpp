@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/mpi/dense/igatherv.hpp
+/// @brief   The MPI IGATHERV routine.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_MPI_DENSE_IGATHERV_HPP_
+#define MCNLA_CORE_MPI_DENSE_IGATHERV_HPP_
+
+#include <mcnla/core/mpi/def.hpp>
+#include <mcnla/core/mpi/request.hpp>
+#include <mcnla/core/matrix.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MPI namespace.
+//
+namespace mpi {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace
+//
+namespace detail {
+
+template <typename _Val>
+inline Request igathervImpl(
+    const DenseStorage<CpuTag, _Val> &send,
+          DenseStorage<CpuTag, _Val> &recv,
+    const mpi_int_t sendcount,
+    const mpi_int_t *recvcounts,
+    const mpi_int_t *displs,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_mpi_count(sendcount * sizeof(_Val));
+  constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Igatherv", "mpi", utility::countCommBytes(sendcount * sizeof(_Val)));
+  MPI_Request request;
+  MPI_Igatherv(send.valPtr(), sendcount, datatype, recv.valPtr(), recvcounts, displs, datatype, root, comm, &request);
+  return Request(request);
+}
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_dense_module
+/// @brief  Gathers into specified locations from all processes in a group (nonblocking version).
+///
+/// @return  The request of the operation.
+///
+/// @attention  @a send and @a recv should be shrunk.
+/// @attention  The buffers should not be modified until the request is completed.
+/// @attention  @a recvcounts and @a displs should not be released until the request is completed.
+///
+//@{
+template <typename _Val>
+inline Request igatherv(
+    const DenseVector<_Val> &send,
+          DenseVector<_Val> &recv,
+    const mpi_int_t *recvcounts,
+    const mpi_int_t *displs,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(send.isShrunk());
+  mcnla_assert_true(recv.isShrunk());
+  return detail::igathervImpl(send, recv, send.nelem(), recvcounts, displs, root, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request igatherv(
+    const DenseMatrix<_Val, _trans> &send,
+          DenseMatrix<_Val, _trans> &recv,
+    const mpi_int_t *recvcounts,
+    const mpi_int_t *displs,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(send.isShrunk());
+  mcnla_assert_true(recv.isShrunk());
+  return detail::igathervImpl(send, recv, send.nelem(), recvcounts, displs, root, comm);
+}
+//@}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val>
+inline Request igatherv(
+    const DenseVector<_Val> &send,
+          DenseVector<_Val> &&recv,
+    const mpi_int_t *recvcounts,
+    const mpi_int_t *displs,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  return igatherv(send, recv, recvcounts, displs, root, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request igatherv(
+    const DenseMatrix<_Val, _trans> &send,
+          DenseMatrix<_Val, _trans> &&recv,
+    const mpi_int_t *recvcounts,
+    const mpi_int_t *displs,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  return igatherv(send, recv, recvcounts, displs, root, comm);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace mpi
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_MPI_DENSE_IGATHERV_HPP_
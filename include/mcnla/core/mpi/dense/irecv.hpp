@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/mpi/dense/irecv.hpp
+/// @brief   The MPI IRECV routine.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_MPI_DENSE_IRECV_HPP_
+#define MCNLA_CORE_MPI_DENSE_IRECV_HPP_
+
+#include <mcnla/core/mpi/def.hpp>
+#include <mcnla/core/mpi/request.hpp>
+#include <mcnla/core/matrix.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MPI namespace.
+//
+namespace mpi {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace
+//
+namespace detail {
+
+template <typename _Val>
+inline Request irecvImpl(
+          DenseStorage<CpuTag, _Val> &buffer,
+    const mpi_int_t count,
+    const mpi_int_t source,
+    const mpi_int_t tag,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_mpi_count(count * sizeof(_Val));
+  constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Irecv", "mpi", utility::countCommBytes(count * sizeof(_Val)));
+  MPI_Request request;
+  MPI_Irecv(buffer.valPtr(), count, datatype, source, tag, comm, &request);
+  return Request(request);
+}
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_dense_module
+/// @brief  Nonblocking receive for a message.
+///
+/// @return  The request of the operation. The status is returned by Request::wait.
+///
+/// @attention  @a buffer should be shrunk.
+/// @attention  The buffers should not be accessed until the request is completed.
+///
+//@{
+template <typename _Val>
+inline Request irecv(
+          DenseVector<_Val> &buffer,
+    const mpi_int_t source,
+    const mpi_int_t tag,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(buffer.isShrunk());
+  return detail::irecvImpl(buffer, buffer.nelem(), source, tag, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request irecv(
+          DenseMatrix<_Val, _trans> &buffer,
+    const mpi_int_t source,
+    const mpi_int_t tag,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(buffer.isShrunk());
+  return detail::irecvImpl(buffer, buffer.nelem(), source, tag, comm);
+}
+//@}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val>
+inline Request irecv(
+          DenseVector<_Val> &&buffer,
+    const mpi_int_t source,
+    const mpi_int_t tag,
+    const MPI_Comm comm
+) noexcept {
+  return irecv(buffer, source, tag, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request irecv(
+          DenseMatrix<_Val, _trans> &&buffer,
+    const mpi_int_t source,
+    const mpi_int_t tag,
+    const MPI_Comm comm
+) noexcept {
+  return irecv(buffer, source, tag, comm);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace mpi
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_MPI_DENSE_IRECV_HPP_
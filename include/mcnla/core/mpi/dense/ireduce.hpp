@@ -0,0 +1,193 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/mpi/dense/ireduce.hpp
+/// @brief   The MPI IREDUCE routine.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_MPI_DENSE_IREDUCE_HPP_
+#define MCNLA_CORE_MPI_DENSE_IREDUCE_HPP_
+
+#include <mcnla/core/mpi/def.hpp>
+#include <mcnla/core/mpi/request.hpp>
+#include <mcnla/core/matrix.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MPI namespace.
+//
+namespace mpi {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace
+//
+namespace detail {
+
+template <typename _Val>
+inline Request ireduceImpl(
+    const DenseStorage<CpuTag, _Val> &send,
+          DenseStorage<CpuTag, _Val> &recv,
+    const mpi_int_t count,
+    const MPI_Op op,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_mpi_count(count * sizeof(_Val));
+  constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Ireduce", "mpi", utility::countCommBytes(count * sizeof(_Val)));
+  MPI_Request request;
+  MPI_Ireduce(send.valPtr(), recv.valPtr(), count, datatype, op, root, comm, &request);
+  return Request(request);
+}
+
+template <typename _Val>
+inline Request ireduceImpl(
+          DenseStorage<CpuTag, _Val> &buffer,
+    const mpi_int_t count,
+    const MPI_Op op,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_mpi_count(count * sizeof(_Val));
+  constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Ireduce", "mpi", utility::countCommBytes(count * sizeof(_Val)));
+  MPI_Request request;
+  if ( isCommRoot(root, comm) ) {
+    MPI_Ireduce(MPI_IN_PLACE, buffer.valPtr(), count, datatype, op, root, comm, &request);
+  } else {
+    MPI_Ireduce(buffer.valPtr(), buffer.valPtr(), count, datatype, op, root, comm, &request);
+  }
+  return Request(request);
+}
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_dense_module
+/// @brief  Reduces values on all processes within a group (nonblocking version).
+///
+/// @return  The request of the operation.
+///
+/// @attention  The dimensions of @a send should be the same for all MPI nodes.
+/// @attention  @a send and @a recv should be shrunk.
+/// @attention  The buffers should not be modified until the request is completed.
+///
+//@{
+template <typename _Val>
+inline Request ireduce(
+    const DenseVector<_Val> &send,
+          DenseVector<_Val> &recv,
+    const MPI_Op op,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(send.isShrunk());
+  mcnla_assert_true(recv.isShrunk());
+  mcnla_assert_eq(send.dims(), recv.dims());
+  return detail::ireduceImpl(send, recv, send.nelem(), op, root, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request ireduce(
+    const DenseMatrix<_Val, _trans> &send,
+          DenseMatrix<_Val, _trans> &recv,
+    const MPI_Op op,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(send.isShrunk());
+  mcnla_assert_true(recv.isShrunk());
+  mcnla_assert_eq(send.dims(), recv.dims());
+  return detail::ireduceImpl(send, recv, send.nelem(), op, root, comm);
+}
+//@}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val>
+inline Request ireduce(
+    const DenseVector<_Val> &send,
+          DenseVector<_Val> &&recv,
+    const MPI_Op op,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  return ireduce(send, recv, op, root, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request ireduce(
+    const DenseMatrix<_Val, _trans> &send,
+          DenseMatrix<_Val, _trans> &&recv,
+    const MPI_Op op,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  return ireduce(send, recv, op, root, comm);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_dense_module
+/// @brief  Reduces values on all processes within a group (in-place nonblocking version).
+///
+/// @return  The request of the operation.
+///
+/// @attention  The dimensions of @a buffer should be the same for all MPI nodes.
+/// @attention  @a buffer should be shrunk.
+/// @attention  The buffers should not be modified until the request is completed.
+///
+//@{
+template <typename _Val>
+inline Request ireduce(
+          DenseVector<_Val> &buffer,
+    const MPI_Op op,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(buffer.isShrunk());
+  return detail::ireduceImpl(buffer, buffer.nelem(), op, root, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request ireduce(
+          DenseMatrix<_Val, _trans> &buffer,
+    const MPI_Op op,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(buffer.isShrunk());
+  return detail::ireduceImpl(buffer, buffer.nelem(), op, root, comm);
+}
+//@}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val>
+inline Request ireduce(
+          DenseVector<_Val> &&buffer,
+    const MPI_Op op,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  return ireduce(buffer, op, root, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request ireduce(
+          DenseMatrix<_Val, _trans> &&buffer,
+    const MPI_Op op,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  return ireduce(buffer, op, root, comm);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace mpi
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_MPI_DENSE_IREDUCE_HPP_
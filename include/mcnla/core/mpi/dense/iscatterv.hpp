@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/mpi/dense/iscatterv.hpp
+/// @brief   The MPI ISCATTERV routine.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_MPI_DENSE_ISCATTERV_HPP_
+#define MCNLA_CORE_MPI_DENSE_ISCATTERV_HPP_
+
+#include <mcnla/core/mpi/def.hpp>
+#include <mcnla/core/mpi/request.hpp>
+#include <mcnla/core/matrix.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MPI namespace.
+//
+namespace mpi {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace
+//
+namespace detail {
+
+template <typename _Val>
+inline Request iscattervImpl(
+    const DenseStorage<CpuTag, _Val> &send,
+          DenseStorage<CpuTag, _Val> &recv,
+    const mpi_int_t *sendcounts,
+    const mpi_int_t *displs,
+    const mpi_int_t recvcount,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_mpi_count(recvcount * sizeof(_Val));
+  constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Iscatterv", "mpi", utility::countCommBytes(recvcount * sizeof(_Val)));
+  MPI_Request request;
+  MPI_Iscatterv(send.valPtr(), sendcounts, displs, datatype, recv.valPtr(), recvcount, datatype, root, comm, &request);
+  return Request(request);
+}
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_dense_module
+/// @brief  Scatters a buffer in parts to all processes in a communicator (nonblocking version).
+///
+/// @return  The request of the operation.
+///
+/// @attention  @a send and @a recv should be shrunk.
+/// @attention  The buffers should not be modified until the request is completed.
+/// @attention  @a sendcounts and @a displs should not be released until the request is completed.
+///
+//@{
+template <typename _Val>
+inline Request iscatterv(
+    const DenseVector<_Val> &send,
+          DenseVector<_Val> &recv,
+    const mpi_int_t *sendcounts,
+    const mpi_int_t *displs,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(send.isShrunk());
+  mcnla_assert_true(recv.isShrunk());
+  return detail::iscattervImpl(send, recv, sendcounts, displs, recv.nelem(), root, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request iscatterv(
+    const DenseMatrix<_Val, _trans> &send,
+          DenseMatrix<_Val, _trans> &recv,
+    const mpi_int_t *sendcounts,
+    const mpi_int_t *displs,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(send.isShrunk());
+  mcnla_assert_true(recv.isShrunk());
+  return detail::iscattervImpl(send, recv, sendcounts, displs, recv.nelem(), root, comm);
+}
+//@}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val>
+inline Request iscatterv(
+    const DenseVector<_Val> &send,
+          DenseVector<_Val> &&recv,
+    const mpi_int_t *sendcounts,
+    const mpi_int_t *displs,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  return iscatterv(send, recv, sendcounts, displs, root, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request iscatterv(
+    const DenseMatrix<_Val, _trans> &send,
+          DenseMatrix<_Val, _trans> &&recv,
+    const mpi_int_t *sendcounts,
+    const mpi_int_t *displs,
+    const mpi_int_t root,
+    const MPI_Comm comm
+) noexcept {
+  return iscatterv(send, recv, sendcounts, displs, root, comm);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace mpi
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_MPI_DENSE_ISCATTERV_HPP_
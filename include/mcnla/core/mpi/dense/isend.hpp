@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/mpi/dense/isend.hpp
+/// @brief   The MPI ISEND routine.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_MPI_DENSE_ISEND_HPP_
+#define MCNLA_CORE_MPI_DENSE_ISEND_HPP_
+
+#include <mcnla/core/mpi/def.hpp>
+#include <mcnla/core/mpi/request.hpp>
+#include <mcnla/core/matrix.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MPI namespace.
+//
+namespace mpi {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace
+//
+namespace detail {
+
+template <typename _Val>
+inline Request isendImpl(
+    const DenseStorage<CpuTag, _Val> &buffer,
+    const mpi_int_t count,
+    const mpi_int_t dest,
+    const mpi_int_t tag,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_mpi_count(count * sizeof(_Val));
+  constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Isend", "mpi", utility::countCommBytes(count * sizeof(_Val)));
+  MPI_Request request;
+  MPI_Isend(buffer.valPtr(), count, datatype, dest, tag, comm, &request);
+  return Request(request);
+}
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_dense_module
+/// @brief  Performs a nonblocking send.
+///
+/// @return  The request of the operation.
+///
+/// @attention  @a buffer should be shrunk.
+/// @attention  The buffers should not be modified until the request is completed.
+///
+//@{
+template <typename _Val>
+inline Request isend(
+    const DenseVector<_Val> &buffer,
+    const mpi_int_t dest,
+    const mpi_int_t tag,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(buffer.isShrunk());
+  return detail::isendImpl(buffer, buffer.nelem(), dest, tag, comm);
+}
+
+template <typename _Val, Trans _trans>
+inline Request isend(
+    const DenseMatrix<_Val, _trans> &buffer,
+    const mpi_int_t dest,
+    const mpi_int_t tag,
+    const MPI_Comm comm
+) noexcept {
+  mcnla_assert_true(buffer.isShrunk());
+  return detail::isendImpl(buffer, buffer.nelem(), dest, tag, comm);
+}
+//@}
+
+}  // namespace mpi
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_MPI_DENSE_ISEND_HPP_
@@ -37,6 +37,7 @@ inline void recvImpl(
 ) noexcept {
   mcnla_assert_mpi_count(count * sizeof(_Val));
   constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Recv", "mpi", utility::countCommBytes(count * sizeof(_Val)));
   MPI_Recv(buffer.valPtr(), count, datatype, source, tag, comm, &status);
 }
 
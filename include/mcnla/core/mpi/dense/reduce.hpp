@@ -37,6 +37,7 @@ inline void reduceImpl(
 ) noexcept {
   mcnla_assert_mpi_count(count * sizeof(_Val));
   constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Reduce", "mpi", utility::countCommBytes(count * sizeof(_Val)));
   MPI_Reduce(send.valPtr(), recv.valPtr(), count, datatype, op, root, comm);
 }
 
@@ -50,6 +51,7 @@ inline void reduceImpl(
 ) noexcept {
   mcnla_assert_mpi_count(count * sizeof(_Val));
   constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Reduce", "mpi", utility::countCommBytes(count * sizeof(_Val)));
   if ( isCommRoot(root, comm) ) {
     MPI_Reduce(MPI_IN_PLACE, buffer.valPtr(), count, datatype, op, root, comm);
   } else {
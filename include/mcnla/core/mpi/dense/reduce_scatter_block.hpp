@@ -38,6 +38,7 @@ inline void reduceScatterBlockImpl(
 ) noexcept {
   mcnla_assert_mpi_count(count * commSize(comm) * sizeof(_Val));
   constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Reduce_scatter_block", "mpi", utility::countCommBytes(count * commSize(comm) * sizeof(_Val)));
   MPI_Reduce_scatter_block(send.valPtr(), recv.valPtr(), count, datatype, op, comm);
 }
 
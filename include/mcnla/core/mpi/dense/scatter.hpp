@@ -36,6 +36,7 @@ inline void scatterImpl(
 ) noexcept {
   mcnla_assert_mpi_count(count * commSize(comm) * sizeof(_Val));
   constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Scatter", "mpi", utility::countCommBytes(count * commSize(comm) * sizeof(_Val)));
   MPI_Scatter(send.valPtr(), count, datatype, recv.valPtr(), count, datatype, root, comm);
 }
 
@@ -38,6 +38,7 @@ inline void scattervImpl(
 ) noexcept {
   mcnla_assert_mpi_count(recvcount * sizeof(_Val));
   constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Scatterv", "mpi", utility::countCommBytes(recvcount * sizeof(_Val)));
   MPI_Scatterv(send.valPtr(), sendcounts, displs, datatype, recv.valPtr(), recvcount, datatype, root, comm);
 }
 
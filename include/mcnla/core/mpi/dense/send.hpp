@@ -36,6 +36,7 @@ inline void sendImpl(
 ) noexcept {
   mcnla_assert_mpi_count(count * sizeof(_Val));
   constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+  utility::TraceSpan span("MPI_Send", "mpi", utility::countCommBytes(count * sizeof(_Val)));
   MPI_Send(buffer.valPtr(), count, datatype, dest, tag, comm);
 }
 
@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/mpi/hierarchical_comm.hh
+/// @brief   The definition of MPI hierarchical communicator.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_MPI_HIERARCHICAL_COMM_HH_
+#define MCNLA_CORE_MPI_HIERARCHICAL_COMM_HH_
+
+#include <mcnla/core/mpi/def.hpp>
+#include <mcnla/core/matrix.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MPI namespace.
+//
+namespace mpi {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_module
+/// The two-level (node / leader) MPI communicator.
+///
+/// The processes sharing a node are grouped into a node communicator, and the first process of each node joins the leader
+/// communicator. Reductions are combined through an MPI-3 shared-memory window inside each node, and only the leaders
+/// communicate across nodes.
+///
+/// @note  The communicator is move-only.
+///
+class HierarchicalComm {
+
+ protected:
+
+  /// The node communicator.
+  MPI_Comm node_comm_;
+
+  /// The leader communicator (@c MPI_COMM_NULL on non-leader processes).
+  MPI_Comm leader_comm_;
+
+  /// The shared-memory window.
+  MPI_Win win_;
+
+  /// The base pointer of the shared-memory window.
+  void *base_;
+
+  /// The capacity of the shared-memory window in bytes.
+  MPI_Aint capacity_;
+
+ public:
+
+  // Constructors
+  inline HierarchicalComm() noexcept;
+  inline HierarchicalComm( const MPI_Comm comm ) noexcept;
+  inline HierarchicalComm( const HierarchicalComm &other ) noexcept = delete;
+  inline HierarchicalComm( HierarchicalComm &&other ) noexcept;
+
+  // Operators
+  inline HierarchicalComm& operator=( const HierarchicalComm &other ) noexcept = delete;
+  inline HierarchicalComm& operator=( HierarchicalComm &&other ) noexcept;
+
+  // Destructor
+  inline ~HierarchicalComm() noexcept;
+
+  // Gets information
+  inline bool     isNull() const noexcept;
+  inline bool     isLeader() const noexcept;
+  inline MPI_Comm nodeComm() const noexcept;
+  inline MPI_Comm leaderComm() const noexcept;
+
+  // Communicates
+  template <typename _Val>
+  inline void allreduce( DenseVector<_Val> &buffer, const MPI_Op op ) noexcept;
+  template <typename _Val, Trans _trans>
+  inline void allreduce( DenseMatrix<_Val, _trans> &buffer, const MPI_Op op ) noexcept;
+  template <typename _Val>
+  inline void allreduce( DenseVector<_Val> &&buffer, const MPI_Op op ) noexcept;
+  template <typename _Val, Trans _trans>
+  inline void allreduce( DenseMatrix<_Val, _trans> &&buffer, const MPI_Op op ) noexcept;
+
+ protected:
+
+  // Communicates
+  template <typename _Val>
+  inline void allreduceImpl( _Val *ptr, const index_t count, const MPI_Op op ) noexcept;
+
+  // Manages the window
+  inline void reserve( const MPI_Aint size ) noexcept;
+  inline void sync() noexcept;
+  inline void release() noexcept;
+
+};
+
+}  // namespace mpi
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_MPI_HIERARCHICAL_COMM_HH_
@@ -0,0 +1,289 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/mpi/hierarchical_comm.hpp
+/// @brief   The MPI hierarchical communicator.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_MPI_HIERARCHICAL_COMM_HPP_
+#define MCNLA_CORE_MPI_HIERARCHICAL_COMM_HPP_
+
+#include <mcnla/core/mpi/hierarchical_comm.hh>
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MPI namespace.
+//
+namespace mpi {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Default constructor.
+///
+HierarchicalComm::HierarchicalComm() noexcept
+  : node_comm_(MPI_COMM_NULL),
+    leader_comm_(MPI_COMM_NULL),
+    win_(MPI_WIN_NULL),
+    base_(nullptr),
+    capacity_(0) {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Construct from a communicator.
+///
+/// @attention  This routine is collective over @a comm.
+///
+HierarchicalComm::HierarchicalComm(
+    const MPI_Comm comm
+) noexcept
+  : HierarchicalComm() {
+  const auto rank = commRank(comm);
+  mcnla_assert_pass(MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &node_comm_));
+  mcnla_assert_pass(MPI_Comm_split(comm, (commRank(node_comm_) == 0) ? 0 : MPI_UNDEFINED, rank, &leader_comm_));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Move constructor.
+///
+HierarchicalComm::HierarchicalComm(
+    HierarchicalComm &&other
+) noexcept
+  : node_comm_(other.node_comm_),
+    leader_comm_(other.leader_comm_),
+    win_(other.win_),
+    base_(other.base_),
+    capacity_(other.capacity_) {
+  other.node_comm_   = MPI_COMM_NULL;
+  other.leader_comm_ = MPI_COMM_NULL;
+  other.win_         = MPI_WIN_NULL;
+  other.base_        = nullptr;
+  other.capacity_    = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Move assignment.
+///
+HierarchicalComm& HierarchicalComm::operator=(
+    HierarchicalComm &&other
+) noexcept {
+  if ( this != &other ) {
+    release();
+    node_comm_   = other.node_comm_;
+    leader_comm_ = other.leader_comm_;
+    win_         = other.win_;
+    base_        = other.base_;
+    capacity_    = other.capacity_;
+    other.node_comm_   = MPI_COMM_NULL;
+    other.leader_comm_ = MPI_COMM_NULL;
+    other.win_         = MPI_WIN_NULL;
+    other.base_        = nullptr;
+    other.capacity_    = 0;
+  }
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Default destructor.
+///
+HierarchicalComm::~HierarchicalComm() noexcept {
+  release();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Determines if the communicator is null.
+///
+bool HierarchicalComm::isNull() const noexcept {
+  return (node_comm_ == MPI_COMM_NULL);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Determines if this process is the leader of its node.
+///
+bool HierarchicalComm::isLeader() const noexcept {
+  return (leader_comm_ != MPI_COMM_NULL);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the node communicator.
+///
+MPI_Comm HierarchicalComm::nodeComm() const noexcept {
+  return node_comm_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the leader communicator (@c MPI_COMM_NULL on non-leader processes).
+///
+MPI_Comm HierarchicalComm::leaderComm() const noexcept {
+  return leader_comm_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Combines values from all processes and distributes the result back to all processes (in-place version).
+///
+/// @attention  The dimension of @a buffer should be the same for all MPI nodes.
+/// @attention  @a buffer should be shrunk.
+/// @attention  Only @c MPI_SUM is supported.
+/// @attention  This routine is collective over the original communicator.
+///
+//@{
+template <typename _Val>
+void HierarchicalComm::allreduce(
+          DenseVector<_Val> &buffer,
+    const MPI_Op op
+) noexcept {
+  mcnla_assert_true(buffer.isShrunk());
+  allreduceImpl(buffer.valPtr(), buffer.nelem(), op);
+}
+
+template <typename _Val, Trans _trans>
+void HierarchicalComm::allreduce(
+          DenseMatrix<_Val, _trans> &buffer,
+    const MPI_Op op
+) noexcept {
+  mcnla_assert_true(buffer.isShrunk());
+  allreduceImpl(buffer.valPtr(), buffer.nelem(), op);
+}
+//@}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val>
+void HierarchicalComm::allreduce(
+          DenseVector<_Val> &&buffer,
+    const MPI_Op op
+) noexcept {
+  allreduce(buffer, op);
+}
+
+template <typename _Val, Trans _trans>
+void HierarchicalComm::allreduce(
+          DenseMatrix<_Val, _trans> &&buffer,
+    const MPI_Op op
+) noexcept {
+  allreduce(buffer, op);
+}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Combines values from all processes and distributes the result back to all processes.
+///
+/// The window holds one slot per process of the node followed by a result slot. Each process copies its data into its
+/// slot, and sums a segment of all slots into the result slot. The leaders then reduce the result slots across nodes, and
+/// each process copies the result back.
+///
+template <typename _Val>
+void HierarchicalComm::allreduceImpl(
+          _Val *ptr,
+    const index_t count,
+    const MPI_Op op
+) noexcept {
+  mcnla_assert_false(isNull());
+  mcnla_assert_true(op == MPI_SUM);
+  mcnla_assert_mpi_count(count * sizeof(_Val));
+  static_cast<void>(op);
+
+  constexpr const MPI_Datatype datatype = traits::MpiValTraits<_Val>::datatype;
+
+  const auto node_size = commSize(node_comm_);
+  const auto node_rank = commRank(node_comm_);
+
+  reserve((node_size+1) * count * sizeof(_Val));
+  auto slots  = static_cast<_Val*>(base_);
+  auto result = slots + node_size * count;
+
+  // Copy to slot
+  std::copy(ptr, ptr + count, slots + node_rank * count);
+  sync();
+
+  // Sum the segment of slots
+  const index_t begin = count * node_rank / node_size, end = count * (node_rank+1) / node_size;
+  std::copy(slots + begin, slots + end, result + begin);
+  for ( mpi_int_t k = 1; k < node_size; ++k ) {
+    for ( index_t i = begin; i < end; ++i ) {
+      result[i] += slots[k * count + i];
+    }
+  }
+  sync();
+
+  // Reduce across nodes
+  if ( isLeader() && commSize(leader_comm_) > 1 ) {
+    mcnla_assert_pass(MPI_Allreduce(MPI_IN_PLACE, result, count, datatype, op, leader_comm_));
+  }
+  sync();
+
+  // Copy from result
+  std::copy(result, result + count, ptr);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Reserves the shared-memory window.
+///
+/// @attention  This routine is collective over the node communicator.
+///
+void HierarchicalComm::reserve(
+    const MPI_Aint size
+) noexcept {
+  if ( size <= capacity_ ) {
+    return;
+  }
+
+  if ( win_ != MPI_WIN_NULL ) {
+    mcnla_assert_pass(MPI_Win_unlock_all(win_));
+    mcnla_assert_pass(MPI_Win_free(&win_));
+  }
+
+  // Allocate the whole window on the leader
+  const auto node_rank = commRank(node_comm_);
+  mcnla_assert_pass(MPI_Win_allocate_shared((node_rank == 0) ? size : 0, 1, MPI_INFO_NULL, node_comm_, &base_, &win_));
+  if ( node_rank != 0 ) {
+    MPI_Aint win_size;
+    int disp_unit;
+    mcnla_assert_pass(MPI_Win_shared_query(win_, 0, &win_size, &disp_unit, &base_));
+  }
+  mcnla_assert_pass(MPI_Win_lock_all(MPI_MODE_NOCHECK, win_));
+  capacity_ = size;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Synchronizes the shared-memory window among the node.
+///
+void HierarchicalComm::sync() noexcept {
+  mcnla_assert_pass(MPI_Win_sync(win_));
+  mcnla_assert_pass(MPI_Barrier(node_comm_));
+  mcnla_assert_pass(MPI_Win_sync(win_));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Releases the communicators and the window.
+///
+/// @note  Nothing is released if MPI is already finalized.
+///
+void HierarchicalComm::release() noexcept {
+  int finalized;
+  MPI_Finalized(&finalized);
+  if ( !finalized ) {
+    if ( win_ != MPI_WIN_NULL ) {
+      MPI_Win_unlock_all(win_);
+      MPI_Win_free(&win_);
+    }
+    if ( leader_comm_ != MPI_COMM_NULL ) {
+      MPI_Comm_free(&leader_comm_);
+    }
+    if ( node_comm_ != MPI_COMM_NULL ) {
+      MPI_Comm_free(&node_comm_);
+    }
+  }
+  node_comm_   = MPI_COMM_NULL;
+  leader_comm_ = MPI_COMM_NULL;
+  win_         = MPI_WIN_NULL;
+  base_        = nullptr;
+  capacity_    = 0;
+}
+
+}  // namespace mpi
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_MPI_HIERARCHICAL_COMM_HPP_
@@ -0,0 +1,72 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/mpi/request.hh
+/// @brief   The definition of MPI request.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_MPI_REQUEST_HH_
+#define MCNLA_CORE_MPI_REQUEST_HH_
+
+#include <mcnla/core/mpi/def.hpp>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MPI namespace.
+//
+namespace mpi {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_module
+/// The handle of a nonblocking MPI operation.
+///
+/// @note  The request is move-only. A pending request is completed on destruction.
+///
+class Request {
+
+ protected:
+
+  /// The raw MPI request.
+  MPI_Request request_;
+
+ public:
+
+  // Constructors
+  inline Request() noexcept;
+  inline Request( const MPI_Request request ) noexcept;
+  inline Request( const Request &other ) noexcept = delete;
+  inline Request( Request &&other ) noexcept;
+
+  // Operators
+  inline Request& operator=( const Request &other ) noexcept = delete;
+  inline Request& operator=( Request &&other ) noexcept;
+
+  // Destructor
+  inline ~Request() noexcept;
+
+  // Gets information
+  inline bool isNull() const noexcept;
+
+  // Completes
+  inline MPI_Status wait() noexcept;
+  inline bool test() noexcept;
+
+};
+
+// Completes
+static inline void waitAll( std::vector<Request> &requests ) noexcept;
+static inline bool testAll( std::vector<Request> &requests ) noexcept;
+static inline mpi_int_t waitSome( std::vector<Request> &requests, std::vector<mpi_int_t> &indices ) noexcept;
+template <class ..._Requests>
+static inline void waitAll( Request &request, _Requests &...requests ) noexcept;
+
+}  // namespace mpi
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_MPI_REQUEST_HH_
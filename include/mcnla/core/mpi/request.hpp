@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/mpi/request.hpp
+/// @brief   The MPI request.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_MPI_REQUEST_HPP_
+#define MCNLA_CORE_MPI_REQUEST_HPP_
+
+#include <mcnla/core/mpi/request.hh>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MPI namespace.
+//
+namespace mpi {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Default constructor.
+///
+Request::Request() noexcept
+  : request_(MPI_REQUEST_NULL) {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Construct from raw MPI request.
+///
+Request::Request(
+    const MPI_Request request
+) noexcept
+  : request_(request) {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Move constructor.
+///
+Request::Request(
+    Request &&other
+) noexcept
+  : request_(other.request_) {
+  other.request_ = MPI_REQUEST_NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Move assignment.
+///
+/// @note  The current request is completed before taking over @a other.
+///
+Request& Request::operator=(
+    Request &&other
+) noexcept {
+  if ( this != &other ) {
+    wait();
+    request_ = other.request_;
+    other.request_ = MPI_REQUEST_NULL;
+  }
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Default destructor.
+///
+/// @note  Blocks until the request is completed.
+///
+Request::~Request() noexcept {
+  wait();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Determines if the request is null (i.e. completed or never started).
+///
+bool Request::isNull() const noexcept {
+  return (request_ == MPI_REQUEST_NULL);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Waits for the request to complete.
+///
+/// @return  The status of the completed operation.
+///
+MPI_Status Request::wait() noexcept {
+  MPI_Status status{};
+  if ( !isNull() ) {
+    utility::TraceSpan span("MPI_Wait", "mpi");
+    mcnla_assert_pass(MPI_Wait(&request_, &status));
+  }
+  return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Tests for the completion of the request.
+///
+/// @return  @c true if the request is completed.
+///
+bool Request::test() noexcept {
+  if ( isNull() ) {
+    return true;
+  }
+  int flag;
+  mcnla_assert_pass(MPI_Test(&request_, &flag, MPI_STATUS_IGNORE));
+  return flag;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_module
+/// @brief  Waits for all given requests to complete.
+///
+static inline void waitAll(
+    std::vector<Request> &requests
+) noexcept {
+  static_assert(sizeof(Request) == sizeof(MPI_Request), "Request must be layout-compatible with MPI_Request!");
+  utility::TraceSpan span("MPI_Waitall", "mpi");
+  mcnla_assert_pass(MPI_Waitall(requests.size(), reinterpret_cast<MPI_Request*>(requests.data()), MPI_STATUSES_IGNORE));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_module
+/// @brief  Tests for the completion of all given requests.
+///
+/// @return  @c true if all the requests are completed.
+///
+static inline bool testAll(
+    std::vector<Request> &requests
+) noexcept {
+  static_assert(sizeof(Request) == sizeof(MPI_Request), "Request must be layout-compatible with MPI_Request!");
+  int flag;
+  mcnla_assert_pass(MPI_Testall(requests.size(), reinterpret_cast<MPI_Request*>(requests.data()), &flag,
+                                MPI_STATUSES_IGNORE));
+  return flag;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_module
+/// @brief  Waits for some given requests to complete.
+///
+/// @param  requests  The requests.
+/// @param  indices   The indices of the completed requests (resized to the number of completed requests).
+///
+/// @return  The number of completed requests (zero if all the requests are null).
+///
+static inline mpi_int_t waitSome(
+    std::vector<Request> &requests,
+    std::vector<mpi_int_t> &indices
+) noexcept {
+  static_assert(sizeof(Request) == sizeof(MPI_Request), "Request must be layout-compatible with MPI_Request!");
+  mpi_int_t count;
+  indices.resize(requests.size());
+  utility::TraceSpan span("MPI_Waitsome", "mpi");
+  mcnla_assert_pass(MPI_Waitsome(requests.size(), reinterpret_cast<MPI_Request*>(requests.data()), &count, indices.data(),
+                                 MPI_STATUSES_IGNORE));
+  if ( count == MPI_UNDEFINED ) {
+    count = 0;
+  }
+  indices.resize(count);
+  return count;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+static inline void waitAll() noexcept {}
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  mpi_module
+/// @brief  Waits for all given requests to complete.
+///
+template <class ..._Requests>
+static inline void waitAll(
+    Request &request,
+    _Requests &...requests
+) noexcept {
+  request.wait();
+  waitAll(requests...);
+}
+
+}  // namespace mpi
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_MPI_REQUEST_HPP_
@@ -36,6 +36,9 @@ namespace random {
 /// @ingroup  random_module
 /// @brief  The random streams.
 ///
+/// The states right after seeding are kept, so that the same random numbers can be generated again by #reset without
+/// seeding (and allocating) again.
+///
 class Streams {
 
  public:
@@ -58,6 +61,15 @@ class Streams {
   /// The random streams
   std::vector<StreamType> streams_;
 
+  /// The random streams right after seeding
+  std::vector<StreamType> seeded_streams_;
+
+  /// The random seed
+  index_t seed_;
+
+  /// The tag shows if the seeds are scattered from the MPI root
+  bool scattered_;
+
  public:
 
   // Constructors
@@ -74,16 +86,21 @@ class Streams {
   // Gets information
   inline index_t ompSize() const noexcept;
   inline StreamType& operator[]( const index_t i ) const noexcept;
+  inline index_t seed() const noexcept;
 
   // Sets seed
   inline void setSeed( const index_t seed ) noexcept;
   inline void setSeeds( const index_t seed, const mpi_int_t mpi_root, const MPI_Comm mpi_comm ) noexcept;
+  inline void reset() noexcept;
+  inline void resetSeed( const index_t seed ) noexcept;
+  inline void resetSeeds( const index_t seed, const mpi_int_t mpi_root, const MPI_Comm mpi_comm ) noexcept;
 
  protected:
 
   // Sets seed
   inline void setSeedImpl( const index_t seed ) noexcept;
   inline void setSeedsImpl( const index_t seed, const mpi_int_t mpi_root, const MPI_Comm mpi_comm ) noexcept;
+  inline void deleteStreams() noexcept;
 
 };
 
@@ -33,7 +33,8 @@ Streams::Streams(
 #else  // _OPENMP
   : omp_size_(1),
 #endif  // _OPENMP
-    streams_(omp_size_) {
+    streams_(omp_size_),
+    seeded_streams_(omp_size_) {
   setSeedImpl(seed);
 }
 
@@ -51,7 +52,8 @@ Streams::Streams(
 #else  // _OPENMP
   : omp_size_(1),
 #endif  // _OPENMP
-    streams_(omp_size_) {
+    streams_(omp_size_),
+    seeded_streams_(omp_size_) {
   setSeedsImpl(seed, mpi_root, mpi_comm);
 }
 
@@ -59,11 +61,7 @@ Streams::Streams(
 /// @brief  Default destructor.
 ///
 Streams::~Streams() noexcept {
-#ifdef MCNLA_USE_MKL
-  for ( index_t i = 0; i < omp_size_; ++i ) {
-    vslDeleteStream(&(streams_[i]));
-  }
-#endif  // MCNLA_USE_MKL
+  deleteStreams();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,17 +80,20 @@ Streams::StreamType& Streams::operator[](
   return const_cast<StreamType&>(streams_[i]);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the random seed (the seed of the MPI root if the seeds are scattered).
+///
+index_t Streams::seed() const noexcept {
+  return seed_;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Sets the random seed.
 ///
 void Streams::setSeed(
     const index_t seed
 ) noexcept {
-#ifdef MCNLA_USE_MKL
-  for ( index_t i = 0; i < omp_size_; ++i ) {
-    vslDeleteStream(&(streams_[i]));
-  }
-#endif  // MCNLA_USE_MKL
+  deleteStreams();
   setSeedImpl(seed);
 }
 
@@ -104,12 +105,57 @@ void Streams::setSeeds(
     const mpi_int_t mpi_root,
     const MPI_Comm mpi_comm
 ) noexcept {
-#ifdef MCNLA_USE_MKL
+  deleteStreams();
+  setSeedsImpl(seed, mpi_root, mpi_comm);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Resets the streams to the states right after seeding.
+///
+/// @note  This routine does not allocate memory.
+///
+void Streams::reset() noexcept {
   for ( index_t i = 0; i < omp_size_; ++i ) {
-    vslDeleteStream(&(streams_[i]));
-  }
+#ifdef MCNLA_USE_MKL
+    vslCopyStreamState(streams_[i], seeded_streams_[i]);
+#else  // MCNLA_USE_MKL
+    streams_[i] = seeded_streams_[i];
 #endif  // MCNLA_USE_MKL
-  setSeedsImpl(seed, mpi_root, mpi_comm);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the random seed if it is changed, otherwise resets the streams (see #reset).
+///
+void Streams::resetSeed(
+    const index_t seed
+) noexcept {
+  if ( !scattered_ && seed == seed_ ) {
+    reset();
+  } else {
+    setSeed(seed);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Generate the random seeds and send to each MPI nodes if the seed of the MPI root is changed, otherwise resets the
+///         streams (see #reset).
+///
+/// @attention  This routine is collective.
+///
+void Streams::resetSeeds(
+    const index_t seed,
+    const mpi_int_t mpi_root,
+    const MPI_Comm mpi_comm
+) noexcept {
+  constexpr const MPI_Datatype datatype = traits::MpiValTraits<index_t>::datatype;
+  index_t seed_root = seed;
+  MPI_Bcast(&seed_root, 1, datatype, mpi_root, mpi_comm);
+  if ( scattered_ && seed_root == seed_ ) {
+    reset();
+  } else {
+    setSeeds(seed_root, mpi_root, mpi_comm);
+  }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -124,10 +170,14 @@ void Streams::setSeedImpl(
   for ( index_t i = 0; i < omp_size_; ++i ) {
 #ifdef MCNLA_USE_MKL
     vslNewStream(&(streams_[i]), VSL_BRNG_SFMT19937, seeds[i]);
+    vslCopyStream(&(seeded_streams_[i]), streams_[i]);
 #else  // MCNLA_USE_MKL
     streams_[i].seed(seeds[i]);
+    seeded_streams_[i] = streams_[i];
 #endif  // MCNLA_USE_MKL
   }
+  seed_ = seed;
+  scattered_ = false;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -147,6 +197,22 @@ void Streams::setSeedsImpl(
   index_t seed_tmp;
   MPI_Scatter(seeds.data(), 1, datatype, &seed_tmp, 1, datatype, mpi_root, mpi_comm);
   setSeedImpl(seed_tmp);
+  index_t seed_root = seed;
+  MPI_Bcast(&seed_root, 1, datatype, mpi_root, mpi_comm);
+  seed_ = seed_root;
+  scattered_ = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Deletes the streams.
+///
+void Streams::deleteStreams() noexcept {
+#ifdef MCNLA_USE_MKL
+  for ( index_t i = 0; i < omp_size_; ++i ) {
+    vslDeleteStream(&(streams_[i]));
+    vslDeleteStream(&(seeded_streams_[i]));
+  }
+#endif  // MCNLA_USE_MKL
 }
 
 }  // namespace random
@@ -9,9 +9,14 @@
 #define MCNLA_CORE_UTILITY_HPP_
 
 #include <mcnla/core/utility/def.hpp>
+#include <mcnla/core/utility/counter.hpp>
 #include <mcnla/core/utility/crtp.hpp>
 #include <mcnla/core/utility/memory.hpp>
+#include <mcnla/core/utility/memory_map.hpp>
+#include <mcnla/core/utility/memory_pool.hpp>
+#include <mcnla/core/utility/numa.hpp>
 #include <mcnla/core/utility/time.hpp>
+#include <mcnla/core/utility/tracer.hpp>
 #include <mcnla/core/utility/traits.hpp>
 
 #endif  // MCNLA_CORE_UTILITY_HPP_
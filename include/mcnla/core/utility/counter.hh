@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/utility/counter.hh
+/// @brief   The definition of operation counter.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_UTILITY_COUNTER_HH_
+#define MCNLA_CORE_UTILITY_COUNTER_HH_
+
+#include <mcnla/core/utility/def.hpp>
+#include <cstdint>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The utility namespace.
+//
+namespace utility {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// The operation counter.
+///
+/// Accumulates the analytic numbers of floating point operations and bytes moved by the BLAS and LAPACK routines, and the
+/// number of bytes communicated by the MPI routines of this MPI node. The counters are never reset; take the differences of
+/// two readings instead.
+///
+/// Also counts the heap allocations of the arrays (see @ref utility::malloc "malloc").
+///
+/// All the counters are kept per thread, so that the stages run concurrently by different threads (e.g., by
+/// @ref isvd::BatchSolver "BatchSolver") are counted separately (see @ref isvd::StageWrapper::flops "flops").
+///
+/// @attention  The routines called by the other threads of a parallel region are counted in those threads; add the
+///             differences of their counters to the calling thread (see #addFlops) to count them in the caller.
+///
+/// @note  The operations are counted as real operations for all value types.
+///
+class Counter {
+
+ public:
+
+  // Gets instance
+  static inline Counter& instance() noexcept;
+
+  // Gets data
+  inline double flops() const noexcept;
+  inline double bytes() const noexcept;
+  inline double commBytes() const noexcept;
+  inline std::int64_t allocations() const noexcept;
+  inline std::int64_t allocatedBytes() const noexcept;
+
+  // Counts
+  inline void addFlops( const double flops, const double bytes ) noexcept;
+  inline void addCommBytes( const double bytes ) noexcept;
+  inline void addAllocation( const std::int64_t bytes ) noexcept;
+
+ protected:
+
+  // Constructor
+  inline Counter() noexcept = default;
+
+  // Gets the counters of this thread
+  static inline double& threadFlops() noexcept;
+  static inline double& threadBytes() noexcept;
+  static inline double& threadCommBytes() noexcept;
+  static inline std::int64_t& threadAllocations() noexcept;
+  static inline std::int64_t& threadAllocatedBytes() noexcept;
+
+};
+
+// Counts
+static inline std::int64_t countFlops( const double flops, const std::int64_t bytes ) noexcept;
+static inline std::int64_t countCommBytes( const std::int64_t bytes ) noexcept;
+static inline void countAllocation( const std::int64_t bytes ) noexcept;
+
+}  // namespace utility
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_UTILITY_COUNTER_HH_
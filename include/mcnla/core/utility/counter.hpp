@@ -0,0 +1,177 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/utility/counter.hpp
+/// @brief   The operation counter.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_UTILITY_COUNTER_HPP_
+#define MCNLA_CORE_UTILITY_COUNTER_HPP_
+
+#include <mcnla/core/utility/counter.hh>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The utility namespace.
+//
+namespace utility {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the counter of this process.
+///
+Counter& Counter::instance() noexcept {
+  static Counter counter;
+  return counter;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of floating point operations of this thread.
+///
+double Counter::flops() const noexcept {
+  return threadFlops();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of bytes moved by the computation routines of this thread.
+///
+double Counter::bytes() const noexcept {
+  return threadBytes();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of bytes communicated by this thread.
+///
+double Counter::commBytes() const noexcept {
+  return threadCommBytes();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of heap allocations of this thread.
+///
+std::int64_t Counter::allocations() const noexcept {
+  return threadAllocations();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of bytes allocated on heap by this thread.
+///
+std::int64_t Counter::allocatedBytes() const noexcept {
+  return threadAllocatedBytes();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Counts a computation routine of this thread.
+///
+void Counter::addFlops(
+    const double flops,
+    const double bytes
+) noexcept {
+  threadFlops() += flops;
+  threadBytes() += bytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Counts a communication routine of this thread.
+///
+void Counter::addCommBytes(
+    const double bytes
+) noexcept {
+  threadCommBytes() += bytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Counts a heap allocation of this thread.
+///
+void Counter::addAllocation(
+    const std::int64_t bytes
+) noexcept {
+  ++threadAllocations();
+  threadAllocatedBytes() += bytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of floating point operations of this thread.
+///
+double& Counter::threadFlops() noexcept {
+  static thread_local double flops = 0.0;
+  return flops;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of bytes moved by the computation routines of this thread.
+///
+double& Counter::threadBytes() noexcept {
+  static thread_local double bytes = 0.0;
+  return bytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of bytes communicated by this thread.
+///
+double& Counter::threadCommBytes() noexcept {
+  static thread_local double bytes = 0.0;
+  return bytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of heap allocations of this thread.
+///
+std::int64_t& Counter::threadAllocations() noexcept {
+  static thread_local std::int64_t allocations = 0;
+  return allocations;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of bytes allocated on heap by this thread.
+///
+std::int64_t& Counter::threadAllocatedBytes() noexcept {
+  static thread_local std::int64_t bytes = 0;
+  return bytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// @brief  Counts a computation routine.
+///
+/// @return  @a bytes.
+///
+static inline std::int64_t countFlops(
+    const double flops,
+    const std::int64_t bytes
+) noexcept {
+  Counter::instance().addFlops(flops, bytes);
+  return bytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// @brief  Counts a communication routine.
+///
+/// @return  @a bytes.
+///
+static inline std::int64_t countCommBytes(
+    const std::int64_t bytes
+) noexcept {
+  Counter::instance().addCommBytes(bytes);
+  return bytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// @brief  Counts a heap allocation.
+///
+static inline void countAllocation(
+    const std::int64_t bytes
+) noexcept {
+  Counter::instance().addAllocation(bytes);
+}
+
+}  // namespace utility
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_UTILITY_COUNTER_HPP_
@@ -11,6 +11,7 @@
 #include <mcnla/core/utility/def.hpp>
 #include <cstdlib>
 #include <cstring>
+#include <mcnla/core/utility/counter.hpp>
 
 #ifdef MCNLA_USE_MKL
   #include <mkl.h>
@@ -35,8 +36,11 @@ namespace utility {
 ///
 /// @return         The pointer to the array.
 ///
+/// @note  The allocations are counted by the @ref Counter "counter" (also for #calloc and #realloc).
+///
 template <typename _Type>
 inline _Type* malloc( const index_t num ) noexcept {
+  countAllocation(num * sizeof(_Type));
   return static_cast<_Type*>(
 #ifdef MCNLA_USE_MKL
       mkl_malloc(num * sizeof(_Type), 64)
@@ -57,6 +61,7 @@ inline _Type* malloc( const index_t num ) noexcept {
 ///
 template <typename _Type>
 inline _Type* calloc( const index_t num ) noexcept {
+  countAllocation(num * sizeof(_Type));
   return static_cast<_Type*>(
 #ifdef MCNLA_USE_MKL
       mkl_calloc(num, sizeof(_Type), 64)
@@ -78,6 +83,7 @@ inline _Type* calloc( const index_t num ) noexcept {
 ///
 template <typename _Type>
 inline _Type* realloc( _Type *&ptr, const index_t num ) noexcept {
+  countAllocation(num * sizeof(_Type));
   return static_cast<_Type*>(
 #ifdef MCNLA_USE_MKL
       mkl_realloc(ptr, num * sizeof(_Type))
@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/utility/memory_map.hpp
+/// @brief   The memory-mapped file utilities.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_UTILITY_MEMORY_MAP_HPP_
+#define MCNLA_CORE_UTILITY_MEMORY_MAP_HPP_
+
+#include <mcnla/core/utility/def.hpp>
+#include <cstddef>
+#include <memory>
+#include <mcnla/core/utility/memory.hpp>
+
+#ifdef __linux__
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#else  // __linux__
+  #include <fstream>
+#endif  // __linux__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The utility namespace.
+//
+namespace utility {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// The enumeration of memory map modes.
+///
+enum class MapMode {
+  READ_ONLY     = 0x0,  ///< Read-only; the pages are shared with the page cache.
+  COPY_ON_WRITE = 0x1,  ///< Writable; the pages are copied on the first write, and the file is never modified.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// @brief  Maps an array of @a _Type with size @a num from a file.
+///
+/// The array is not read nor copied; the pages are loaded from the file on the first access. The file region need not be
+/// page aligned.
+///
+/// @tparam  _Type  The type of the array.
+/// @param   file   The file name.
+/// @param   pos    The position of the array in the file (in bytes).
+/// @param   num    The number of objects.
+/// @param   mode   The map mode.
+///
+/// @return         The shared pointer to the array, which unmaps the file; or an empty pointer if the file cannot be opened or
+///                 mapped, or is shorter than the array.
+///
+/// @attention  Writing a read-only array causes a segmentation fault.
+/// @note       Falls back to reading the file into an allocated array if memory mapping is not available.
+///
+template <typename _Type>
+static inline std::shared_ptr<_Type> mapFile(
+    const char *file,
+    const std::size_t pos,
+    const index_t num,
+    const MapMode mode = MapMode::READ_ONLY
+) noexcept {
+  const std::size_t bytes = num * sizeof(_Type);
+  if ( bytes == 0 ) {
+    return std::shared_ptr<_Type>();
+  }
+
+#ifdef __linux__
+  // Maps from the page containing the position
+  const std::size_t page_size = sysconf(_SC_PAGESIZE);
+  const std::size_t map_pos   = pos / page_size * page_size;
+  const std::size_t map_bytes = bytes + (pos - map_pos);
+
+  const int fd = open(file, O_RDONLY);
+  if ( fd == -1 ) {
+    return std::shared_ptr<_Type>();
+  }
+
+  // Accessing the pages beyond the end of file raises SIGBUS
+  struct stat file_stat;
+  if ( fstat(fd, &file_stat) != 0 || std::size_t(file_stat.st_size) < pos + bytes ) {
+    close(fd);
+    return std::shared_ptr<_Type>();
+  }
+
+  const int prot  = (mode == MapMode::READ_ONLY) ? PROT_READ  : (PROT_READ | PROT_WRITE);
+  const int flags = (mode == MapMode::READ_ONLY) ? MAP_SHARED : MAP_PRIVATE;
+  void *map_ptr = mmap(nullptr, map_bytes, prot, flags, fd, map_pos);
+  close(fd);
+  if ( map_ptr == MAP_FAILED ) {
+    return std::shared_ptr<_Type>();
+  }
+
+  auto ptr = static_cast<_Type*>(static_cast<void*>(static_cast<char*>(map_ptr) + (pos - map_pos)));
+  return std::shared_ptr<_Type>(ptr, [map_ptr, map_bytes]( _Type* ) { munmap(map_ptr, map_bytes); });
+#else  // __linux__
+  static_cast<void>(mode);
+  std::ifstream fin(file, std::ios::binary);
+  if ( fin.fail() ) {
+    return std::shared_ptr<_Type>();
+  }
+  std::shared_ptr<_Type> ptr(malloc<_Type>(num), free<_Type>);
+  fin.seekg(pos);
+  fin.read(static_cast<char*>(static_cast<void*>(ptr.get())), bytes);
+  if ( fin.fail() ) {
+    return std::shared_ptr<_Type>();
+  }
+  return ptr;
+#endif  // __linux__
+}
+
+}  // namespace utility
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_UTILITY_MEMORY_MAP_HPP_
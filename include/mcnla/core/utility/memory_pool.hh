@@ -0,0 +1,192 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/utility/memory_pool.hh
+/// @brief   The definition of memory pool.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_UTILITY_MEMORY_POOL_HH_
+#define MCNLA_CORE_UTILITY_MEMORY_POOL_HH_
+
+#include <mcnla/core/utility/def.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The utility namespace.
+//
+namespace utility {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// The enumeration of memory backends of the arrays.
+///
+enum class MemoryBackend {
+  SYSTEM = 0x0,  ///< The system allocator (see @ref malloc).
+  POOL   = 0x1,  ///< The memory pool (see @ref MemoryPool).
+  NUMA   = 0x2,  ///< The NUMA-aware allocator (see @ref numaMalloc).
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// The statistics of the memory pool.
+///
+struct MemoryStats {
+
+  /// The number of allocations.
+  std::int64_t allocations = 0;
+
+  /// The number of allocations served by the cached blocks.
+  std::int64_t reuses = 0;
+
+  /// The number of deallocations.
+  std::int64_t deallocations = 0;
+
+  /// The number of bytes requested by the allocated blocks.
+  std::size_t bytes_requested = 0;
+
+  /// The number of bytes of the allocated blocks.
+  std::size_t bytes_in_use = 0;
+
+  /// The number of bytes of the cached blocks.
+  std::size_t bytes_cached = 0;
+
+  /// The peak number of bytes of the allocated blocks.
+  std::size_t peak_bytes = 0;
+
+  // Gets fragmentation
+  inline double fragmentation() const noexcept;
+
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// The memory pool.
+///
+/// Caches the freed blocks by size classes (four classes per power of two, starting from 64 bytes), so that the temporary
+/// arrays (e.g., copies, workspaces of the drivers and collections created in each call) reuse the blocks instead of calling
+/// the system allocator again. The blocks are aligned to 64 bytes; if huge pages are enabled (see #setHugePage), the blocks
+/// larger than a huge page are aligned to huge pages and advised to use them.
+///
+/// The pool is thread-safe. It is used by the arrays if the memory backend is @ref MemoryBackend::POOL "POOL" (see
+/// @ref setMemoryBackend and @ref MemoryBackendGuard).
+///
+/// @note  The pool is never destroyed, so that the arrays may be released at any time; the cached blocks are returned to
+///        the system by #release.
+///
+class MemoryPool {
+
+ protected:
+
+  /// The alignment of the blocks.
+  static constexpr std::size_t alignment_ = 64;
+
+  /// The size of a huge page.
+  static constexpr std::size_t huge_page_size_ = std::size_t(1) << 21;
+
+  /// The mutex.
+  mutable std::mutex mutex_;
+
+  /// The cached blocks of each size class.
+  std::vector<std::vector<void*>> blocks_;
+
+  /// The tag shows if huge pages are used (atomic, since the blocks are allocated outside the mutex).
+  std::atomic<bool> huge_page_{false};
+
+  /// The statistics.
+  MemoryStats stats_;
+
+ public:
+
+  // Gets instance
+  static inline MemoryPool& instance() noexcept;
+
+  // Allocates
+  inline void* allocate( const std::size_t bytes ) noexcept;
+  inline void deallocate( void *ptr, const std::size_t bytes ) noexcept;
+  inline void release() noexcept;
+
+  // Gets data
+  inline MemoryStats stats() const noexcept;
+  inline bool isHugePage() const noexcept;
+
+  // Sets data
+  inline void setHugePage( const bool huge_page ) noexcept;
+
+ protected:
+
+  // Constructor
+  inline MemoryPool() noexcept = default;
+
+  // Gets size class
+  static inline std::size_t sizeClass( const std::size_t bytes ) noexcept;
+  static inline std::size_t classBytes( const std::size_t size_class ) noexcept;
+
+  // Allocates from system
+  inline void* allocateBlock( const std::size_t bytes ) const noexcept;
+  static inline void freeBlock( void *ptr ) noexcept;
+
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// The memory backend guard.
+///
+/// Selects the memory backend of the arrays allocated by this thread while the guard is alive (e.g., while initializing a
+/// stage, see @ref isvd::StageWrapper::setMemoryBackend "setMemoryBackend"). The guards may be nested.
+///
+class MemoryBackendGuard {
+
+  friend inline MemoryBackend memoryBackend() noexcept;
+  friend inline void setMemoryBackend( const MemoryBackend backend ) noexcept;
+
+ protected:
+
+  /// The memory backend.
+  const MemoryBackend backend_;
+
+  /// The memory backend of the outer guard.
+  const MemoryBackend *outer_;
+
+ public:
+
+  // Constructor
+  inline MemoryBackendGuard( const MemoryBackend backend ) noexcept;
+  inline MemoryBackendGuard( const MemoryBackendGuard &other ) noexcept = delete;
+
+  // Destructor
+  inline ~MemoryBackendGuard() noexcept;
+
+  // Operators
+  inline MemoryBackendGuard& operator=( const MemoryBackendGuard &other ) noexcept = delete;
+
+ protected:
+
+  // Gets the memory backends
+  static inline std::atomic<MemoryBackend>& globalBackend() noexcept;
+  static inline const MemoryBackend*& threadBackend() noexcept;
+
+};
+
+// Selects memory backend
+inline MemoryBackend memoryBackend() noexcept;
+inline void setMemoryBackend( const MemoryBackend backend ) noexcept;
+
+// Allocates
+template <typename _Type>
+static inline std::shared_ptr<_Type> allocateShared( const index_t num ) noexcept;
+
+}  // namespace utility
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_UTILITY_MEMORY_POOL_HH_
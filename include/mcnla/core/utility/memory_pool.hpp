@@ -0,0 +1,315 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/utility/memory_pool.hpp
+/// @brief   The memory pool.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_UTILITY_MEMORY_POOL_HPP_
+#define MCNLA_CORE_UTILITY_MEMORY_POOL_HPP_
+
+#include <mcnla/core/utility/memory_pool.hh>
+#include <algorithm>
+#include <cstdlib>
+#include <mcnla/core/utility/counter.hpp>
+#include <mcnla/core/utility/memory.hpp>
+#include <mcnla/core/utility/numa.hpp>
+
+#ifdef MCNLA_USE_MKL
+  #include <mkl.h>
+#endif  // MCNLA_USE_MKL
+
+#ifdef __linux__
+  #include <sys/mman.h>
+#endif  // __linux__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The utility namespace.
+//
+namespace utility {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the fraction of the bytes held by the pool which are not requested.
+///
+double MemoryStats::fragmentation() const noexcept {
+  const auto bytes_held = bytes_in_use + bytes_cached;
+  return (bytes_held > 0) ? (1.0 - double(bytes_requested) / bytes_held) : 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the memory pool of this process.
+///
+MemoryPool& MemoryPool::instance() noexcept {
+  static MemoryPool *pool = new MemoryPool();
+  return *pool;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Allocates a block.
+///
+/// @param   bytes  The number of bytes.
+///
+/// @return         The pointer to the block (`nullptr` if @a bytes is zero).
+///
+/// @note  The allocations are counted by the @ref Counter "counter".
+///
+void* MemoryPool::allocate(
+    const std::size_t bytes
+) noexcept {
+  if ( bytes == 0 ) {
+    return nullptr;
+  }
+  countAllocation(bytes);
+
+  const auto size_class  = sizeClass(bytes);
+  const auto block_bytes = classBytes(size_class);
+
+  void *ptr = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.allocations;
+    stats_.bytes_requested += bytes;
+    stats_.bytes_in_use    += block_bytes;
+    stats_.peak_bytes       = std::max(stats_.peak_bytes, stats_.bytes_in_use);
+    if ( size_class < blocks_.size() && !blocks_[size_class].empty() ) {
+      ptr = blocks_[size_class].back();
+      blocks_[size_class].pop_back();
+      ++stats_.reuses;
+      stats_.bytes_cached -= block_bytes;
+    }
+  }
+
+  if ( ptr == nullptr ) {
+    ptr = allocateBlock(block_bytes);
+  }
+  return ptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Deallocates a block.
+///
+/// @param   ptr    The pointer to the block.
+/// @param   bytes  The number of bytes (the same as allocating).
+///
+/// @note  The block is cached for later reuse.
+///
+void MemoryPool::deallocate(
+    void *ptr,
+    const std::size_t bytes
+) noexcept {
+  if ( ptr == nullptr ) {
+    return;
+  }
+
+  const auto size_class  = sizeClass(bytes);
+  const auto block_bytes = classBytes(size_class);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if ( size_class >= blocks_.size() ) {
+    blocks_.resize(size_class+1);
+  }
+  blocks_[size_class].push_back(ptr);
+  ++stats_.deallocations;
+  stats_.bytes_requested -= bytes;
+  stats_.bytes_in_use    -= block_bytes;
+  stats_.bytes_cached    += block_bytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Returns the cached blocks to the system.
+///
+void MemoryPool::release() noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for ( auto &blocks : blocks_ ) {
+    for ( auto ptr : blocks ) {
+      freeBlock(ptr);
+    }
+    blocks.clear();
+  }
+  stats_.bytes_cached = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the statistics.
+///
+MemoryStats MemoryPool::stats() const noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Determines if huge pages are used.
+///
+bool MemoryPool::isHugePage() const noexcept {
+  return huge_page_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets if huge pages are used.
+///
+/// @note  Only affects the blocks allocated from the system later.
+///
+void MemoryPool::setHugePage(
+    const bool huge_page
+) noexcept {
+  huge_page_ = huge_page;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the size class of the given number of bytes.
+///
+std::size_t MemoryPool::sizeClass(
+    const std::size_t bytes
+) noexcept {
+  std::size_t size_class = 0;
+  while ( classBytes(size_class) < bytes ) {
+    size_class += 4;
+  }
+  while ( size_class > 0 && classBytes(size_class-1) >= bytes ) {
+    --size_class;
+  }
+  return size_class;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of bytes of the blocks of the given size class.
+///
+std::size_t MemoryPool::classBytes(
+    const std::size_t size_class
+) noexcept {
+  return (alignment_ << (size_class / 4)) / 4 * (4 + size_class % 4);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Allocates a block from the system.
+///
+void* MemoryPool::allocateBlock(
+    const std::size_t bytes
+) const noexcept {
+  const bool is_huge = huge_page_ && bytes >= huge_page_size_;
+  const auto alignment = is_huge ? huge_page_size_ : alignment_;
+
+  void *ptr = nullptr;
+#ifdef MCNLA_USE_MKL
+  ptr = mkl_malloc(bytes, alignment);
+#else  // MCNLA_USE_MKL
+  if ( posix_memalign(&ptr, alignment, bytes) != 0 ) {
+    ptr = nullptr;
+  }
+#endif  // MCNLA_USE_MKL
+
+#ifdef MADV_HUGEPAGE
+  if ( is_huge && ptr != nullptr ) {
+    madvise(ptr, bytes, MADV_HUGEPAGE);
+  }
+#endif  // MADV_HUGEPAGE
+
+  return ptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Returns a block to the system.
+///
+void MemoryPool::freeBlock(
+    void *ptr
+) noexcept {
+#ifdef MCNLA_USE_MKL
+  mkl_free(ptr);
+#else  // MCNLA_USE_MKL
+  std::free(ptr);
+#endif  // MCNLA_USE_MKL
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Construct with given memory backend.
+///
+MemoryBackendGuard::MemoryBackendGuard(
+    const MemoryBackend backend
+) noexcept
+  : backend_(backend),
+    outer_(threadBackend()) {
+  threadBackend() = &backend_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Default destructor.
+///
+/// Restores the memory backend of the outer guard.
+///
+MemoryBackendGuard::~MemoryBackendGuard() noexcept {
+  threadBackend() = outer_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the global memory backend.
+///
+std::atomic<MemoryBackend>& MemoryBackendGuard::globalBackend() noexcept {
+  static std::atomic<MemoryBackend> backend(MemoryBackend::SYSTEM);
+  return backend;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the memory backend of the innermost guard of this thread (`nullptr` if none).
+///
+const MemoryBackend*& MemoryBackendGuard::threadBackend() noexcept {
+  static thread_local const MemoryBackend *backend = nullptr;
+  return backend;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// @brief  Gets the memory backend of the arrays allocated by this thread.
+///
+/// @return  The memory backend of the innermost @ref MemoryBackendGuard "guard" of this thread, or the global one.
+///
+inline MemoryBackend memoryBackend() noexcept {
+  const auto backend = MemoryBackendGuard::threadBackend();
+  return (backend != nullptr) ? *backend : MemoryBackendGuard::globalBackend().load();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// @brief  Sets the global memory backend of the arrays (@ref MemoryBackend::SYSTEM "SYSTEM" by default).
+///
+inline void setMemoryBackend(
+    const MemoryBackend backend
+) noexcept {
+  MemoryBackendGuard::globalBackend() = backend;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// @brief  Allocates an array of @a _Type with size @a num using the current memory backend (see @ref memoryBackend).
+///
+/// @tparam  _Type  The type of the array.
+/// @param   num    The number of objects.
+///
+/// @return         The shared pointer to the array, which returns the array to the same backend.
+///
+template <typename _Type>
+static inline std::shared_ptr<_Type> allocateShared( const index_t num ) noexcept {
+  switch ( memoryBackend() ) {
+    case MemoryBackend::POOL: {
+      const std::size_t bytes = num * sizeof(_Type);
+      return std::shared_ptr<_Type>(static_cast<_Type*>(MemoryPool::instance().allocate(bytes)),
+                                    [bytes]( _Type *ptr ) { MemoryPool::instance().deallocate(ptr, bytes); });
+    }
+    case MemoryBackend::NUMA: {
+      return std::shared_ptr<_Type>(numaMalloc<_Type>(num), [num]( _Type *ptr ) { numaFree(ptr, num); });
+    }
+    default: {
+      return std::shared_ptr<_Type>(malloc<_Type>(num), free<_Type>);
+    }
+  }
+}
+
+}  // namespace utility
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_UTILITY_MEMORY_POOL_HPP_
@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/utility/numa.hpp
+/// @brief   The NUMA-aware memory utilities.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_UTILITY_NUMA_HPP_
+#define MCNLA_CORE_UTILITY_NUMA_HPP_
+
+#include <mcnla/core/utility/def.hpp>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <mcnla/core/utility/counter.hpp>
+
+#ifdef _OPENMP
+  #include <omp.h>
+#endif  // _OPENMP
+
+#ifdef __linux__
+  #include <sys/mman.h>
+#endif  // __linux__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The utility namespace.
+//
+namespace utility {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// @brief  Initializes an array with zero in parallel.
+///
+/// The array is split into contiguous parts, one per OpenMP thread, in the same way as the random generators (see
+/// @ref random::gaussian "gaussian"). Since the pages of a new array are placed on the NUMA node of the thread touching them
+/// first, each part lands on the NUMA node of the thread computing on it.
+///
+/// @tparam  _Type  The type of the array.
+/// @param   ptr    The pointer to the array.
+/// @param   num    The number of objects.
+///
+template <typename _Type>
+static inline void firstTouch( _Type *ptr, const index_t num ) noexcept {
+#ifdef _OPENMP
+  const index_t omp_size = omp_get_max_threads();
+  #pragma omp parallel for
+#else  // _OPENMP
+  const index_t omp_size = 1;
+#endif  // _OPENMP
+  for ( index_t i = 0; i < omp_size; ++i ) {
+    index_t len = num / omp_size;
+    index_t start = len * i;
+    if ( i == omp_size-1 ) {
+      len = num - start;
+    }
+    std::memset(static_cast<void*>(ptr + start), 0, len * sizeof(_Type));
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// @brief  Allocates an array of @a _Type with size @a num on the NUMA nodes of the OpenMP threads.
+///
+/// The array is mapped without touching its pages, advised to use huge pages if it is larger than a huge page, and
+/// initialized with zero by #firstTouch.
+///
+/// @tparam  _Type  The type of the array.
+/// @param   num    The number of objects.
+///
+/// @return         The pointer to the array (page aligned).
+///
+/// @note  The allocations are counted by the @ref Counter "counter".
+/// @note  Falls back to an aligned allocation if memory mapping is not available.
+///
+template <typename _Type>
+static inline _Type* numaMalloc( const index_t num ) noexcept {
+  const std::size_t bytes = num * sizeof(_Type);
+  if ( bytes == 0 ) {
+    return nullptr;
+  }
+  countAllocation(bytes);
+
+  void *ptr = nullptr;
+#ifdef __linux__
+  ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if ( ptr == MAP_FAILED ) {
+    return nullptr;
+  }
+#ifdef MADV_HUGEPAGE
+  if ( bytes >= (std::size_t(1) << 21) ) {
+    madvise(ptr, bytes, MADV_HUGEPAGE);
+  }
+#endif  // MADV_HUGEPAGE
+#else  // __linux__
+  if ( posix_memalign(&ptr, 4096, bytes) != 0 ) {
+    return nullptr;
+  }
+#endif  // __linux__
+
+  firstTouch(static_cast<_Type*>(ptr), num);
+  return static_cast<_Type*>(ptr);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// @brief  Deallocates an array allocated by #numaMalloc and set it to `nullptr`.
+///
+/// @tparam  _Type  The type of the array.
+/// @param   ptr    The pointer to the array.
+/// @param   num    The number of objects (the same as allocating).
+///
+template <typename _Type>
+static inline void numaFree( _Type *&ptr, const index_t num ) noexcept {
+  if ( ptr != nullptr ) {
+#ifdef __linux__
+    munmap(ptr, num * sizeof(_Type));
+#else  // __linux__
+    static_cast<void>(num);
+    std::free(ptr);
+#endif  // __linux__
+  }
+  ptr = nullptr;
+}
+
+}  // namespace utility
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_UTILITY_NUMA_HPP_
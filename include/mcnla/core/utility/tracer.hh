@@ -0,0 +1,148 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/utility/tracer.hh
+/// @brief   The definition of tracer.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_UTILITY_TRACER_HH_
+#define MCNLA_CORE_UTILITY_TRACER_HH_
+
+#include <mcnla/core/utility/def.hpp>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The utility namespace.
+//
+namespace utility {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// The trace event.
+///
+struct TraceEvent {
+
+  /// The name.
+  std::string name;
+
+  /// The category (`stage`, `phase`, `blas`, `lapack` or `mpi`).
+  std::string category;
+
+  /// The starting time (in seconds since the tracer started).
+  double begin;
+
+  /// The ending time (in seconds since the tracer started).
+  double end;
+
+  /// The number of bytes moved (zero if unknown).
+  std::int64_t bytes;
+
+  /// The nesting depth.
+  std::int32_t depth;
+
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// The tracer.
+///
+/// Records the spans of the stages, the phases of the stages, the BLAS and LAPACK calls and the MPI routines of this MPI
+/// node. The timestamps are taken from a monotonic clock, relative to the moment the tracer started.
+///
+/// The tracer is disabled by default; a disabled tracer records nothing. Spans opened inside OpenMP parallel regions are
+/// ignored.
+///
+/// @note  Start the tracer of all MPI nodes right after a barrier, so that the timestamps of all MPI nodes share the origin.
+///
+/// @see  TraceSpan, mcnla::io::saveChromeTrace
+///
+class Tracer {
+
+ protected:
+
+  /// The clock type.
+  using ClockType = std::chrono::steady_clock;
+
+  /// The tag shows if the tracer is enabled.
+  bool enabled_ = false;
+
+  /// The origin of the timestamps.
+  ClockType::time_point origin_;
+
+  /// The events.
+  std::vector<TraceEvent> events_;
+
+  /// The indices of the open spans.
+  std::vector<std::size_t> stack_;
+
+ public:
+
+  // Gets instance
+  static inline Tracer& instance() noexcept;
+
+  // Controls
+  inline void start() noexcept;
+  inline void stop() noexcept;
+  inline void clear() noexcept;
+
+  // Gets data
+  inline bool isEnabled() const noexcept;
+  inline double now() const noexcept;
+  inline const std::vector<TraceEvent>& events() const noexcept;
+
+  // Records
+  inline bool push( const char *name, const char *category, const std::int64_t bytes = 0 ) noexcept;
+  inline void pop() noexcept;
+  inline void record( const std::string &name, const char *category, const double begin, const double end,
+                      const std::int64_t bytes = 0 ) noexcept;
+
+ protected:
+
+  // Constructor
+  inline Tracer() noexcept = default;
+
+  // Check if it is recording
+  inline bool isRecording() const noexcept;
+
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  utility_module
+/// The scoped trace span.
+///
+/// Opens a span of the @ref Tracer "tracer" on construction and closes it on destruction.
+///
+class TraceSpan {
+
+ protected:
+
+  /// The tag shows if the span is opened.
+  bool opened_;
+
+ public:
+
+  // Constructors
+  inline TraceSpan( const char *name, const char *category, const std::int64_t bytes = 0 ) noexcept;
+  inline TraceSpan( const TraceSpan &other ) noexcept = delete;
+
+  // Operators
+  inline TraceSpan& operator=( const TraceSpan &other ) noexcept = delete;
+
+  // Destructor
+  inline ~TraceSpan() noexcept;
+
+};
+
+}  // namespace utility
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_UTILITY_TRACER_HH_
@@ -0,0 +1,171 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/core/utility/tracer.hpp
+/// @brief   The tracer.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_CORE_UTILITY_TRACER_HPP_
+#define MCNLA_CORE_UTILITY_TRACER_HPP_
+
+#include <mcnla/core/utility/tracer.hh>
+
+#ifdef _OPENMP
+  #include <omp.h>
+#endif  // _OPENMP
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The utility namespace.
+//
+namespace utility {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the tracer of this process.
+///
+Tracer& Tracer::instance() noexcept {
+  static Tracer tracer;
+  return tracer;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Starts recording.
+///
+/// Clears the recorded events and resets the origin of the timestamps.
+///
+void Tracer::start() noexcept {
+  clear();
+  origin_  = ClockType::now();
+  enabled_ = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Stops recording.
+///
+/// @note  The recorded events are kept.
+///
+void Tracer::stop() noexcept {
+  enabled_ = false;
+  stack_.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Clears the recorded events.
+///
+void Tracer::clear() noexcept {
+  events_.clear();
+  stack_.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Check if the tracer is enabled.
+///
+bool Tracer::isEnabled() const noexcept {
+  return enabled_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the current time (in seconds since the tracer started).
+///
+double Tracer::now() const noexcept {
+  return std::chrono::duration<double>(ClockType::now() - origin_).count();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the recorded events.
+///
+const std::vector<TraceEvent>& Tracer::events() const noexcept {
+  return events_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Opens a span.
+///
+/// @return  true if the span is recorded.
+///
+bool Tracer::push(
+    const char *name,
+    const char *category,
+    const std::int64_t bytes
+) noexcept {
+  if ( !isRecording() ) {
+    return false;
+  }
+  const double moment = now();
+  events_.push_back(TraceEvent{name, category, moment, moment, bytes, static_cast<std::int32_t>(stack_.size())});
+  stack_.push_back(events_.size()-1);
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Closes the innermost span.
+///
+void Tracer::pop() noexcept {
+  if ( stack_.empty() ) {
+    return;
+  }
+  events_[stack_.back()].end = now();
+  stack_.pop_back();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Records a finished span.
+///
+/// The span is nested in the open spans.
+///
+void Tracer::record(
+    const std::string &name,
+    const char *category,
+    const double begin,
+    const double end,
+    const std::int64_t bytes
+) noexcept {
+  if ( !isRecording() ) {
+    return;
+  }
+  events_.push_back(TraceEvent{name, category, begin, end, bytes, static_cast<std::int32_t>(stack_.size())});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Check if the tracer records the current thread.
+///
+bool Tracer::isRecording() const noexcept {
+#ifdef _OPENMP
+  return enabled_ && !omp_in_parallel();
+#else  // _OPENMP
+  return enabled_;
+#endif  // _OPENMP
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Opens a span.
+///
+/// @param  name      The name.
+/// @param  category  The category.
+/// @param  bytes     The number of bytes moved.
+///
+TraceSpan::TraceSpan(
+    const char *name,
+    const char *category,
+    const std::int64_t bytes
+) noexcept
+  : opened_(Tracer::instance().push(name, category, bytes)) {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Closes the span.
+///
+TraceSpan::~TraceSpan() noexcept {
+  if ( opened_ ) {
+    Tracer::instance().pop();
+  }
+}
+
+}  // namespace utility
+
+}  // namespace mcnla
+
+#endif  // MCNLA_CORE_UTILITY_TRACER_HPP_
@@ -15,6 +15,7 @@
 #include <mcnla/isvd/integrator.hpp>
 #include <mcnla/isvd/former.hpp>
 #include <mcnla/isvd/converter.hpp>
+#include <mcnla/isvd/solver.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @defgroup  isvd_core_module  iSVD Core Module
@@ -52,4 +53,10 @@
 /// @brief     The iSVD Converter Module
 ///
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @defgroup  isvd_solver_module  iSVD Solver Module
+/// @ingroup   isvd_module
+/// @brief     The iSVD Solver Module
+///
+
 #endif  // MCNLA_ISVD_HPP_
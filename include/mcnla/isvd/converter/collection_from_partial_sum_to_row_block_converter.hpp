@@ -67,6 +67,11 @@ void MCNLA_ALIAS::runImpl(
   static_cast<void>(dim_sketch);
   static_cast<void>(num_sketch);
 
+  // Converts locally if there is only one MPI node
+  if ( detail::convertSingleNode(*this, collection_qjp, collection_qj) ) {
+    return;
+  }
+
   mcnla_assert_eq(collection_qjp.sizes(),  std::make_tuple(nrow, dim_sketch, num_sketch));
   mcnla_assert_eq(collection_qj.sizes(), std::make_tuple(nrow_rank, dim_sketch, num_sketch));
 
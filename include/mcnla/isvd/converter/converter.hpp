@@ -10,6 +10,7 @@
 
 #include <mcnla/isvd/def.hpp>
 #include <mcnla/isvd/core/stage_wrapper.hpp>
+#include <mcnla/core/la.hpp>
 #include <mcnla/core/utility/traits.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -51,6 +52,72 @@ namespace isvd {
 ///
 template <class _Tag, typename _Val> class Converter;
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace.
+//
+namespace detail {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Converts data without communication.
+///
+/// Used when the source and the destination layouts coincide (e.g. only one MPI node). If @a output is empty, it is bound
+/// to the storage of @a input (zero-copy); if they already share the storage, nothing is done; otherwise the data is copied.
+///
+template <typename _Val, Trans _trans>
+inline void convertLocal(
+    const DenseMatrix<_Val, _trans> &input,
+          DenseMatrix<_Val, _trans> &output
+) noexcept {
+  if ( output.isEmpty() ) {
+    output = input;
+  } else if ( output.valPtr() != input.valPtr() ) {
+    la::copy(input, output);
+  }
+}
+
+/// @copydoc  convertLocal
+template <typename _Val, Trans _trans>
+inline void convertLocal(
+    const DenseMatrixCollectionColBlock<_Val, _trans> &input,
+          DenseMatrixCollectionColBlock<_Val, _trans> &output
+) noexcept {
+  if ( output.isEmpty() ) {
+    output = input;
+  } else if ( output.unfold().valPtr() != input.unfold().valPtr() ) {
+    mcnla_assert_eq(input.sizes(), output.sizes());
+    mcnla_assert_eq(input.mcol(), output.mcol());
+    la::copy(input.unfold(), output.unfold());
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Converts data without communication if there is only one MPI node.
+///
+/// With only one MPI node, the source and the destination layouts coincide, so the data is converted by #convertLocal and
+/// recorded as the only part of @a converter.
+///
+/// @return  Whether the data is converted.
+///
+template <class _Converter, class _Input, class _Output>
+inline bool convertSingleNode(
+          _Converter &converter,
+    const _Input     &input,
+          _Output    &output
+) noexcept {
+  auto &stage = static_cast<StageWrapper<_Converter>&>(converter);
+  if ( stage.parameters_.mpi_size != 1 ) {
+    return false;
+  }
+
+  double comm_time;
+  stage.tic(comm_time);
+  convertLocal(input, output);
+  stage.toc(comm_time);
+  return true;
+}
+
+}  // namespace detail
+
 }  // namespace isvd
 
 }  // namespace mcnla
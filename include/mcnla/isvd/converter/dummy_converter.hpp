@@ -51,7 +51,9 @@ template <typename _Val> template <typename ..._Args>
 void MCNLA_ALIAS::runImpl(
     _Args...
 ) noexcept {
-  this->tic();
+  double comm_time;
+  this->tic(comm_time);
+  this->toc(comm_time);
 }
 
 }  // namespace isvd
@@ -64,6 +64,11 @@ void MCNLA_ALIAS::runImpl(
   static_cast<void>(ncol);
   static_cast<void>(ncol_rank);
 
+  // Converts locally if there is only one MPI node
+  if ( detail::convertSingleNode(*this, matrix_j, matrix) ) {
+    return;
+  }
+
   mcnla_assert_eq(matrix_j.nrow(), matrix.nrow());
   mcnla_assert_eq(matrix_j.ncol(), ncol_rank);
   mcnla_assert_eq(matrix.ncol(),   ncol);
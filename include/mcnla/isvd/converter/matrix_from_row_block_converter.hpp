@@ -64,6 +64,11 @@ void MCNLA_ALIAS::runImpl(
   static_cast<void>(nrow);
   static_cast<void>(nrow_rank);
 
+  // Converts locally if there is only one MPI node
+  if ( detail::convertSingleNode(*this, matrix_j, matrix) ) {
+    return;
+  }
+
   mcnla_assert_eq(matrix_j.ncol(), matrix.ncol());
   mcnla_assert_eq(matrix_j.nrow(), nrow_rank);
   mcnla_assert_eq(matrix.nrow(),   nrow);
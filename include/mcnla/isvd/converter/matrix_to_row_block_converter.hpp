@@ -65,6 +65,11 @@ void MCNLA_ALIAS::runImpl(
   static_cast<void>(nrow);
   static_cast<void>(nrow_rank);
 
+  // Converts locally if there is only one MPI node
+  if ( detail::convertSingleNode(*this, matrix, matrix_j) ) {
+    return;
+  }
+
   mcnla_assert_eq(matrix.ncol(),   matrix_j.ncol());
   mcnla_assert_eq(matrix.nrow(),   nrow);
   mcnla_assert_eq(matrix_j.nrow(), nrow_rank);
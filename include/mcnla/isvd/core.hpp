@@ -8,6 +8,7 @@
 #ifndef MCNLA_ISVD_CORE_HPP_
 #define MCNLA_ISVD_CORE_HPP_
 
+#include <mcnla/isvd/core/configuration.hpp>
 #include <mcnla/isvd/core/parameters.hpp>
 #include <mcnla/isvd/core/stage_wrapper.hpp>
 
@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/isvd/core/configuration.hh
+/// @brief   The definition of configuration of iSVD driver.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_ISVD_CORE_CONFIGURATION_HH_
+#define MCNLA_ISVD_CORE_CONFIGURATION_HH_
+
+#include <mcnla/isvd/def.hpp>
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The iSVD namespace.
+//
+namespace isvd {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  isvd_core_module
+/// The configuration of iSVD driver.
+///
+/// The configuration is stored as a text file of `key = value` lines; the lines starting with `#` are comments, and the
+/// missing keys keep their default values. It is written by the `isvd_tune` program and read by the iSVD drivers, where the
+/// parameters given on the command line override the ones in the configuration.
+///
+/// The stages are named by their type names, such as `RowBlockGaussianProjectionSketcher`; an empty name keeps the stage
+/// chosen by the driver.
+///
+struct Configuration {
+
+  /// The desired rank the configuration is tuned for (zero if unknown).
+  index_t rank = 0;
+
+  /// The number of random sketches.
+  index_t num_sketch = 16;
+
+  /// The oversampling dimension.
+  index_t over_rank = 12;
+
+  /// The tolerance of the integrator.
+  double tolerance = 1e-3;
+
+  /// The maximum number of iterations of the integrator.
+  index_t max_iteration = 256;
+
+  /// The number of OpenMP threads per MPI node (zero for unchanged).
+  index_t num_thread = 0;
+
+  /// The name of the sketcher.
+  std::string sketcher;
+
+  /// The name of the orthogonalizer.
+  std::string orthogonalizer;
+
+  /// The name of the integrator.
+  std::string integrator;
+
+  /// The name of the former.
+  std::string former;
+
+  /// The estimated computing time (in seconds; zero if unknown).
+  double time = 0.0;
+
+  /// The estimated error (zero if unknown).
+  double error = 0.0;
+
+  // Load & save
+  inline bool load( const char *file ) noexcept;
+  inline void save( const char *file ) const noexcept;
+
+};
+
+}  // namespace isvd
+
+}  // namespace mcnla
+
+#endif  // MCNLA_ISVD_CORE_CONFIGURATION_HH_
@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/isvd/core/configuration.hpp
+/// @brief   The configuration of iSVD driver.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_ISVD_CORE_CONFIGURATION_HPP_
+#define MCNLA_ISVD_CORE_CONFIGURATION_HPP_
+
+#include <mcnla/isvd/core/configuration.hh>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The iSVD namespace.
+//
+namespace isvd {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Loads the configuration from a file.
+///
+/// @return  @c false if the file can't be opened.
+///
+bool Configuration::load(
+    const char *file
+) noexcept {
+  std::ifstream fin(file);
+  if ( fin.fail() ) {
+    return false;
+  }
+
+  std::string line;
+  while ( std::getline(fin, line) ) {
+    auto pos = line.find('=');
+    if ( line.empty() || line[0] == '#' || pos == std::string::npos ) {
+      continue;
+    }
+    auto trim = []( const std::string &str ) {
+      auto head = str.find_first_not_of(" \t\r");
+      auto tail = str.find_last_not_of(" \t\r");
+      return (head == std::string::npos) ? std::string() : str.substr(head, tail-head+1);
+    };
+    const auto key   = trim(line.substr(0, pos));
+    const auto value = trim(line.substr(pos+1));
+
+    if ( key == "rank" ) {
+      rank = std::atol(value.c_str());
+    } else if ( key == "num_sketch" ) {
+      num_sketch = std::atol(value.c_str());
+    } else if ( key == "over_rank" ) {
+      over_rank = std::atol(value.c_str());
+    } else if ( key == "tolerance" ) {
+      tolerance = std::atof(value.c_str());
+    } else if ( key == "max_iteration" ) {
+      max_iteration = std::atol(value.c_str());
+    } else if ( key == "num_thread" ) {
+      num_thread = std::atol(value.c_str());
+    } else if ( key == "sketcher" ) {
+      sketcher = value;
+    } else if ( key == "orthogonalizer" ) {
+      orthogonalizer = value;
+    } else if ( key == "integrator" ) {
+      integrator = value;
+    } else if ( key == "former" ) {
+      former = value;
+    } else if ( key == "time" ) {
+      time = std::atof(value.c_str());
+    } else if ( key == "error" ) {
+      error = std::atof(value.c_str());
+    }
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Saves the configuration into a file.
+///
+void Configuration::save(
+    const char *file
+) const noexcept {
+  std::ofstream fout(file);
+  mcnla_assert_false(fout.fail());
+  fout << "# MCNLA iSVD configuration" << std::endl;
+  fout << "rank           = " << rank << std::endl;
+  fout << "num_sketch     = " << num_sketch << std::endl;
+  fout << "over_rank      = " << over_rank << std::endl;
+  fout << "tolerance      = " << tolerance << std::endl;
+  fout << "max_iteration  = " << max_iteration << std::endl;
+  fout << "num_thread     = " << num_thread << std::endl;
+  fout << "sketcher       = " << sketcher << std::endl;
+  fout << "orthogonalizer = " << orthogonalizer << std::endl;
+  fout << "integrator     = " << integrator << std::endl;
+  fout << "former         = " << former << std::endl;
+  fout << "time           = " << std::setprecision(6) << time << std::endl;
+  fout << "error          = " << std::setprecision(6) << error << std::endl;
+}
+
+}  // namespace isvd
+
+}  // namespace mcnla
+
+#endif  // MCNLA_ISVD_CORE_CONFIGURATION_HPP_
@@ -10,6 +10,8 @@
 
 #include <mcnla/isvd/def.hpp>
 #include <mcnla/core/matrix.hpp>
+#include <cstddef>
+#include <memory>
 #include <mcnla/core/mpi.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,8 +68,17 @@ class Parameters {
 
     /// The number of random sketches.
     index_t num_sketch_ = 16;
+
+    /// The tag shows if the reductions are hierarchical.
+    bool hierarchical_ = false;
+
+    /// The upper bound of the memory (in bytes) per MPI node (zero for no limit).
+    std::size_t memory_limit_ = 0;
   } params_;
 
+  /// The hierarchical communicator.
+  std::shared_ptr<mpi::HierarchicalComm> hier_comm_;
+
  public:
 
   // Constructors
@@ -95,6 +106,10 @@ class Parameters {
   inline index_t dimSketchTotal() const noexcept;
   inline index_t numSketch() const noexcept;
   inline index_t numSketchEach() const noexcept;
+  inline bool isHierarchical() const noexcept;
+  inline std::size_t memoryLimit() const noexcept;
+  inline       mpi::HierarchicalComm& hierComm() noexcept;
+  inline const mpi::HierarchicalComm& hierComm() const noexcept;
 
   // Sets parameter
   template <class _Matrix>
@@ -104,6 +119,12 @@ class Parameters {
   inline Parameters& setOverRank( const index_t over_rank ) noexcept;
   inline Parameters& setNumSketch( const index_t num_sketch ) noexcept;
   inline Parameters& setNumSketchEach( const index_t num_sketch_each ) noexcept;
+  inline Parameters& setHierarchical( const bool hierarchical ) noexcept;
+  inline Parameters& setMemoryLimit( const std::size_t memory_limit ) noexcept;
+
+  // Communicates
+  template <class _Buffer>
+  inline void allreduce( _Buffer &&buffer, const MPI_Op op ) const noexcept;
 
   // Create matrices
   inline DenseMatrixCollectionColBlockRowMajor<_Val> createCollectionQ() const noexcept;
@@ -42,6 +42,11 @@ void Parameters<_Val>::sync() noexcept {
   mcnla_assert_gt(params_.ncol_, 0);
   mcnla_assert_gt(params_.rank_, 0);
   MPI_Bcast(&params_, sizeof(params_), MPI_BYTE, mpi_root, mpi_comm);
+  if ( params_.hierarchical_ && !hier_comm_ ) {
+    hier_comm_ = std::make_shared<mpi::HierarchicalComm>(mpi_comm);
+  } else if ( !params_.hierarchical_ ) {
+    hier_comm_.reset();
+  }
   synchronized_ = true;
 }
 
@@ -196,6 +201,42 @@ index_t Parameters<_Val>::numSketchEach() const noexcept {
   return params_.num_sketch_ / mpi_size;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Check if the reductions are hierarchical.
+///
+template <typename _Val>
+bool Parameters<_Val>::isHierarchical() const noexcept {
+  return static_cast<bool>(hier_comm_);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the upper bound of the memory (in bytes) per MPI node.
+///
+template <typename _Val>
+std::size_t Parameters<_Val>::memoryLimit() const noexcept {
+  return params_.memory_limit_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the hierarchical communicator.
+///
+/// @attention  The parameters should be synchronized in hierarchical mode.
+///
+template <typename _Val>
+mpi::HierarchicalComm& Parameters<_Val>::hierComm() noexcept {
+  mcnla_assert_true(isHierarchical());
+  return *hier_comm_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  hierComm
+///
+template <typename _Val>
+const mpi::HierarchicalComm& Parameters<_Val>::hierComm() const noexcept {
+  mcnla_assert_true(isHierarchical());
+  return *hier_comm_;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Sets the sizes of the matrix.
 ///
@@ -281,6 +322,60 @@ Parameters<_Val>& Parameters<_Val>::setNumSketchEach(
   return *this;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the hierarchical mode.
+///
+/// In hierarchical mode, the reductions through #allreduce are combined inside each computing node with a shared-memory
+/// window, and only one process per node communicates across nodes. The communicators are created in #sync.
+///
+template <typename _Val>
+Parameters<_Val>& Parameters<_Val>::setHierarchical(
+    const bool hierarchical
+) noexcept {
+  params_.hierarchical_ = hierarchical;
+  synchronized_ = false;
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the upper bound of the memory (in bytes) per MPI node.
+///
+/// The @ref Solver "solver" tiles the stages to fit this bound (see @ref StageWrapper::fitMemory "fitMemory"). Set zero
+/// for no limit.
+///
+template <typename _Val>
+Parameters<_Val>& Parameters<_Val>::setMemoryLimit(
+    const std::size_t memory_limit
+) noexcept {
+  params_.memory_limit_ = memory_limit;
+  synchronized_ = false;
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Combines values from all MPI nodes and distributes the result back to all MPI nodes (in-place version).
+///
+/// Uses the hierarchical communicator in hierarchical mode, and @ref mpi_comm otherwise. Does nothing if there is only one
+/// MPI node, so that the stages on a single MPI node never call MPI (see @ref BatchSolver).
+///
+/// @attention  The dimension of @a buffer should be the same for all MPI nodes.
+/// @attention  @a buffer should be shrunk.
+///
+template <typename _Val> template <class _Buffer>
+void Parameters<_Val>::allreduce(
+          _Buffer &&buffer,
+    const MPI_Op op
+) const noexcept {
+  if ( mpi_size == 1 ) {
+    return;
+  }
+  if ( isHierarchical() ) {
+    hier_comm_->allreduce(buffer, op);
+  } else {
+    mpi::allreduce(buffer, op, mpi_comm);
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Creates matrix collection Q.
 ///
@@ -11,11 +11,17 @@
 #include <mcnla/isvd/def.hpp>
 #include <iostream>
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
 #include <vector>
 #include <mcnla/isvd/core/parameters.hpp>
 #include <mcnla/core/matrix.hpp>
 #include <mcnla/core/utility/crtp.hpp>
+#include <mcnla/core/utility/counter.hpp>
+#include <mcnla/core/utility/memory_pool.hpp>
 #include <mcnla/core/utility/time.hpp>
+#include <mcnla/core/utility/tracer.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //  The MCNLA namespace.
@@ -27,20 +33,46 @@ namespace mcnla {
 //
 namespace isvd {
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace detail {
+template <class _Converter, class _Input, class _Output>
+inline bool convertSingleNode( _Converter &converter, const _Input &input, _Output &output ) noexcept;
+}  // namespace detail
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// The iSVD stage wrapper.
 ///
+/// If the @ref utility::Tracer "tracer" is enabled, each run of the stage is traced as a span, and each part of the stage
+/// (see #names) is traced as a nested span.
+///
+/// The floating point operations, the bytes moved and the bytes communicated by the BLAS, LAPACK and MPI routines called
+/// while running the stage are accumulated from the @ref utility::Counter "counter" (see #gflops).
+///
+/// All the workspaces are allocated by #initialize, which plans the stage for the sizes of the parameters; running the stage
+/// again and again (e.g., on a stream of matrices of the same size) does not allocate any array (see #allocations). The
+/// workspaces are allocated by the memory backend of the stage (see #setMemoryBackend).
+///
 /// @tparam  _Derived  The derived type.
 ///
 template <class _Derived>
 class StageWrapper {
 
+  template <class _Converter, class _Input, class _Output>
+  friend bool detail::convertSingleNode( _Converter &converter, const _Input &input, _Output &output ) noexcept;
+
  private:
 
   using _Val = ValT<_Derived>;
 
  protected:
 
+  /// The default name.
+  static constexpr const char* name_ = "Converter";
+
+  /// The default name of each part of the stage.
+  static constexpr const char* names_ = "conversion";
+
   /// The parameters
   const Parameters<_Val> &parameters_;
 
@@ -56,6 +88,24 @@ class StageWrapper {
   /// The time of communication of each part of the stage.
   std::vector<double> comm_times_;
 
+  /// The number of floating point operations.
+  double flops_ = 0.0;
+
+  /// The number of bytes moved by the computation routines.
+  double bytes_ = 0.0;
+
+  /// The number of bytes communicated.
+  double comm_bytes_ = 0.0;
+
+  /// The number of heap allocations.
+  std::int64_t allocations_ = 0;
+
+  /// The tag shows if the memory backend is set.
+  bool has_memory_backend_ = false;
+
+  /// The memory backend of the workspaces.
+  utility::MemoryBackend memory_backend_ = utility::MemoryBackend::SYSTEM;
+
  protected:
 
   // Constructor
@@ -69,7 +119,7 @@ class StageWrapper {
 
   // Operators
   template <typename ..._Args>
-  inline void operator()( _Args... arg ) noexcept;
+  inline void operator()( _Args &&...args ) noexcept;
   template <typename ..._Args>
   friend inline std::ostream& operator<<( std::ostream &os, const StageWrapper<_Args...> &wrapper ) noexcept;
 
@@ -85,16 +135,42 @@ class StageWrapper {
   inline std::vector<double> moments() const noexcept;
   inline const char* names() const noexcept;
 
+  // Gets operation count
+  inline double flops() const noexcept;
+  inline double gflops() const noexcept;
+  inline double bytesMoved() const noexcept;
+  inline double commBytes() const noexcept;
+  inline std::int64_t allocations() const noexcept;
+
+  // Gets memory requirement
+  inline std::size_t memoryRequirement() const noexcept;
+
+  // Gets memory backend
+  inline utility::MemoryBackend memoryBackend() const noexcept;
+
+  // Sets memory backend
+  inline _Derived& setMemoryBackend( const utility::MemoryBackend backend ) noexcept;
+
+  // Fits memory
+  inline void fitMemory( const std::size_t limit ) noexcept;
+
  protected:
 
   // Outputs name
   inline std::ostream& outputName( std::ostream &os ) const noexcept;
   inline std::ostream& outputNameImpl( std::ostream& os ) const noexcept;
 
+  // Memory
+  inline std::size_t memoryRequirementImpl() const noexcept;
+  inline void fitMemoryImpl( const std::size_t limit ) noexcept;
+
   // Record time
   inline void tic( double &comm_time ) noexcept;
   inline void toc( double &comm_time ) noexcept;
 
+  // Traces the parts
+  inline void tracePhases( const double offset ) const noexcept;
+
   MCNLA_CRTP_DERIVED(_Derived)
 
 
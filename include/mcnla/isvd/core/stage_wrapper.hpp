@@ -9,6 +9,8 @@
 #define MCNLA_ISVD_CORE_STAGE_WRAPPER_HPP_
 
 #include <mcnla/isvd/core/stage_wrapper.hh>
+#include <algorithm>
+#include <cstring>
 #include <numeric>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,14 +35,24 @@ StageWrapper<_Derived>::StageWrapper(
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Initializes.
 ///
+/// Allocates the workspaces by the memory backend of the stage (see #memoryBackend).
+///
 template <class _Derived> template <typename ..._Args>
 void StageWrapper<_Derived>::initialize(
     _Args... args
 ) noexcept {
   mcnla_assert_true(parameters_.isSynchronized());
+  utility::MemoryBackendGuard guard(memoryBackend());
   derived().initializeImpl(args...);
   moments_.clear();
   comm_times_.clear();
+  const auto num_part = std::count(names(), names()+std::strlen(names()), '/') + 1;
+  moments_.reserve(num_part+1);
+  comm_times_.reserve(num_part);
+  flops_       = 0.0;
+  bytes_       = 0.0;
+  comm_bytes_  = 0.0;
+  allocations_ = 0;
   initialized_ = true;
   computed_ = false;
 }
@@ -48,15 +60,30 @@ void StageWrapper<_Derived>::initialize(
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Run the stage.
 ///
+/// @note  The arguments are passed by reference, so that the stage may rebind its outputs (see the converters).
+///
 template <class _Derived> template <typename ..._Args>
 void StageWrapper<_Derived>::operator()(
-    _Args... args
+    _Args &&...args
 ) noexcept {
   mcnla_assert_true(parameters_.isSynchronized());
   mcnla_assert_true(isInitialized());
   moments_.clear();
   comm_times_.clear();
+  utility::TraceSpan span(derived().name_, "stage");
+  const double offset = utility::Tracer::instance().now() - utility::getTime();
+  const auto &counter = utility::Counter::instance();
+  flops_       = -counter.flops();
+  bytes_       = -counter.bytes();
+  comm_bytes_  = -counter.commBytes();
+  allocations_ = -counter.allocations();
   derived().runImpl(args...);
+  flops_       += counter.flops();
+  bytes_       += counter.bytes();
+  comm_bytes_  += counter.commBytes();
+  allocations_ += counter.allocations();
+  mcnla_assert_eq(allocations_, 0);
+  tracePhases(offset);
   computed_ = true;
 }
 
@@ -163,6 +190,124 @@ const char* StageWrapper<_Derived>::names() const noexcept {
   return derived().names_;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of floating point operations of running the stage in this MPI node.
+///
+template <class _Derived>
+double StageWrapper<_Derived>::flops() const noexcept {
+  return flops_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the computing rate (in GFLOPS) of running the stage in this MPI node.
+///
+template <class _Derived>
+double StageWrapper<_Derived>::gflops() const noexcept {
+  const double time = this->time();
+  return (time > 0) ? flops_ / time * 1e-9 : 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of bytes moved by the BLAS and LAPACK routines of running the stage in this MPI node.
+///
+/// @note  The value is an analytic estimation, which assumes each operand is read (and written) once.
+///
+template <class _Derived>
+double StageWrapper<_Derived>::bytesMoved() const noexcept {
+  return bytes_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of bytes communicated by the MPI routines of running the stage in this MPI node.
+///
+template <class _Derived>
+double StageWrapper<_Derived>::commBytes() const noexcept {
+  return comm_bytes_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of heap allocations of arrays of running the stage.
+///
+/// The stages allocate all the workspaces while initializing, therefore it should be zero (asserted in debug mode).
+///
+/// @note  The allocations of the MPI library and of the tracer (if enabled) are not counted.
+///
+template <class _Derived>
+std::int64_t StageWrapper<_Derived>::allocations() const noexcept {
+  return allocations_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of bytes of the workspaces allocated by #initialize in this MPI node.
+///
+/// The requirement is computed from the parameters and the options of the stage, so that it is available before the stage
+/// is initialized.
+///
+/// @note  The internal workspaces of the LAPACK drivers are not counted.
+///
+template <class _Derived>
+std::size_t StageWrapper<_Derived>::memoryRequirement() const noexcept {
+  return derived().memoryRequirementImpl();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the memory backend of the workspaces.
+///
+/// @return  The memory backend set by #setMemoryBackend, or the current one of this thread (see
+///          @ref utility::memoryBackend "memoryBackend") if not set.
+///
+template <class _Derived>
+utility::MemoryBackend StageWrapper<_Derived>::memoryBackend() const noexcept {
+  return has_memory_backend_ ? memory_backend_ : utility::memoryBackend();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the memory backend of the workspaces.
+///
+/// @note  Only affects the workspaces allocated by #initialize later.
+///
+template <class _Derived>
+_Derived& StageWrapper<_Derived>::setMemoryBackend(
+    const utility::MemoryBackend backend
+) noexcept {
+  has_memory_backend_ = true;
+  memory_backend_     = backend;
+  return derived();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Reduces the memory requirement to at most @a limit bytes if possible.
+///
+/// The stages which support tiling choose the tile size here; the others are unchanged. The stage should be initialized
+/// again afterward.
+///
+/// @see  memoryRequirement
+///
+template <class _Derived>
+void StageWrapper<_Derived>::fitMemory(
+    const std::size_t limit
+) noexcept {
+  derived().fitMemoryImpl(limit);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  memoryRequirement
+///
+template <class _Derived>
+std::size_t StageWrapper<_Derived>::memoryRequirementImpl() const noexcept {
+  return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  fitMemory
+///
+template <class _Derived>
+void StageWrapper<_Derived>::fitMemoryImpl(
+    const std::size_t limit
+) noexcept {
+  static_cast<void>(limit);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Record the starting time.
 ///
@@ -191,6 +336,29 @@ void StageWrapper<_Derived>::toc(
   comm_time = 0.0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Traces each part of the stage.
+///
+/// @param  offset  The offset from the moments to the timestamps of the tracer.
+///
+template <class _Derived>
+void StageWrapper<_Derived>::tracePhases(
+    const double offset
+) const noexcept {
+  auto &tracer = utility::Tracer::instance();
+  if ( !tracer.isEnabled() ) {
+    return;
+  }
+
+  const std::string names = this->names();
+  std::string::size_type head = 0;
+  for ( std::size_t i = 1; i < moments_.size(); ++i ) {
+    auto tail = names.find(" / ", head);
+    tracer.record(names.substr(head, tail-head), "phase", moments_[i-1]+offset, moments_[i]+offset);
+    head = (tail == std::string::npos) ? names.size() : tail+3;
+  }
+}
+
 }  // namespace isvd
 
 }  // namespace mcnla
@@ -16,6 +16,8 @@
 #include <mcnla/isvd/former/row_block_gramian_former.hpp>
 #include <mcnla/isvd/former/col_block_gramian_former.hpp>
 
+#include <mcnla/isvd/former/row_block_tsqr_former.hpp>
+
 #include <mcnla/isvd/former/row_block_symmetric_former.hpp>
 
 #endif  // MCNLA_ISVD_FORMER_HPP_
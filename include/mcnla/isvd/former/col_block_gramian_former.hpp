@@ -64,6 +64,25 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   vector_s_cut_  = vector_s_({0, rank});
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val, bool _jobv>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t nrow       = parameters_.nrow();
+  const std::size_t ncol_rank  = parameters_.ncolRank();
+  const std::size_t ncol_each  = parameters_.ncolEach();
+  const std::size_t dim_sketch = parameters_.dimSketch();
+  const std::size_t rank       = parameters_.rank();
+
+  auto nelem = dim_sketch * dim_sketch + dim_sketch + ncol_rank * dim_sketch + nrow * rank;
+  if ( _jobv ) {
+    nelem += ncol_each * rank;
+  }
+  return sizeof(_Val) * nelem;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Forms SVD.
 ///
@@ -76,7 +95,6 @@ void MCNLA_ALIAS::runImpl(
     const DenseMatrixRowMajor<_Val> &matrix_q
 ) noexcept {
 
-  const auto mpi_comm   = parameters_.mpi_comm;
   const auto nrow       = parameters_.nrow();
   const auto ncol_rank  = parameters_.ncolRank();
   const auto dim_sketch = parameters_.dimSketch();
@@ -103,7 +121,7 @@ void MCNLA_ALIAS::runImpl(
   // W := Z' * Z
   la::mm(matrix_zj_.t(), matrix_zj_, matrix_w_);
   comm_moment = utility::getTime();
-  mpi::allreduce(matrix_w_, MPI_SUM, mpi_comm);
+  parameters_.allreduce(matrix_w_, MPI_SUM);
   comm_time += utility::getTime() - comm_moment;
 
   // eig(W) = W * S * W'
@@ -63,6 +63,24 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   vector_s_cut_ = vector_s_({0, rank});
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val, bool _jobv>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t nrow       = parameters_.nrow();
+  const std::size_t ncol       = parameters_.ncol();
+  const std::size_t dim_sketch = parameters_.dimSketch();
+  const std::size_t rank       = parameters_.rank();
+
+  auto nelem = dim_sketch * dim_sketch + dim_sketch + ncol * dim_sketch + nrow * rank;
+  if ( _jobv ) {
+    nelem += ncol * rank;
+  }
+  return sizeof(_Val) * nelem;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Forms SVD.
 ///
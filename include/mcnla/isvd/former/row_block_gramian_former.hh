@@ -39,6 +39,9 @@ template <typename _Val, bool _jobv = false> using RowBlockGramianFormer = Forme
 /// @ingroup  isvd_former_module
 /// The Gramian former (row-block version).
 ///
+/// Only the leading @c rank eigenpairs of the Gramian matrix W = Z' * Z are computed. In values-only mode, the singular
+/// vectors are not formed.
+///
 /// @tparam  _Val  The value type.
 ///
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -64,11 +67,14 @@ class MCNLA_ALIAS1
   /// The name of each part of the stage.
   static constexpr const char* names_ = "Projection / eigen / forming";
 
+  /// The values-only mode.
+  bool values_only_ = false;
+
   /// The matrix W.
-  DenseMatrixRowMajor<_Val> matrix_w_;
+  DenseSymmetricMatrixRowMajor<_Val> symatrix_w_;
 
-  /// The cut matrix W.
-  DenseMatrixRowMajor<_Val> matrix_w_cut_;
+  /// The cut matrix W' (the leading eigenvectors are stored rowwise).
+  DenseMatrixRowMajor<_Val> matrix_wt_cut_;
 
   /// The vector S.
   DenseVector<RealValT<_Val>> vector_s_;
@@ -88,11 +94,8 @@ class MCNLA_ALIAS1
   /// The matrix Z (row-block).
   DenseMatrixRowMajor<_Val> matrix_zj_;
 
-  /// The empty matrix.
-  DenseMatrixRowMajor<_Val> matrix_empty_;
-
-  /// The GESVD driver.
-  la::DenseGesvdDriverRowMajor<'O', 'N', _Val> gesvd_driver_;
+  /// The SYEVR driver.
+  la::DenseSyevrDriverRowMajor<'V', _Val> syevr_driver_;
 
   using BaseType::parameters_;
   using BaseType::initialized_;
@@ -105,6 +108,12 @@ class MCNLA_ALIAS1
   // Constructor
   inline MCNLA_ALIAS0( const Parameters<_Val> &parameters ) noexcept;
 
+  // Gets parameters
+  inline bool isValuesOnly() const noexcept;
+
+  // Sets parameters
+  inline MCNLA_ALIAS1& setValuesOnly( const bool values_only ) noexcept;
+
   // Gets matrices
   inline const DenseVector<RealValT<_Val>>& vectorS() const noexcept;
   inline const DenseMatrixRowMajor<_Val>& matrixUj() const noexcept;
@@ -115,6 +124,9 @@ class MCNLA_ALIAS1
   // Initializes
   void initializeImpl() noexcept;
 
+  // Gets memory requirement
+  inline std::size_t memoryRequirementImpl() const noexcept;
+
   // Forms SVD
   template <class _Matrix>
   void runImpl( const _Matrix &matrix_a, const DenseMatrixRowMajor<_Val> &matrix_q ) noexcept;
@@ -53,22 +53,46 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   const auto dim_sketch = parameters_.dimSketch();
   const auto rank       = parameters_.rank();
 
-  matrix_w_.reconstruct(dim_sketch, dim_sketch);
+  symatrix_w_.reconstruct(dim_sketch);
+  matrix_wt_cut_.reconstruct(rank, dim_sketch);
   vector_s_.reconstruct(dim_sketch);
-  gesvd_driver_.reconstruct(dim_sketch, dim_sketch);
+  syevr_driver_.reconstruct(dim_sketch, rank);
 
   matrix_z_.reconstruct(ncol_total, dim_sketch); matrix_z_.resize(ncol, ""_);
   matrix_zj_.reconstruct(ncol_each, dim_sketch); matrix_zj_.resize(ncol_rank, ""_);
 
-  matrix_uj_cut_.reconstruct(nrow_each, rank);   matrix_uj_cut_.resize(nrow_rank, ""_);
-  if ( _jobv ) {
-    matrix_vj_cut_.reconstruct(ncol_each, rank); matrix_vj_cut_.resize(ncol_rank, ""_);
+  if ( !values_only_ ) {
+    matrix_uj_cut_.reconstruct(nrow_each, rank);   matrix_uj_cut_.resize(nrow_rank, ""_);
+    if ( _jobv ) {
+      matrix_vj_cut_.reconstruct(ncol_each, rank); matrix_vj_cut_.resize(ncol_rank, ""_);
+    }
   }
 
-  matrix_w_cut_  = matrix_w_(""_, {0, rank});
   vector_s_cut_  = vector_s_({0, rank});
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val, bool _jobv>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t nrow_each  = parameters_.nrowEach();
+  const std::size_t ncol_each  = parameters_.ncolEach();
+  const std::size_t ncol_total = parameters_.ncolTotal();
+  const std::size_t dim_sketch = parameters_.dimSketch();
+  const std::size_t rank       = parameters_.rank();
+
+  auto nelem = dim_sketch * dim_sketch + rank * dim_sketch + dim_sketch + (ncol_total + ncol_each) * dim_sketch;
+  if ( !values_only_ ) {
+    nelem += nrow_each * rank;
+    if ( _jobv ) {
+      nelem += ncol_each * rank;
+    }
+  }
+  return sizeof(_Val) * nelem;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Forms SVD.
 ///
@@ -116,16 +140,21 @@ void MCNLA_ALIAS::runImpl(
   // Compute eigen-decomposition
 
   // W := Z' * Z
-  la::mm(matrix_zj_.t(), matrix_zj_, matrix_w_);
+  la::memset0(symatrix_w_.full());
+  la::rk(matrix_zj_.t(), symatrix_w_);
   comm_moment = utility::getTime();
-  mpi::allreduce(matrix_w_, MPI_SUM, mpi_comm);
+  parameters_.allreduce(symatrix_w_.full(), MPI_SUM);
   comm_time += utility::getTime() - comm_moment;
 
-  // eig(W) = W * S * W'
-  gesvd_driver_(matrix_w_, vector_s_, matrix_empty_, matrix_empty_);
+  // eig(W) = W * S * W' (leading part only)
+  if ( !values_only_ ) {
+    syevr_driver_(symatrix_w_, vector_s_, matrix_wt_cut_);
+  } else {
+    syevr_driver_.computeValues(symatrix_w_, vector_s_);
+  }
 
   // S := sqrt(S)
-  for ( auto &v : vector_s_ ) {
+  for ( auto &v : vector_s_cut_ ) {
     v = std::sqrt(v);
   }
 
@@ -133,18 +162,44 @@ void MCNLA_ALIAS::runImpl(
   // ====================================================================================================================== //
   // Form singular vectors
 
-  // U := Q * W
-  la::mm(matrix_qj, matrix_w_cut_, matrix_uj_cut_);
+  if ( !values_only_ ) {
+
+    // U := Q * W
+    la::mm(matrix_qj, matrix_wt_cut_.t(), matrix_uj_cut_);
 
-  if ( _jobv ) {
-    // V := Z * W * inv(S)
-    la::mm(matrix_zj_, matrix_w_cut_, matrix_vj_cut_);
-    la::sm(matrix_vj_cut_, vector_s_cut_.diag().inv());
+    if ( _jobv ) {
+      // V := Z * W * inv(S)
+      la::mm(matrix_zj_, matrix_wt_cut_.t(), matrix_vj_cut_);
+      la::sm(matrix_vj_cut_, vector_s_cut_.diag().inv());
+    }
   }
 
   this->toc(comm_time);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Determines if the former is in values-only mode.
+///
+template <typename _Val, bool _jobv>
+bool MCNLA_ALIAS::isValuesOnly() const noexcept {
+  return values_only_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the values-only mode.
+///
+/// In values-only mode, only the singular values are computed, and #matrixUj and #matrixVj are unavailable.
+///
+template <typename _Val, bool _jobv>
+MCNLA_ALIAS& MCNLA_ALIAS::setValuesOnly(
+    const bool values_only
+) noexcept {
+  values_only_ = values_only;
+  initialized_ = false;
+  computed_ = false;
+  return *this;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Gets the singular values.
 ///
@@ -160,6 +215,7 @@ const DenseVector<RealValT<_Val>>& MCNLA_ALIAS::vectorS() const noexcept {
 template <typename _Val, bool _jobv>
 const DenseMatrixRowMajor<_Val>& MCNLA_ALIAS::matrixUj() const noexcept {
   mcnla_assert_true(this->isComputed());
+  mcnla_assert_false(values_only_);
   return matrix_uj_cut_;
 }
 
@@ -170,6 +226,7 @@ template <typename _Val, bool _jobv>
 const DenseMatrixRowMajor<_Val>& MCNLA_ALIAS::matrixVj() const noexcept {
   mcnla_assert_true(this->isComputed());
   mcnla_assert_true(_jobv);
+  mcnla_assert_false(values_only_);
   return matrix_vj_cut_;
 }
 
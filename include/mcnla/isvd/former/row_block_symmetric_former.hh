@@ -112,6 +112,9 @@ class MCNLA_ALIAS1
   // Initializes
   void initializeImpl() noexcept;
 
+  // Gets memory requirement
+  inline std::size_t memoryRequirementImpl() const noexcept;
+
   // Forms SVD
   template <class _Matrix>
   void runImpl( const _Matrix &matrix_a, const DenseMatrixRowMajor<_Val> &matrix_q ) noexcept;
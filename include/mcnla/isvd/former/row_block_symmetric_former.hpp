@@ -5,8 +5,8 @@
 /// @author  Mu Yang <<emfomy@gmail.com>>
 ///
 
-#ifndef MCNLA_ISVD_FORMER_ROW_BLOCK_GRAMIAN_FORMER_HPP_
-#define MCNLA_ISVD_FORMER_ROW_BLOCK_GRAMIAN_FORMER_HPP_
+#ifndef MCNLA_ISVD_FORMER_ROW_BLOCK_SYMMETRIC_FORMER_HPP_
+#define MCNLA_ISVD_FORMER_ROW_BLOCK_SYMMETRIC_FORMER_HPP_
 
 #include <mcnla/isvd/former/row_block_symmetric_former.hh>
 #include <mcnla/core/la.hpp>
@@ -54,6 +54,8 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
 
   mcnla_assert_eq(nrow, ncol);
 
+  static_cast<void>(ncol);
+
   matrix_w_.reconstruct(dim_sketch, dim_sketch);
   vector_s_.reconstruct(dim_sketch);
   syev_driver_.reconstruct(dim_sketch);
@@ -66,6 +68,20 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   vector_s_cut_  = vector_s_({dim_sketch-rank, dim_sketch});
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val, bool _jobv>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t nrow_each  = parameters_.nrowEach();
+  const std::size_t nrow_total = parameters_.nrowTotal();
+  const std::size_t dim_sketch = parameters_.dimSketch();
+  const std::size_t rank       = parameters_.rank();
+
+  return sizeof(_Val) * (dim_sketch * dim_sketch + dim_sketch + (nrow_total + nrow_each) * dim_sketch + nrow_each * rank);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Forms eigenvalue decomposition.
 ///
@@ -92,6 +108,7 @@ void MCNLA_ALIAS::runImpl(
 
   static_cast<void>(nrow);
   static_cast<void>(nrow_rank);
+  static_cast<void>(ncol);
   static_cast<void>(dim_sketch);
 
   mcnla_assert_eq(matrix_aj.sizes(), std::make_tuple(nrow_rank, nrow));
@@ -120,7 +137,7 @@ void MCNLA_ALIAS::runImpl(
   // W := Z' * Q
   la::mm(matrix_zj_.t(), matrix_qj, matrix_w_.sym());
   comm_moment = utility::getTime();
-  mpi::allreduce(matrix_w_, MPI_SUM, mpi_comm);
+  parameters_.allreduce(matrix_w_, MPI_SUM);
   comm_time += utility::getTime() - comm_moment;
 
   // eig(W) = W * S * W'
@@ -154,6 +171,19 @@ const DenseMatrixRowMajor<_Val>& MCNLA_ALIAS::matrixUj() const noexcept {
   return matrix_uj_cut_;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the right eigenvectors (row-block).
+///
+/// Since the matrix A is symmetric, the right eigenvectors are the same as the left ones.
+///
+/// @attention  The eigenvalues are sorted in ascending order.
+///
+template <typename _Val, bool _jobv>
+const DenseMatrixRowMajor<_Val>& MCNLA_ALIAS::matrixVj() const noexcept {
+  mcnla_assert_true(this->isComputed());
+  return matrix_uj_cut_;
+}
+
 }  // namespace isvd
 
 }  // namespace mcnla
@@ -161,4 +191,4 @@ const DenseMatrixRowMajor<_Val>& MCNLA_ALIAS::matrixUj() const noexcept {
 #undef MCNLA_ALIAS
 #undef MCNLA_ALIAS0
 
-#endif  // MCNLA_ISVD_FORMER_ROW_BLOCK_GRAMIAN_FORMER_HPP_
+#endif  // MCNLA_ISVD_FORMER_ROW_BLOCK_SYMMETRIC_FORMER_HPP_
@@ -0,0 +1,189 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/isvd/former/row_block_tsqr_former.hh
+/// @brief   The definition of TSQR former (row-block version).
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_ISVD_FORMER_ROW_BLOCK_TSQR_FORMER_HH_
+#define MCNLA_ISVD_FORMER_ROW_BLOCK_TSQR_FORMER_HH_
+
+#include <mcnla/isvd/def.hpp>
+#include <mcnla/isvd/former/former.hpp>
+#include <mcnla/core/la.hpp>
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+  #define MCNLA_ALIAS0 Former
+  #define MCNLA_ALIAS1 Former<RowBlockTsqrFormerTag<_jobv>, _Val>
+#else  // DOXYGEN_SHOULD_SKIP_THIS
+  #define MCNLA_ALIAS0 RowBlockTsqrFormer
+  #define MCNLA_ALIAS1 RowBlockTsqrFormer
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The iSVD namespace.
+//
+namespace isvd {
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <bool _jobv> struct RowBlockTsqrFormerTag {};
+template <typename _Val, bool _jobv = false> using RowBlockTsqrFormer = Former<RowBlockTsqrFormerTag<_jobv>, _Val>;
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  isvd_former_module
+/// The TSQR former (row-block version).
+///
+/// Forms the SVD by the Rayleigh-Ritz procedure. The matrix Z = A' * Q is factorized by a tall-skinny QR (TSQR), and the
+/// singular vectors are recovered from the SVD of the small triangular factor R. Unlike the Gramian former, Z' * Z is never
+/// formed, so the accuracy of the small singular values is not lost by squaring.
+///
+/// Optionally, the basis Q is refined by some power iterations Q := orth(A * A' * Q) before forming.
+///
+/// @tparam  _Val  The value type.
+///
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val, bool _jobv>
+#else  // DOXYGEN_SHOULD_SKIP_THIS
+template <typename _Val, bool _jobv = false>
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+class MCNLA_ALIAS1
+  : public StageWrapper<RowBlockTsqrFormer<_Val, _jobv>> {
+
+  friend StageWrapper<RowBlockTsqrFormer<_Val, _jobv>>;
+
+ private:
+
+  using BaseType = StageWrapper<RowBlockTsqrFormer<_Val, _jobv>>;
+
+ protected:
+
+  /// The name.
+  static constexpr const char* name_ = _jobv ? "TSQR Former (Row-Block Version)"
+                                             : "TSQR Former (Row-Block Version) (without V)";
+
+  /// The name of each part of the stage.
+  static constexpr const char* names_ = "Projection / QR / forming";
+
+  /// The number of refinement iterations.
+  index_t num_refinement_;
+
+  /// The matrix Q (row-block).
+  DenseMatrixRowMajor<_Val> matrix_qj_;
+
+  /// The matrix Y (row-block).
+  DenseMatrixRowMajor<_Val> matrix_yj_;
+
+  /// The matrix Z.
+  DenseMatrixRowMajor<_Val> matrix_z_;
+
+  /// The matrix Z (row-block).
+  DenseMatrixRowMajor<_Val> matrix_zj_;
+
+  /// The matrix R (row-block).
+  DenseMatrixRowMajor<_Val> matrix_rj_;
+
+  /// The stacked matrix R.
+  DenseMatrixRowMajor<_Val> matrix_rs_;
+
+  /// The matrix R.
+  DenseMatrixRowMajor<_Val> matrix_r_;
+
+  /// The vector tau.
+  DenseVector<_Val> vector_tau_;
+
+  /// The matrix W (left singular vectors of R).
+  DenseMatrixRowMajor<_Val> matrix_w_;
+
+  /// The matrix Wt (right singular vectors of R).
+  DenseMatrixRowMajor<_Val> matrix_wt_;
+
+  /// The cut matrix W.
+  DenseMatrixRowMajor<_Val> matrix_w_cut_;
+
+  /// The cut matrix Wt.
+  DenseMatrixRowMajor<_Val> matrix_wt_cut_;
+
+  /// The vector S.
+  DenseVector<RealValT<_Val>> vector_s_;
+
+  /// The cut vector S.
+  DenseVector<RealValT<_Val>> vector_s_cut_;
+
+  /// The cut matrix U (row-block).
+  DenseMatrixRowMajor<_Val> matrix_uj_cut_;
+
+  /// The cut matrix V (row-block).
+  DenseMatrixRowMajor<_Val> matrix_vj_cut_;
+
+  /// The empty matrix.
+  DenseMatrixRowMajor<_Val> matrix_empty_;
+
+  /// The GEQRFG driver of Y (row-block).
+  la::DenseGeqrfgDriverRowMajor<'O', 'S', _Val> geqrfg_driver_yj_;
+
+  /// The GEQRFG driver of Z (row-block).
+  la::DenseGeqrfgDriverRowMajor<'O', 'S', _Val> geqrfg_driver_zj_;
+
+  /// The GEQRFG driver of the stacked R.
+  la::DenseGeqrfgDriverRowMajor<'O', 'S', _Val> geqrfg_driver_rs_;
+
+  /// The GESVD driver.
+  la::DenseGesvdDriverRowMajor<'S', 'S', _Val> gesvd_driver_;
+
+  using BaseType::parameters_;
+  using BaseType::initialized_;
+  using BaseType::computed_;
+  using BaseType::moments_;
+  using BaseType::comm_times_;
+
+ public:
+
+  // Constructor
+  inline MCNLA_ALIAS0( const Parameters<_Val> &parameters, const index_t num_refinement = 0 ) noexcept;
+
+  // Gets parameters
+  inline index_t numRefinement() const noexcept;
+
+  // Sets parameters
+  inline MCNLA_ALIAS1& setNumRefinement( const index_t num_refinement ) noexcept;
+
+  // Gets matrices
+  inline const DenseVector<RealValT<_Val>>& vectorS() const noexcept;
+  inline const DenseMatrixRowMajor<_Val>& matrixUj() const noexcept;
+  inline const DenseMatrixRowMajor<_Val>& matrixVj() const noexcept;
+
+ protected:
+
+  // Initializes
+  void initializeImpl() noexcept;
+
+  // Gets memory requirement
+  inline std::size_t memoryRequirementImpl() const noexcept;
+
+  // Forms SVD
+  template <class _Matrix>
+  void runImpl( const _Matrix &matrix_a, const DenseMatrixRowMajor<_Val> &matrix_q ) noexcept;
+
+  // Computes TSQR
+  inline void tsqrR( DenseMatrixRowMajor<_Val> &matrix_xj, la::DenseGeqrfgDriverRowMajor<'O', 'S', _Val> &driver,
+                     double &comm_time ) noexcept;
+  inline void tsqrQ( const DenseMatrixRowMajor<_Val> &matrix_xj, DenseMatrixRowMajor<_Val> &matrix_qj ) noexcept;
+  inline void tsqrQ( const DenseMatrixRowMajor<_Val> &matrix_xj, const DenseMatrixRowMajor<_Val> &matrix_c,
+                     DenseMatrixRowMajor<_Val> &matrix_qj ) noexcept;
+
+};
+
+}  // namespace isvd
+
+}  // namespace mcnla
+
+#undef MCNLA_ALIAS0
+#undef MCNLA_ALIAS1
+
+#endif  // MCNLA_ISVD_FORMER_ROW_BLOCK_TSQR_FORMER_HH_
@@ -0,0 +1,362 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/isvd/former/row_block_tsqr_former.hpp
+/// @brief   The TSQR former (row-block version).
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_ISVD_FORMER_ROW_BLOCK_TSQR_FORMER_HPP_
+#define MCNLA_ISVD_FORMER_ROW_BLOCK_TSQR_FORMER_HPP_
+
+#include <mcnla/isvd/former/row_block_tsqr_former.hh>
+#include <mcnla/core/la.hpp>
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+  #define MCNLA_ALIAS  Former<RowBlockTsqrFormerTag<_jobv>, _Val>
+  #define MCNLA_ALIAS0 Former
+#else  // DOXYGEN_SHOULD_SKIP_THIS
+  #define MCNLA_ALIAS  RowBlockTsqrFormer<_Val, _jobv>
+  #define MCNLA_ALIAS0 RowBlockTsqrFormer
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The iSVD namespace.
+//
+namespace isvd {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::StageWrapper
+///
+/// @param  num_refinement  The number of refinement iterations.
+///
+template <typename _Val, bool _jobv>
+MCNLA_ALIAS::MCNLA_ALIAS0(
+    const Parameters<_Val> &parameters,
+    const index_t num_refinement
+) noexcept
+  : BaseType(parameters) {
+  setNumRefinement(num_refinement);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::initialize
+///
+template <typename _Val, bool _jobv>
+void MCNLA_ALIAS::initializeImpl() noexcept {
+
+  const auto mpi_size   = parameters_.mpi_size;
+  const auto nrow_rank  = parameters_.nrowRank();
+  const auto nrow_each  = parameters_.nrowEach();
+  const auto ncol       = parameters_.ncol();
+  const auto ncol_rank  = parameters_.ncolRank();
+  const auto ncol_each  = parameters_.ncolEach();
+  const auto ncol_total = parameters_.ncolTotal();
+  const auto dim_sketch = parameters_.dimSketch();
+  const auto rank       = parameters_.rank();
+
+  if ( num_refinement_ > 0 ) {
+    matrix_qj_.reconstruct(nrow_rank, dim_sketch);
+    matrix_yj_.reconstruct(nrow_rank, dim_sketch);
+    if ( nrow_rank >= dim_sketch ) {
+      geqrfg_driver_yj_.reconstruct(nrow_rank, dim_sketch);
+    }
+  }
+
+  matrix_z_.reconstruct(ncol_total, dim_sketch); matrix_z_.resize(ncol, ""_);
+  matrix_zj_.reconstruct(ncol_each, dim_sketch); matrix_zj_.resize(ncol_rank, ""_);
+  if ( ncol_rank >= dim_sketch ) {
+    geqrfg_driver_zj_.reconstruct(ncol_rank, dim_sketch);
+  }
+
+  matrix_rj_.reconstruct(dim_sketch, dim_sketch);
+  matrix_rs_.reconstruct(dim_sketch * mpi_size, dim_sketch);
+  matrix_r_.reconstruct(dim_sketch, dim_sketch);
+  vector_tau_.reconstruct(dim_sketch);
+  geqrfg_driver_rs_.reconstruct(dim_sketch * mpi_size, dim_sketch);
+
+  matrix_w_.reconstruct(dim_sketch, dim_sketch);
+  matrix_wt_.reconstruct(dim_sketch, dim_sketch);
+  vector_s_.reconstruct(dim_sketch);
+  gesvd_driver_.reconstruct(dim_sketch, dim_sketch);
+
+  matrix_uj_cut_.reconstruct(nrow_each, rank);   matrix_uj_cut_.resize(nrow_rank, ""_);
+  if ( _jobv ) {
+    matrix_vj_cut_.reconstruct(ncol_each, rank); matrix_vj_cut_.resize(ncol_rank, ""_);
+  }
+
+  matrix_w_cut_  = matrix_w_(""_, {0, rank});
+  matrix_wt_cut_ = matrix_wt_({0, rank}, ""_);
+  vector_s_cut_  = vector_s_({0, rank});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val, bool _jobv>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t mpi_size   = parameters_.mpi_size;
+  const std::size_t nrow_rank  = parameters_.nrowRank();
+  const std::size_t nrow_each  = parameters_.nrowEach();
+  const std::size_t ncol_each  = parameters_.ncolEach();
+  const std::size_t ncol_total = parameters_.ncolTotal();
+  const std::size_t dim_sketch = parameters_.dimSketch();
+  const std::size_t rank       = parameters_.rank();
+
+  auto nelem = (ncol_total + ncol_each) * dim_sketch + (mpi_size + 4) * dim_sketch * dim_sketch + 2 * dim_sketch
+             + nrow_each * rank;
+  if ( num_refinement_ > 0 ) {
+    nelem += 2 * nrow_rank * dim_sketch;
+  }
+  if ( _jobv ) {
+    nelem += ncol_each * rank;
+  }
+  return sizeof(_Val) * nelem;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Forms SVD.
+///
+/// @param  matrix_aj  The matrix Aj (j-th row-block, where j is the MPI rank).
+/// @param  matrix_qj  The matrix Qbarj (j-th row-block, where j is the MPI rank).
+///
+template <typename _Val, bool _jobv> template <class _Matrix>
+void MCNLA_ALIAS::runImpl(
+    const _Matrix &matrix_aj,
+    const DenseMatrixRowMajor<_Val> &matrix_qj
+) noexcept {
+
+  const auto mpi_comm   = parameters_.mpi_comm;
+  const auto nrow_rank  = parameters_.nrowRank();
+  const auto ncol       = parameters_.ncol();
+  const auto ncol_each  = parameters_.ncolEach();
+  const auto ncol_total = parameters_.ncolTotal();
+  const auto dim_sketch = parameters_.dimSketch();
+
+  static_cast<void>(nrow_rank);
+  static_cast<void>(ncol);
+  static_cast<void>(dim_sketch);
+
+  mcnla_assert_eq(matrix_aj.sizes(), std::make_tuple(nrow_rank, ncol));
+  mcnla_assert_eq(matrix_qj.sizes(), std::make_tuple(nrow_rank, dim_sketch));
+
+  auto matrix_z_full = matrix_z_;
+  matrix_z_full.resize(ncol_total, ""_);
+  auto matrix_zj_full = matrix_zj_;
+  matrix_zj_full.resize(ncol_each, ""_);
+
+  const DenseMatrixRowMajor<_Val> &matrix_qbj = (num_refinement_ > 0) ? matrix_qj_ : matrix_qj;
+
+  double comm_moment, comm_time;
+  this->tic(comm_time);
+  // ====================================================================================================================== //
+  // Projection
+
+  if ( num_refinement_ > 0 ) {
+    la::copy(matrix_qj, matrix_qj_);
+  }
+
+  for ( index_t i = 0; i < num_refinement_; ++i ) {
+
+    // Z := A' * Q
+    la::mm(matrix_aj.t(), matrix_qj_, matrix_z_);
+    comm_moment = utility::getTime();
+    parameters_.allreduce(matrix_z_, MPI_SUM);
+    comm_time += utility::getTime() - comm_moment;
+
+    // Y := A * Z
+    la::mm(matrix_aj, matrix_z_, matrix_yj_);
+
+    // Q := orth(Y)
+    tsqrR(matrix_yj_, geqrfg_driver_yj_, comm_time);
+    tsqrQ(matrix_yj_, matrix_qj_);
+  }
+
+  // Z := A' * Q
+  la::mm(matrix_aj.t(), matrix_qbj, matrix_z_);
+  comm_moment = utility::getTime();
+  mpi::reduceScatterBlock(matrix_z_full, matrix_zj_full, MPI_SUM, mpi_comm);
+  comm_time += utility::getTime() - comm_moment;
+
+  this->toc(comm_time);
+  // ====================================================================================================================== //
+  // Compute QR decomposition
+
+  // Z = Qz * R
+  tsqrR(matrix_zj_, geqrfg_driver_zj_, comm_time);
+
+  // svd(R) = W * S * Wt
+  gesvd_driver_(matrix_r_, vector_s_, matrix_w_, matrix_wt_);
+
+  this->toc(comm_time);
+  // ====================================================================================================================== //
+  // Form singular vectors
+
+  // U := Q * Wt'
+  la::mm(matrix_qbj, matrix_wt_cut_.t(), matrix_uj_cut_);
+
+  if ( _jobv ) {
+    // V := Qz * W
+    tsqrQ(matrix_zj_, matrix_w_cut_, matrix_vj_cut_);
+  }
+
+  this->toc(comm_time);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Computes the triangular factor of the TSQR.
+///
+/// Each process factorizes its row-block Xj = Qj * Rj locally. The factors Rj are gathered, stacked, and factorized again
+/// to R. The local factor Qj is stored in @a matrix_xj, and the factor of the stacked Rj is stored in #matrix_rs_.
+///
+/// @param  matrix_xj  The matrix Xj (j-th row-block, where j is the MPI rank); replaced by the local factor.
+/// @param  driver     The GEQRFG driver of Xj.
+/// @param  comm_time  The communication time.
+///
+template <typename _Val, bool _jobv>
+void MCNLA_ALIAS::tsqrR(
+    DenseMatrixRowMajor<_Val> &matrix_xj,
+    la::DenseGeqrfgDriverRowMajor<'O', 'S', _Val> &driver,
+    double &comm_time
+) noexcept {
+
+  const auto mpi_comm   = parameters_.mpi_comm;
+  const auto dim_sketch = parameters_.dimSketch();
+
+  // Rj := R of Xj (or Xj itself if Xj is not tall)
+  la::memset0(matrix_rj_);
+  if ( matrix_xj.nrow() >= dim_sketch ) {
+    driver(matrix_xj, vector_tau_, matrix_empty_, matrix_rj_);
+  } else {
+    la::copy(matrix_xj, matrix_rj_({0, matrix_xj.nrow()}, ""_));
+  }
+
+  // Stacks Rj
+  const double comm_moment = utility::getTime();
+  mpi::allgather(matrix_rj_, matrix_rs_, mpi_comm);
+  comm_time += utility::getTime() - comm_moment;
+
+  // R := R of stacked Rj
+  la::memset0(matrix_r_);
+  geqrfg_driver_rs_(matrix_rs_, vector_tau_, matrix_empty_, matrix_r_);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Forms the orthogonal factor of the TSQR.
+///
+/// @param  matrix_xj  The local factor computed by #tsqrR.
+/// @param  matrix_qj  The orthogonal factor Qj (j-th row-block, where j is the MPI rank).
+///
+template <typename _Val, bool _jobv>
+void MCNLA_ALIAS::tsqrQ(
+    const DenseMatrixRowMajor<_Val> &matrix_xj,
+          DenseMatrixRowMajor<_Val> &matrix_qj
+) noexcept {
+
+  const auto mpi_rank   = parameters_.mpi_rank;
+  const auto dim_sketch = parameters_.dimSketch();
+
+  auto matrix_rsj = matrix_rs_({dim_sketch * mpi_rank, dim_sketch * (mpi_rank+1)}, ""_);
+
+  if ( matrix_xj.nrow() >= dim_sketch ) {
+    la::mm(matrix_xj, matrix_rsj, matrix_qj);
+  } else {
+    la::copy(matrix_rsj({0, matrix_xj.nrow()}, ""_), matrix_qj);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Forms the orthogonal factor of the TSQR multiplied by a small matrix.
+///
+/// @param  matrix_xj  The local factor computed by #tsqrR.
+/// @param  matrix_c   The small matrix C.
+/// @param  matrix_qj  The matrix Qj * C (j-th row-block, where j is the MPI rank).
+///
+template <typename _Val, bool _jobv>
+void MCNLA_ALIAS::tsqrQ(
+    const DenseMatrixRowMajor<_Val> &matrix_xj,
+    const DenseMatrixRowMajor<_Val> &matrix_c,
+          DenseMatrixRowMajor<_Val> &matrix_qj
+) noexcept {
+
+  const auto mpi_rank   = parameters_.mpi_rank;
+  const auto dim_sketch = parameters_.dimSketch();
+
+  auto matrix_rsj = matrix_rs_({dim_sketch * mpi_rank, dim_sketch * (mpi_rank+1)}, ""_);
+  auto matrix_rc  = matrix_rj_(""_, {0, matrix_c.ncol()});
+
+  // Multiplies the small factors first
+  la::mm(matrix_rsj, matrix_c, matrix_rc);
+
+  if ( matrix_xj.nrow() >= dim_sketch ) {
+    la::mm(matrix_xj, matrix_rc, matrix_qj);
+  } else {
+    la::copy(matrix_rc({0, matrix_xj.nrow()}, ""_), matrix_qj);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of refinement iterations.
+///
+template <typename _Val, bool _jobv>
+index_t MCNLA_ALIAS::numRefinement() const noexcept {
+  return num_refinement_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the number of refinement iterations.
+///
+/// Each refinement iteration replaces Q by orth(A * A' * Q).
+///
+template <typename _Val, bool _jobv>
+MCNLA_ALIAS& MCNLA_ALIAS::setNumRefinement(
+    const index_t num_refinement
+) noexcept {
+  mcnla_assert_ge(num_refinement, 0);
+  num_refinement_ = num_refinement;
+  initialized_ = false;
+  computed_ = false;
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the singular values.
+///
+template <typename _Val, bool _jobv>
+const DenseVector<RealValT<_Val>>& MCNLA_ALIAS::vectorS() const noexcept {
+  mcnla_assert_true(this->isComputed());
+  return vector_s_cut_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the left singular vectors (row-block).
+///
+template <typename _Val, bool _jobv>
+const DenseMatrixRowMajor<_Val>& MCNLA_ALIAS::matrixUj() const noexcept {
+  mcnla_assert_true(this->isComputed());
+  return matrix_uj_cut_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the right singular vectors (row-block).
+///
+template <typename _Val, bool _jobv>
+const DenseMatrixRowMajor<_Val>& MCNLA_ALIAS::matrixVj() const noexcept {
+  mcnla_assert_true(this->isComputed());
+  mcnla_assert_true(_jobv);
+  return matrix_vj_cut_;
+}
+
+}  // namespace isvd
+
+}  // namespace mcnla
+
+#undef MCNLA_ALIAS
+#undef MCNLA_ALIAS0
+
+#endif  // MCNLA_ISVD_FORMER_ROW_BLOCK_TSQR_FORMER_HPP_
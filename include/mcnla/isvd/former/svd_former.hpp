@@ -61,6 +61,20 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   matrix_vt_cut_ = matrix_vt_({0_i, rank}, ""_);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val, bool _jobv>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t nrow       = parameters_.nrow();
+  const std::size_t ncol       = parameters_.ncol();
+  const std::size_t dim_sketch = parameters_.dimSketch();
+  const std::size_t rank       = parameters_.rank();
+
+  return sizeof(_Val) * (dim_sketch * dim_sketch + dim_sketch + dim_sketch * ncol + nrow * rank);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Forms SVD.
 ///
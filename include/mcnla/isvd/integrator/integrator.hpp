@@ -10,6 +10,7 @@
 
 #include <mcnla/isvd/def.hpp>
 #include <mcnla/isvd/core/stage_wrapper.hpp>
+#include <mcnla/isvd/integrator/iteration_monitor.hpp>
 #include <mcnla/core/utility/traits.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/isvd/integrator/iteration_monitor.hh
+/// @brief   The definition of iSVD integrator iteration monitor.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_ISVD_INTEGRATOR_ITERATION_MONITOR_HH_
+#define MCNLA_ISVD_INTEGRATOR_ITERATION_MONITOR_HH_
+
+#include <mcnla/isvd/def.hpp>
+#include <functional>
+#include <vector>
+#include <mcnla/core/utility/traits.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The iSVD namespace.
+//
+namespace isvd {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  isvd_integrator_module
+/// The record of an integrator iteration.
+///
+/// @tparam  _Val  The value type.
+///
+template <typename _Val>
+struct IterationRecord {
+
+  /// The index of the iteration.
+  index_t iteration;
+
+  /// The residual of the convergence condition.
+  RealValT<_Val> residual;
+
+  /// The step size (zero if the integrator does not use line search).
+  RealValT<_Val> tau;
+
+  /// The number of line search steps (zero if the integrator does not use line search).
+  index_t num_line_search;
+
+  /// The computation time of the iteration.
+  double compute_time;
+
+  /// The communication time of the iteration.
+  double comm_time;
+
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  isvd_integrator_module
+/// The iSVD integrator iteration monitor.
+///
+/// Records the convergence history of an integrator, and calls the user callback after each iteration. The integrator stops
+/// if the callback returns @c true.
+///
+/// @tparam  _Val  The value type.
+///
+template <typename _Val>
+class IterationMonitor {
+
+ public:
+
+  /// The type of the callback.
+  using CallbackType = std::function<bool( const IterationRecord<_Val>& )>;
+
+ protected:
+
+  /// The records.
+  std::vector<IterationRecord<_Val>> records_;
+
+  /// The callback.
+  CallbackType callback_;
+
+ public:
+
+  // Constructors
+  inline IterationMonitor() noexcept;
+
+  // Gets data
+  inline const std::vector<IterationRecord<_Val>>& records() const noexcept;
+  inline bool hasCallback() const noexcept;
+
+  // Sets callback
+  inline void setCallback( const CallbackType &callback ) noexcept;
+
+  // Records
+  inline void reserve( const index_t max_iteration ) noexcept;
+  inline void clear() noexcept;
+  inline bool record( const IterationRecord<_Val> &record ) noexcept;
+
+};
+
+}  // namespace isvd
+
+}  // namespace mcnla
+
+#endif  // MCNLA_ISVD_INTEGRATOR_ITERATION_MONITOR_HH_
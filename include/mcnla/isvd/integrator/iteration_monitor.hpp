@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/isvd/integrator/iteration_monitor.hpp
+/// @brief   The iSVD integrator iteration monitor.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_ISVD_INTEGRATOR_ITERATION_MONITOR_HPP_
+#define MCNLA_ISVD_INTEGRATOR_ITERATION_MONITOR_HPP_
+
+#include <mcnla/isvd/integrator/iteration_monitor.hh>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The iSVD namespace.
+//
+namespace isvd {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Default constructor.
+///
+template <typename _Val>
+IterationMonitor<_Val>::IterationMonitor() noexcept
+  : records_(),
+    callback_() {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the records of the last run.
+///
+template <typename _Val>
+const std::vector<IterationRecord<_Val>>& IterationMonitor<_Val>::records() const noexcept {
+  return records_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Determines if the callback is set.
+///
+template <typename _Val>
+bool IterationMonitor<_Val>::hasCallback() const noexcept {
+  return static_cast<bool>(callback_);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the callback.
+///
+/// The callback is called with the record after each iteration, and requests early termination by returning @c true. Pass
+/// an empty function to unset the callback.
+///
+template <typename _Val>
+void IterationMonitor<_Val>::setCallback(
+    const CallbackType &callback
+) noexcept {
+  callback_ = callback;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Reserves the records.
+///
+template <typename _Val>
+void IterationMonitor<_Val>::reserve(
+    const index_t max_iteration
+) noexcept {
+  records_.reserve(max_iteration);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Clears the records.
+///
+template <typename _Val>
+void IterationMonitor<_Val>::clear() noexcept {
+  records_.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Appends a record and calls the callback.
+///
+/// @return  @c true if the callback requests early termination.
+///
+/// @attention  The callback is called on all MPI nodes. It should return the same value on all of them.
+///
+template <typename _Val>
+bool IterationMonitor<_Val>::record(
+    const IterationRecord<_Val> &record
+) noexcept {
+  records_.push_back(record);
+  return callback_ && callback_(record);
+}
+
+}  // namespace isvd
+
+}  // namespace mcnla
+
+#endif  // MCNLA_ISVD_INTEGRATOR_ITERATION_MONITOR_HPP_
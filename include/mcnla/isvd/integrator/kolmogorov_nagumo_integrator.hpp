@@ -67,6 +67,19 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   syev_driver_.reconstruct(dim_sketch);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t nrow            = parameters_.nrow();
+  const std::size_t dim_sketch      = parameters_.dimSketch();
+  const std::size_t dim_sketch_each = parameters_.dimSketchEach();
+
+  return sizeof(_Val) * (dim_sketch_each * dim_sketch + 3 * dim_sketch * dim_sketch + 2 * nrow * dim_sketch + 2 * dim_sketch);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Integrates.
 ///
@@ -80,6 +93,7 @@ void MCNLA_ALIAS::runImpl(
 ) noexcept {
 
   const auto mpi_comm        = parameters_.mpi_comm;
+  const auto mpi_size        = parameters_.mpi_size;
   const auto mpi_rank        = parameters_.mpi_rank;
   const auto nrow            = parameters_.nrow();
   const auto dim_sketch      = parameters_.dimSketch();
@@ -105,9 +119,11 @@ void MCNLA_ALIAS::runImpl(
     la::copy(collection_q(0), matrix_qc);
   }
 
-  comm_moment = utility::getTime();
-  mpi::bcast(matrix_qc, 0, mpi_comm);
-  comm_time += utility::getTime() - comm_moment;
+  if ( mpi_size > 1 ) {
+    comm_moment = utility::getTime();
+    mpi::bcast(matrix_qc, 0, mpi_comm);
+    comm_time += utility::getTime() - comm_moment;
+  }
 
   this->toc(comm_time);
   // ====================================================================================================================== //
@@ -133,7 +149,7 @@ void MCNLA_ALIAS::runImpl(
 
     // Reduce sum X
     comm_moment = utility::getTime();
-    mpi::allreduce(matrix_x_, MPI_SUM, mpi_comm);
+    parameters_.allreduce(matrix_x_, MPI_SUM);
     comm_time += utility::getTime() - comm_moment;
 
     // ================================================================================================================== //
@@ -105,6 +105,9 @@ class MCNLA_ALIAS1
   // Initializes
   void initializeImpl() noexcept;
 
+  // Gets memory requirement
+  inline std::size_t memoryRequirementImpl() const noexcept;
+
   // Initializes
   void runImpl( const DenseMatrixCollectionColBlockRowMajor<_Val> &collection_qj,
                 const DenseMatrixCollectionColBlockRowMajor<_Val> &collection_q,
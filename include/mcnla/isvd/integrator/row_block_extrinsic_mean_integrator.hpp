@@ -63,6 +63,20 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   syev_driver_.reconstruct(dim_sketch);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t dim_sketch       = parameters_.dimSketch();
+  const std::size_t dim_sketch_total = parameters_.dimSketchTotal();
+  const std::size_t num_sketch_each  = parameters_.numSketchEach();
+
+  return sizeof(_Val) * (dim_sketch_total * dim_sketch_total + dim_sketch * dim_sketch_total * num_sketch_each
+                       + dim_sketch * dim_sketch * (num_sketch_each + 2) + dim_sketch);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Integrates.
 ///
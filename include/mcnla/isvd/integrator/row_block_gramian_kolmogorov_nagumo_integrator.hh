@@ -71,6 +71,12 @@ class MCNLA_ALIAS1
   /// The number of iteration.
   index_t iteration_;
 
+  /// The iteration monitor.
+  IterationMonitor<_Val> monitor_;
+
+  /// The maximum momentum coefficient.
+  RealValT<_Val> momentum_;
+
   /// The matrix Bs.
   DenseMatrixRowMajor<_Val> matrix_bs_;
 
@@ -117,22 +123,30 @@ class MCNLA_ALIAS1
 
   // Constructor
   inline MCNLA_ALIAS0( const Parameters<_Val> &parameters,
-                     const index_t max_iteration = 256, const RealValT<_Val> tolerance = 1e-4 ) noexcept;
+                     const index_t max_iteration = 256, const RealValT<_Val> tolerance = 1e-4,
+                     const RealValT<_Val> momentum = 0 ) noexcept;
 
   // Gets parameters
   inline index_t        maxIteration() const noexcept;
   inline RealValT<_Val> tolerance() const noexcept;
+  inline RealValT<_Val> momentum() const noexcept;
   inline index_t        iteration() const noexcept;
+  inline const std::vector<IterationRecord<_Val>>& records() const noexcept;
 
   // Sets parameters
   inline MCNLA_ALIAS1& setMaxIteration( const index_t max_iteration ) noexcept;
   inline MCNLA_ALIAS1& setTolerance( const RealValT<_Val> tolerance ) noexcept;
+  inline MCNLA_ALIAS1& setMomentum( const RealValT<_Val> momentum ) noexcept;
+  inline MCNLA_ALIAS1& setCallback( const typename IterationMonitor<_Val>::CallbackType &callback ) noexcept;
 
  protected:
 
   // Initializes
   void initializeImpl() noexcept;
 
+  // Gets memory requirement
+  inline std::size_t memoryRequirementImpl() const noexcept;
+
   // Initializes
   void runImpl( const DenseMatrixCollectionColBlockRowMajor<_Val> &collection_qj,
                       DenseMatrixRowMajor<_Val> &matrix_qbarj ) noexcept;
@@ -9,6 +9,7 @@
 #define MCNLA_ISVD_INTEGRATOR_ROW_BLOCK_GRAMIAN_KOLMOGOROV_NAGUMO_INTEGRATOR_HPP_
 
 #include <mcnla/isvd/integrator/row_block_gramian_kolmogorov_nagumo_integrator.hh>
+#include <limits>
 #include <mcnla/core/la.hpp>
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -36,11 +37,13 @@ template <typename _Val>
 MCNLA_ALIAS::MCNLA_ALIAS0(
     const Parameters<_Val> &parameters,
     const index_t max_iteration,
-    const RealValT<_Val> tolerance
+    const RealValT<_Val> tolerance,
+    const RealValT<_Val> momentum
 ) noexcept
   : BaseType(parameters) {
   setMaxIteration(max_iteration);
   setTolerance(tolerance);
+  setMomentum(momentum);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -68,6 +71,21 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   vector_ss_.reconstruct(dim_sketch);
 
   syev_driver_.reconstruct(symatrix_z_);
+
+  monitor_.reserve(max_iteration_);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t dim_sketch       = parameters_.dimSketch();
+  const std::size_t dim_sketch_total = parameters_.dimSketchTotal();
+
+  return sizeof(_Val) * (dim_sketch_total * dim_sketch_total + 5 * dim_sketch_total * dim_sketch
+                       + 6 * dim_sketch * dim_sketch + 2 * dim_sketch);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,7 +100,6 @@ void MCNLA_ALIAS::runImpl(
           DenseMatrixRowMajor<_Val> &matrix_qbarj
 ) noexcept {
 
-  const auto mpi_comm   = parameters_.mpi_comm;
   const auto nrow_rank  = parameters_.nrowRank();
   const auto dim_sketch = parameters_.dimSketch();
   const auto num_sketch = parameters_.numSketch();
@@ -97,6 +114,10 @@ void MCNLA_ALIAS::runImpl(
   auto &symatrix_bs = matrix_bs_.syml();       // matrix Bs.
 
   _Val one_n = 1.0/num_sketch;
+  RealValT<_Val> error, error_prev = std::numeric_limits<RealValT<_Val>>::infinity();
+  index_t num_momentum = 0;
+
+  monitor_.clear();
 
   double comm_moment, comm_time;
   this->tic(comm_time);
@@ -114,7 +135,7 @@ void MCNLA_ALIAS::runImpl(
     // Bs := Qs' * Qs
     la::rk(matrix_qsj.t(), symatrix_bs);
     comm_moment = utility::getTime();
-    mpi::allreduce(matrix_bs_, MPI_SUM, mpi_comm);
+    parameters_.allreduce(matrix_bs_, MPI_SUM);
     comm_time = utility::getTime() - comm_moment;
 
     // Bc := Qs' * Q0
@@ -137,6 +158,8 @@ void MCNLA_ALIAS::runImpl(
   bool is_odd = false;
   for ( iteration_ = 0; iteration_ < max_iteration_ && !is_converged; ++iteration_ ) {
 
+    const double iter_moment = utility::getTime(), iter_comm_moment = comm_time;
+
     auto &&matrix_bc  = collection_bc_(is_odd);    // matrix Bc.
     auto &&matrix_bp  = collection_bc_(!is_odd);   // matrix B+.
     auto &&matrix_ffc = collection_ff_(is_odd);   // matrix F~c.
@@ -211,7 +234,58 @@ void MCNLA_ALIAS::runImpl(
     for ( auto &v : vector_s_ ) {
       v -= 1.0;
     }
-    is_converged = !(la::nrm2(vector_s_) >= tolerance_);
+    error = la::nrm2(vector_s_);
+    is_converged = !(error >= tolerance_);
+
+    // ================================================================================================================== //
+    // Apply momentum
+    if ( momentum_ > 0 && !is_converged ) {
+
+      // Restart if the error increases
+      if ( error > error_prev ) {
+        num_momentum = 0;
+      }
+      error_prev = error;
+      const _Val beta = momentum_ * num_momentum / (num_momentum + 3);
+      ++num_momentum;
+
+      if ( beta > 0 ) {
+
+        // M := (1+beta)^2 * I + beta^2 * I - 2 * beta * (1+beta) * C  (i.e. Qm' * Qm, where Qm := (1+beta) * Q+ - beta * Qc)
+        // eig(M) = Z' * L * Z, where L := (1+beta)^2 + beta^2 - 2 * beta * (1+beta) * S
+        // SS := L^(1/4) / sqrt(S)
+        for ( index_t i = 0; i < dim_sketch; ++i ) {
+          const _Val s = vector_s_(i) + 1.0;
+          const _Val l = (1.0+beta) * (1.0+beta) + beta * beta - 2.0 * beta * (1.0+beta) * s;
+          vector_ss_(i) = std::sqrt(std::sqrt(l) / s);
+        }
+
+        // inv(sqrt(M)) [in inv(C)] := Z' * inv(sqrt(L)) * Z
+        la::sm(vector_ss_.diag().inv(), matrix_sinvz);
+        la::rk(matrix_sinvz.t(), symatrix_cinv_);
+
+        // F~+ := ((1+beta) * F~+ - beta * F~c) * inv(sqrt(M))
+        la::axpby(matrix_ffp.vec(), matrix_ffc.vec(), 1.0+beta, -beta);
+        la::mm(matrix_ffc, symatrix_cinv_, matrix_ffp);
+
+        // E~+ := ((1+beta) * E~+ - beta * E~c) * inv(sqrt(M))
+        la::axpby(matrix_eep.vec(), matrix_eec.vec(), 1.0+beta, -beta);
+        la::mm(matrix_eec, symatrix_cinv_, matrix_eep);
+
+        // B+ := ((1+beta) * B+ - beta * Bc) * inv(sqrt(M))
+        la::axpby(matrix_bp.vec(), matrix_bc.vec(), 1.0+beta, -beta);
+        la::mm(matrix_bc, symatrix_cinv_, matrix_bp);
+      }
+    }
+
+    // ================================================================================================================== //
+    // Record the iteration
+    const double iter_comm_time = comm_time - iter_comm_moment;
+    const double iter_time      = utility::getTime() - iter_moment - iter_comm_time;
+    const bool is_stopped = monitor_.record({iteration_, error, 0, 0, iter_time, iter_comm_time});
+    if ( is_stopped ) {
+      is_converged = true;
+    }
   }
 
   this->toc(comm_time);
@@ -244,6 +318,14 @@ RealValT<_Val> MCNLA_ALIAS::tolerance() const noexcept {
   return tolerance_;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the maximum momentum coefficient.
+///
+template <typename _Val>
+RealValT<_Val> MCNLA_ALIAS::momentum() const noexcept {
+  return momentum_;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Gets the number of iteration.
 ///
@@ -253,6 +335,17 @@ index_t MCNLA_ALIAS::iteration() const noexcept {
   return iteration_;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the records of each iteration.
+///
+/// @see  IterationRecord
+///
+template <typename _Val>
+const std::vector<IterationRecord<_Val>>& MCNLA_ALIAS::records() const noexcept {
+  mcnla_assert_true(this->isComputed());
+  return monitor_.records();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Sets the maximum number of iteration.
 ///
@@ -281,6 +374,42 @@ MCNLA_ALIAS& MCNLA_ALIAS::setTolerance(
   return *this;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the maximum momentum coefficient.
+///
+/// The k-th iteration (counted from the last restart) extrapolates Q+ by momentum * k / (k+3) along Q+ - Qc, and retracts
+/// the result back to the Stiefel manifold by its polar factor. The momentum is restarted whenever the error increases.
+/// Set @a momentum to zero to disable the acceleration.
+///
+template <typename _Val>
+MCNLA_ALIAS& MCNLA_ALIAS::setMomentum(
+    const RealValT<_Val> momentum
+) noexcept {
+  mcnla_assert_ge(momentum, 0);
+  mcnla_assert_lt(momentum, 1);
+  momentum_ = momentum;
+  initialized_ = false;
+  computed_ = false;
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the callback called after each iteration.
+///
+/// The integrator stops if @a callback returns @c true.
+///
+/// @attention  @a callback is called on all MPI nodes. It should return the same value on all of them.
+///
+/// @see  IterationMonitor::setCallback
+///
+template <typename _Val>
+MCNLA_ALIAS& MCNLA_ALIAS::setCallback(
+    const typename IterationMonitor<_Val>::CallbackType &callback
+) noexcept {
+  monitor_.setCallback(callback);
+  return *this;
+}
+
 }  // namespace isvd
 
 }  // namespace mcnla
@@ -71,6 +71,9 @@ class MCNLA_ALIAS1
   /// The number of iteration.
   index_t iteration_;
 
+  /// The iteration monitor.
+  IterationMonitor<_Val> monitor_;
+
   /// The initial step size.
   _Val tau0_ = 1.0;
 
@@ -156,16 +159,21 @@ class MCNLA_ALIAS1
   inline index_t        maxIteration() const noexcept;
   inline RealValT<_Val> tolerance() const noexcept;
   inline index_t        iteration() const noexcept;
+  inline const std::vector<IterationRecord<_Val>>& records() const noexcept;
 
   // Sets parameters
   inline MCNLA_ALIAS1& setMaxIteration( const index_t max_iteration ) noexcept;
   inline MCNLA_ALIAS1& setTolerance( const RealValT<_Val> tolerance ) noexcept;
+  inline MCNLA_ALIAS1& setCallback( const typename IterationMonitor<_Val>::CallbackType &callback ) noexcept;
 
  protected:
 
   // Initializes
   void initializeImpl() noexcept;
 
+  // Gets memory requirement
+  inline std::size_t memoryRequirementImpl() const noexcept;
+
   // Initializes
   void runImpl( const DenseMatrixCollectionColBlockRowMajor<_Val> &collection_qj,
                       DenseMatrixRowMajor<_Val> &matrix_qbarj ) noexcept;
@@ -75,6 +75,21 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   matrix_bs_upsolon_.reconstruct(dim_sketch_total, dim_sketch);
 
   getrfi_driver_.reconstruct(matrix_c_);
+
+  monitor_.reserve(max_iteration_);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t dim_sketch       = parameters_.dimSketch();
+  const std::size_t dim_sketch_total = parameters_.dimSketchTotal();
+
+  return sizeof(_Val) * (dim_sketch_total * dim_sketch_total + 8 * dim_sketch_total * dim_sketch
+                       + 13 * dim_sketch * dim_sketch);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -89,7 +104,6 @@ void MCNLA_ALIAS::runImpl(
           DenseMatrixRowMajor<_Val> &matrix_qbarj
 ) noexcept {
 
-  const auto mpi_comm   = parameters_.mpi_comm;
   const auto nrow_rank  = parameters_.nrowRank();
   const auto dim_sketch = parameters_.dimSketch();
   const auto num_sketch = parameters_.numSketch();
@@ -106,6 +120,8 @@ void MCNLA_ALIAS::runImpl(
   _Val one_n = 1.0/num_sketch, one_2n = 0.5/num_sketch;
   _Val taug, zeta, phi, mu;
 
+  monitor_.clear();
+
   double comm_moment, comm_time;
   this->tic(comm_time);
   // ====================================================================================================================== //
@@ -123,7 +139,7 @@ void MCNLA_ALIAS::runImpl(
     // Bs := Qs' * Qs
     la::rk(matrix_qsj.t(), symatrix_bs);
     comm_moment = utility::getTime();
-    mpi::allreduce(matrix_bs_, MPI_SUM, mpi_comm);
+    parameters_.allreduce(matrix_bs_, MPI_SUM);
     comm_time = utility::getTime() - comm_moment;
 
     // Bc := Qs' * Q0
@@ -161,6 +177,8 @@ void MCNLA_ALIAS::runImpl(
   bool is_odd = false;
   for ( iteration_ = 0; iteration_ < max_iteration_ && !is_converged; ++iteration_ ) {
 
+    const double iter_moment = utility::getTime(), iter_comm_moment = comm_time;
+
     auto idxs1 = I_{0_i, dim_sketch};
     auto idxs2 = idxs1 + dim_sketch;
     auto &&matrix_c11 = matrix_c_(idxs1, idxs1);  // matrix C11
@@ -185,7 +203,9 @@ void MCNLA_ALIAS::runImpl(
     // ================================================================================================================== //
     // Find step size
     _Val tau = taug, phit = phi;
+    index_t num_line_search = 0;
     for ( auto tauiter = 0; tauiter < taumaxiter_; ++tauiter, tau *= beta_ ) {
+      ++num_line_search;
 
       // C := [ Dc/2 - I/tau , I/2          ;
       //       -Dgc/2,        -Dc/2 - I/tau ]
@@ -247,9 +267,15 @@ void MCNLA_ALIAS::runImpl(
     // mu := tr( Dg+ [in Dgc] ) - norm( D+ )_F^2
     mu = la::asum(matrix_dgc_.diag().vec()) - la::nrmf2(matrix_dp);
 
+    // ================================================================================================================== //
+    // Record the iteration
+    const double iter_comm_time = comm_time - iter_comm_moment;
+    const double iter_time      = utility::getTime() - iter_moment - iter_comm_time;
+    const bool is_stopped = monitor_.record({iteration_, mu, tau, num_line_search, iter_time, iter_comm_time});
+
     // ================================================================================================================== //
     // Check convergence: mu  < tol^2
-    if ( mu < tolerance_ * tolerance_ ) {
+    if ( mu < tolerance_ * tolerance_ || is_stopped ) {
       ++iteration_;
       break;
     }
@@ -355,6 +381,17 @@ index_t MCNLA_ALIAS::iteration() const noexcept {
   return iteration_;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the records of each iteration.
+///
+/// @see  IterationRecord
+///
+template <typename _Val>
+const std::vector<IterationRecord<_Val>>& MCNLA_ALIAS::records() const noexcept {
+  mcnla_assert_true(this->isComputed());
+  return monitor_.records();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Sets the maximum number of iteration.
 ///
@@ -383,6 +420,23 @@ MCNLA_ALIAS& MCNLA_ALIAS::setTolerance(
   return *this;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the callback called after each iteration.
+///
+/// The integrator stops if @a callback returns @c true.
+///
+/// @attention  @a callback is called on all MPI nodes. It should return the same value on all of them.
+///
+/// @see  IterationMonitor::setCallback
+///
+template <typename _Val>
+MCNLA_ALIAS& MCNLA_ALIAS::setCallback(
+    const typename IterationMonitor<_Val>::CallbackType &callback
+) noexcept {
+  monitor_.setCallback(callback);
+  return *this;
+}
+
 }  // namespace isvd
 
 }  // namespace mcnla
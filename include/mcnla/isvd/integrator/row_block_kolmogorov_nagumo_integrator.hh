@@ -70,6 +70,36 @@ class MCNLA_ALIAS1
   /// The number of iteration.
   index_t iteration_;
 
+  /// The iteration monitor.
+  IterationMonitor<_Val> monitor_;
+
+  /// The maximum momentum coefficient.
+  RealValT<_Val> momentum_;
+
+  /// The tag shows if the integrator is warm-started.
+  bool is_warm_ = false;
+
+  /// The initial matrix Qbar (j-th row-block, where j is the MPI rank).
+  DenseMatrixRowMajor<_Val> matrix_qbar0j_;
+
+  /// The tag shows if the early iterations use single precision.
+  bool mixed_precision_ = false;
+
+  /// The tolerance of switching from single precision to full precision.
+  RealValT<_Val> switch_tolerance_ = 0;
+
+  /// The matrix Qs (single precision).
+  DenseMatrixRowMajor<float> matrix_qsjf_;
+
+  /// The matrix Gc (single precision).
+  DenseMatrixRowMajor<float> matrix_gcjf_;
+
+  /// The matrix Bc (single precision).
+  DenseMatrixRowMajor<float> matrix_bcf_;
+
+  /// The matrix Bgc (single precision).
+  DenseMatrixRowMajor<float> matrix_bgcf_;
+
   /// The matrix Qc and Q+.
   DenseMatrixCollectionRowBlockRowMajor<_Val> collection_qcj_;
 
@@ -113,22 +143,36 @@ class MCNLA_ALIAS1
 
   // Constructor
   inline MCNLA_ALIAS0( const Parameters<_Val> &parameters,
-                     const index_t max_iteration = 256, const RealValT<_Val> tolerance = 1e-4 ) noexcept;
+                     const index_t max_iteration = 256, const RealValT<_Val> tolerance = 1e-4,
+                     const RealValT<_Val> momentum = 0 ) noexcept;
 
   // Gets parameters
   inline index_t        maxIteration() const noexcept;
   inline RealValT<_Val> tolerance() const noexcept;
+  inline RealValT<_Val> momentum() const noexcept;
+  inline bool           isMixedPrecision() const noexcept;
+  inline RealValT<_Val> switchTolerance() const noexcept;
   inline index_t        iteration() const noexcept;
+  inline const std::vector<IterationRecord<_Val>>& records() const noexcept;
 
   // Sets parameters
   inline MCNLA_ALIAS1& setMaxIteration( const index_t max_iteration ) noexcept;
   inline MCNLA_ALIAS1& setTolerance( const RealValT<_Val> tolerance ) noexcept;
+  inline MCNLA_ALIAS1& setMomentum( const RealValT<_Val> momentum ) noexcept;
+  inline MCNLA_ALIAS1& setMixedPrecision( const bool mixed_precision ) noexcept;
+  inline MCNLA_ALIAS1& setSwitchTolerance( const RealValT<_Val> switch_tolerance ) noexcept;
+  inline MCNLA_ALIAS1& setInitialQbar( const DenseMatrixRowMajor<_Val> &matrix_qbarj ) noexcept;
+  inline MCNLA_ALIAS1& unsetInitialQbar() noexcept;
+  inline MCNLA_ALIAS1& setCallback( const typename IterationMonitor<_Val>::CallbackType &callback ) noexcept;
 
  protected:
 
   // Initializes
   void initializeImpl() noexcept;
 
+  // Gets memory requirement
+  inline std::size_t memoryRequirementImpl() const noexcept;
+
   // Initializes
   void runImpl( const DenseMatrixCollectionColBlockRowMajor<_Val> &collection_qj,
                       DenseMatrixRowMajor<_Val> &matrix_qbarj ) noexcept;
@@ -9,6 +9,8 @@
 #define MCNLA_ISVD_INTEGRATOR_ROW_BLOCK_KOLMOGOROV_NAGUMO_INTEGRATOR_HPP_
 
 #include <mcnla/isvd/integrator/row_block_kolmogorov_nagumo_integrator.hh>
+#include <algorithm>
+#include <limits>
 #include <mcnla/core/la.hpp>
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -36,11 +38,13 @@ template <typename _Val>
 MCNLA_ALIAS::MCNLA_ALIAS0(
     const Parameters<_Val> &parameters,
     const index_t max_iteration,
-    const RealValT<_Val> tolerance
+    const RealValT<_Val> tolerance,
+    const RealValT<_Val> momentum
 ) noexcept
   : BaseType(parameters) {
   setMaxIteration(max_iteration);
   setTolerance(tolerance);
+  setMomentum(momentum);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -68,6 +72,38 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   vector_ss_.reconstruct(dim_sketch);
 
   syev_driver_.reconstruct(symatrix_z_);
+
+  if ( mixed_precision_ ) {
+    matrix_qsjf_.reconstruct(nrow_rank, dim_sketch_total);
+    matrix_gcjf_.reconstruct(nrow_rank, dim_sketch);
+    matrix_bcf_.reconstruct(dim_sketch_total, dim_sketch);
+    matrix_bgcf_.reconstruct(dim_sketch_total, dim_sketch);
+  } else {
+    matrix_qsjf_ = DenseMatrixRowMajor<float>();
+    matrix_gcjf_ = DenseMatrixRowMajor<float>();
+    matrix_bcf_  = DenseMatrixRowMajor<float>();
+    matrix_bgcf_ = DenseMatrixRowMajor<float>();
+  }
+
+  monitor_.reserve(max_iteration_);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t nrow_rank        = parameters_.nrowRank();
+  const std::size_t dim_sketch       = parameters_.dimSketch();
+  const std::size_t dim_sketch_total = parameters_.dimSketchTotal();
+
+  auto bytes = sizeof(_Val) * (3 * nrow_rank * dim_sketch + 3 * dim_sketch_total * dim_sketch
+                             + 4 * dim_sketch * dim_sketch + 2 * dim_sketch);
+  if ( mixed_precision_ ) {
+    bytes += sizeof(float) * (nrow_rank * dim_sketch_total + nrow_rank * dim_sketch + 2 * dim_sketch_total * dim_sketch);
+  }
+  return bytes;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,7 +118,6 @@ void MCNLA_ALIAS::runImpl(
           DenseMatrixRowMajor<_Val> &matrix_qbarj
 ) noexcept {
 
-  const auto mpi_comm   = parameters_.mpi_comm;
   const auto nrow_rank  = parameters_.nrowRank();
   const auto dim_sketch = parameters_.dimSketch();
   const auto num_sketch = parameters_.numSketch();
@@ -95,6 +130,10 @@ void MCNLA_ALIAS::runImpl(
   auto &matrix_qsj = collection_qj.unfold();  // matrix Qs.
 
   _Val one_n = 1.0/num_sketch;
+  RealValT<_Val> error, error_prev = std::numeric_limits<RealValT<_Val>>::infinity();
+  index_t num_momentum = 0;
+
+  monitor_.clear();
 
   double comm_moment, comm_time;
   this->tic(comm_time);
@@ -106,13 +145,61 @@ void MCNLA_ALIAS::runImpl(
     auto &&matrix_bc  = collection_bc_(0);   // matrix Bc.
     auto &&matrix_qcj = collection_qcj_(0);  // matrix Qc.
 
-    // Qc := Q0
-    la::copy(collection_qj(0), matrix_qcj);
+    bool is_cold = !is_warm_;
+
+    if ( is_warm_ ) {
+
+      // B0 [in Bc] := Qs' * Qbar0
+      la::mm(matrix_qsj.t(), matrix_qbar0j_, matrix_bc);
+      comm_moment = utility::getTime();
+      parameters_.allreduce(matrix_bc, MPI_SUM);
+      comm_time += utility::getTime() - comm_moment;
+
+      // G0 [in Gc] := 1/N * Qs * B0 (projection onto the sketch span)
+      la::mm(matrix_qsj, matrix_bc, matrix_gcj_, one_n);
+
+      // Z := G0' * G0
+      la::memset0(symatrix_z_.full());
+      la::rk(matrix_gcj_.t(), symatrix_z_);
+      comm_moment = utility::getTime();
+      parameters_.allreduce(symatrix_z_.full(), MPI_SUM);
+      comm_time += utility::getTime() - comm_moment;
+
+      // eig(Z) = Z' * S * Z
+      syev_driver_(symatrix_z_, vector_s_);
+
+      // Falls back to Q0 if G0 is (nearly) rank deficient, e.g. Qbar0 is nearly orthogonal to the sketches
+      // (the eigenvalues are at most one for an orthonormal Qbar0, so they are compared with one if they are all tiny)
+      is_cold = !(vector_s_(0) > std::numeric_limits<RealValT<_Val>>::epsilon()
+                                 * std::max(vector_s_(dim_sketch-1), RealValT<_Val>(1)));
+
+      if ( !is_cold ) {
+
+        // inv(sqrt(Z)) [in inv(C)] := Z' * inv(sqrt(S)) * Z
+        for ( index_t i = 0; i < dim_sketch; ++i ) {
+          vector_ss_(i) = std::sqrt(std::sqrt(vector_s_(i)));
+        }
+        la::sm(vector_ss_.diag().inv(), symatrix_z_.full());
+        la::rk(symatrix_z_.full().t(), symatrix_cinv_);
+
+        // Qc := G0 * inv(sqrt(Z))
+        la::mm(matrix_gcj_, symatrix_cinv_, matrix_qcj);
+
+      }
+
+    }
+
+    if ( is_cold ) {
+
+      // Qc := Q0
+      la::copy(collection_qj(0), matrix_qcj);
+
+    }
 
     // Bc := Qs' * Qc
     la::mm(matrix_qsj.t(), matrix_qcj, matrix_bc);
     comm_moment = utility::getTime();
-    mpi::allreduce(matrix_bc, MPI_SUM, mpi_comm);
+    parameters_.allreduce(matrix_bc, MPI_SUM);
     comm_time += utility::getTime() - comm_moment;
 
   }
@@ -123,8 +210,17 @@ void MCNLA_ALIAS::runImpl(
 
   bool is_converged = false;
   bool is_odd = false;
+  bool is_single = mixed_precision_;
+  RealValT<_Val> error_single = std::numeric_limits<RealValT<_Val>>::infinity();
+
+  // Qs (single precision) := Qs
+  if ( is_single ) {
+    la::lag2(matrix_qsj, matrix_qsjf_);
+  }
   for ( iteration_ = 0; iteration_ < max_iteration_ && !is_converged; ++iteration_ ) {
 
+    const double iter_moment = utility::getTime(), iter_comm_moment = comm_time;
+
     auto &&matrix_bc  = collection_bc_(is_odd);    // matrix Bc.
     auto &&matrix_bp  = collection_bc_(!is_odd);   // matrix B+.
     auto &&matrix_qcj = collection_qcj_(is_odd);   // matrix Qc.
@@ -134,13 +230,28 @@ void MCNLA_ALIAS::runImpl(
     // ================================================================================================================== //
     // Compute B, D, and G
 
-    // Gc := 1/N * Qs * Bc
-    la::mm(matrix_qsj, matrix_bc, matrix_gcj_, one_n);
+    if ( is_single ) {
 
-    // Bgc := Qs' * Gc
-    la::mm(matrix_qsj.t(), matrix_gcj_, matrix_bgc_);
+      // Gc := 1/N * Qs * Bc (in single precision)
+      la::lag2(matrix_bc, matrix_bcf_);
+      la::mm(matrix_qsjf_, matrix_bcf_, matrix_gcjf_, one_n);
+      la::lag2(matrix_gcjf_, matrix_gcj_);
+
+      // Bgc := Qs' * Gc (in single precision)
+      la::mm(matrix_qsjf_.t(), matrix_gcjf_, matrix_bgcf_);
+      la::lag2(matrix_bgcf_, matrix_bgc_);
+
+    } else {
+
+      // Gc := 1/N * Qs * Bc
+      la::mm(matrix_qsj, matrix_bc, matrix_gcj_, one_n);
+
+      // Bgc := Qs' * Gc
+      la::mm(matrix_qsj.t(), matrix_gcj_, matrix_bgc_);
+
+    }
     comm_moment = utility::getTime();
-    mpi::allreduce(matrix_bgc_, MPI_SUM, mpi_comm);
+    parameters_.allreduce(matrix_bgc_, MPI_SUM);
     comm_time += utility::getTime() - comm_moment;
 
     // Dc := 1/N * Bc' * Bc
@@ -198,7 +309,60 @@ void MCNLA_ALIAS::runImpl(
     for ( auto &v : vector_s_ ) {
       v -= 1.0;
     }
-    is_converged = !(la::nrm2(vector_s_) >= tolerance_);
+    error = la::nrm2(vector_s_);
+    if ( is_single ) {
+      // Switch to full precision if the error is small enough or stops decreasing
+      is_single = (error >= switch_tolerance_ && error >= tolerance_ && error < error_single);
+      error_single = error;
+    } else {
+      is_converged = !(error >= tolerance_);
+    }
+
+    // ================================================================================================================== //
+    // Apply momentum
+    if ( momentum_ > 0 && !is_converged ) {
+
+      // Restart if the error increases
+      if ( error > error_prev ) {
+        num_momentum = 0;
+      }
+      error_prev = error;
+      const _Val beta = momentum_ * num_momentum / (num_momentum + 3);
+      ++num_momentum;
+
+      if ( beta > 0 ) {
+
+        // M := (1+beta)^2 * I + beta^2 * I - 2 * beta * (1+beta) * C  (i.e. Qm' * Qm, where Qm := (1+beta) * Q+ - beta * Qc)
+        // eig(M) = Z' * L * Z, where L := (1+beta)^2 + beta^2 - 2 * beta * (1+beta) * S
+        // SS := L^(1/4) / sqrt(S)
+        for ( index_t i = 0; i < dim_sketch; ++i ) {
+          const _Val s = vector_s_(i) + 1.0;
+          const _Val l = (1.0+beta) * (1.0+beta) + beta * beta - 2.0 * beta * (1.0+beta) * s;
+          vector_ss_(i) = std::sqrt(std::sqrt(l) / s);
+        }
+
+        // inv(sqrt(M)) [in inv(C)] := Z' * inv(sqrt(L)) * Z
+        la::sm(vector_ss_.diag().inv(), matrix_sinvz);
+        la::rk(matrix_sinvz.t(), symatrix_cinv_);
+
+        // Q+ := ((1+beta) * Q+ - beta * Qc) * inv(sqrt(M))
+        la::axpby(matrix_qpj.vec(), matrix_qcj.vec(), 1.0+beta, -beta);
+        la::mm(matrix_qcj, symatrix_cinv_, matrix_qpj);
+
+        // B+ := ((1+beta) * B+ - beta * Bc) * inv(sqrt(M))
+        la::axpby(matrix_bp.vec(), matrix_bc.vec(), 1.0+beta, -beta);
+        la::mm(matrix_bc, symatrix_cinv_, matrix_bp);
+      }
+    }
+
+    // ================================================================================================================== //
+    // Record the iteration
+    const double iter_comm_time = comm_time - iter_comm_moment;
+    const double iter_time      = utility::getTime() - iter_moment - iter_comm_time;
+    const bool is_stopped = monitor_.record({iteration_, error, 0, 0, iter_time, iter_comm_time});
+    if ( is_stopped ) {
+      is_converged = true;
+    }
   }
 
   // Copy Qbar
@@ -223,6 +387,30 @@ RealValT<_Val> MCNLA_ALIAS::tolerance() const noexcept {
   return tolerance_;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the maximum momentum coefficient.
+///
+template <typename _Val>
+RealValT<_Val> MCNLA_ALIAS::momentum() const noexcept {
+  return momentum_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Determines if the early iterations use single precision.
+///
+template <typename _Val>
+bool MCNLA_ALIAS::isMixedPrecision() const noexcept {
+  return mixed_precision_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the tolerance of switching from single precision to full precision.
+///
+template <typename _Val>
+RealValT<_Val> MCNLA_ALIAS::switchTolerance() const noexcept {
+  return switch_tolerance_;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Gets the number of iteration.
 ///
@@ -232,6 +420,17 @@ index_t MCNLA_ALIAS::iteration() const noexcept {
   return iteration_;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the records of each iteration.
+///
+/// @see  IterationRecord
+///
+template <typename _Val>
+const std::vector<IterationRecord<_Val>>& MCNLA_ALIAS::records() const noexcept {
+  mcnla_assert_true(this->isComputed());
+  return monitor_.records();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Sets the maximum number of iteration.
 ///
@@ -260,6 +459,114 @@ MCNLA_ALIAS& MCNLA_ALIAS::setTolerance(
   return *this;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the maximum momentum coefficient.
+///
+/// The k-th iteration (counted from the last restart) extrapolates Q+ by momentum * k / (k+3) along Q+ - Qc, and retracts
+/// the result back to the Stiefel manifold by its polar factor. The momentum is restarted whenever the error increases.
+/// Set @a momentum to zero to disable the acceleration.
+///
+template <typename _Val>
+MCNLA_ALIAS& MCNLA_ALIAS::setMomentum(
+    const RealValT<_Val> momentum
+) noexcept {
+  mcnla_assert_ge(momentum, 0);
+  mcnla_assert_lt(momentum, 1);
+  momentum_ = momentum;
+  initialized_ = false;
+  computed_ = false;
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the mixed precision mode.
+///
+/// If enabled, a single precision copy of Qs is kept, and the products with Qs (i.e. Gc := 1/N * Qs * Bc and
+/// Bgc := Qs' * Gc) are computed in single precision until the error is less than #switchTolerance (or the tolerance of
+/// convergence condition), or stops decreasing. The remaining iterations use full precision to reach the tolerance of
+/// convergence condition.
+///
+/// @note  This halves the memory traffic over Qs in the early iterations. It is useless if @a _Val is @c float.
+///
+template <typename _Val>
+MCNLA_ALIAS& MCNLA_ALIAS::setMixedPrecision(
+    const bool mixed_precision
+) noexcept {
+  mixed_precision_ = mixed_precision;
+  initialized_ = false;
+  computed_ = false;
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the tolerance of switching from single precision to full precision.
+///
+/// The default value is zero, i.e., single precision is used until the tolerance of convergence condition is reached.
+///
+/// @see  setMixedPrecision
+///
+template <typename _Val>
+MCNLA_ALIAS& MCNLA_ALIAS::setSwitchTolerance(
+    const RealValT<_Val> switch_tolerance
+) noexcept {
+  mcnla_assert_ge(switch_tolerance, 0);
+  switch_tolerance_ = switch_tolerance;
+  computed_ = false;
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the initial matrix Qbar (warm start).
+///
+/// The iteration starts from the orthonormalized projection of @a matrix_qbarj onto the span of the sketches, instead of
+/// Q0. For example, pass the result of the previous run when decomposing a slowly changing matrix.
+///
+/// @param  matrix_qbarj  The initial matrix Qbarj (j-th row-block, where j is the MPI rank).
+///
+/// @note  If the projection is (nearly) rank deficient, e.g. @a matrix_qbarj is nearly orthogonal to the sketches, the
+///        iteration starts from Q0 instead.
+///
+/// @attention  @a matrix_qbarj is not copied. It should not be released before the integration.
+///
+template <typename _Val>
+MCNLA_ALIAS& MCNLA_ALIAS::setInitialQbar(
+    const DenseMatrixRowMajor<_Val> &matrix_qbarj
+) noexcept {
+  mcnla_assert_eq(matrix_qbarj.sizes(), std::make_tuple(parameters_.nrowRank(), parameters_.dimSketch()));
+  matrix_qbar0j_ = matrix_qbarj;
+  is_warm_ = true;
+  computed_ = false;
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Unsets the initial matrix Qbar (i.e. starts from Q0).
+///
+template <typename _Val>
+MCNLA_ALIAS& MCNLA_ALIAS::unsetInitialQbar() noexcept {
+  matrix_qbar0j_ = DenseMatrixRowMajor<_Val>();
+  is_warm_ = false;
+  computed_ = false;
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the callback called after each iteration.
+///
+/// The integrator stops if @a callback returns @c true.
+///
+/// @attention  @a callback is called on all MPI nodes. It should return the same value on all of them.
+///
+/// @see  IterationMonitor::setCallback
+///
+template <typename _Val>
+MCNLA_ALIAS& MCNLA_ALIAS::setCallback(
+    const typename IterationMonitor<_Val>::CallbackType &callback
+) noexcept {
+  monitor_.setCallback(callback);
+  return *this;
+}
+
 }  // namespace isvd
 
 }  // namespace mcnla
@@ -10,7 +10,9 @@
 
 #include <mcnla/isvd/def.hpp>
 #include <mcnla/isvd/integrator/integrator.hpp>
+#include <vector>
 #include <mcnla/core/la.hpp>
+#include <mcnla/core/mpi.hpp>
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
   #define MCNLA_ALIAS0 Integrator
@@ -39,6 +41,9 @@ template <typename _Val> using RowBlockReductionIntegrator = Integrator<RowBlock
 /// @ingroup  isvd_integrator_module
 /// The reduction integrator (row-block version).
 ///
+/// The pairs of each level are updated concurrently (with OpenMP), each task using its own workspace. The reduction of
+/// each pair of the next level is posted as soon as its operands are updated.
+///
 /// @tparam  _Val  The value type.
 ///
 template <typename _Val>
@@ -62,20 +67,29 @@ class MCNLA_ALIAS1
   /// The collection B.
   DenseMatrixCollectionRowBlockRowMajor<_Val> collection_b_;
 
-  /// The matrix T.
-  DenseMatrixColMajor<_Val> matrix_t_;
+  /// The matrices T (one per task).
+  DenseMatrixCollectionColBlockColMajor<_Val> collection_t_;
 
-  /// The vector S.
-  DenseVector<RealValT<_Val>> vector_s_;
+  /// The vectors S (one per task, stored by columns).
+  DenseMatrixColMajor<RealValT<_Val>> matrix_s_;
 
-  /// The temporary matrix.
-  DenseMatrixRowMajor<_Val> matrix_tmp_;
+  /// The temporary matrices (one per task).
+  DenseMatrixCollectionRowBlockRowMajor<_Val> collection_tmp_;
 
   /// The empty matrix.
   DenseMatrixRowMajor<_Val> matrix_empty_;
 
-  /// The GESVD driver.
-  la::DenseGesvdDriverRowMajor<'O', 'S', _Val> gesvd_driver_;
+  /// The GESVD drivers (one per task).
+  std::vector<la::DenseGesvdDriverRowMajor<'O', 'S', _Val>> gesvd_drivers_;
+
+  /// The requests of the reductions of the current level.
+  std::vector<mpi::Request> requests_;
+
+  /// The requests of the reductions of the next level.
+  std::vector<mpi::Request> requests_next_;
+
+  /// The indices of the completed requests.
+  std::vector<mpi_int_t> indices_;
 
   using BaseType::parameters_;
   using BaseType::initialized_;
@@ -93,9 +107,16 @@ class MCNLA_ALIAS1
   // Initializes
   void initializeImpl() noexcept;
 
+  // Gets memory requirement
+  inline std::size_t memoryRequirementImpl() const noexcept;
+
   // Initializes
   void runImpl( DenseMatrixCollectionColBlockRowMajor<_Val> &collection_qj, DenseMatrixRowMajor<_Val> &matrix_qbarj ) noexcept;
 
+  // Reduces a pair
+  void reducePair( DenseMatrixRowMajor<_Val> &matrix_qij, const DenseMatrixRowMajor<_Val> &matrix_qihj,
+                   DenseMatrixRowMajor<_Val> &matrix_w, const index_t task ) noexcept;
+
 };
 
 }  // namespace isvd
@@ -9,8 +9,13 @@
 #define MCNLA_ISVD_INTEGRATOR_ROW_BLOCK_REDUCTION_INTEGRATOR_HPP_
 
 #include <mcnla/isvd/integrator/row_block_reduction_integrator.hh>
+#include <algorithm>
 #include <mcnla/core/la.hpp>
 
+#ifdef _OPENMP
+  #include <omp.h>
+#endif  // _OPENMP
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
   #define MCNLA_ALIAS  Integrator<RowBlockReductionIntegratorTag, _Val>
   #define MCNLA_ALIAS0 Integrator
@@ -48,13 +53,47 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   const auto dim_sketch = parameters_.dimSketch();
   const auto num_sketch = parameters_.numSketch();
 
+#ifdef _OPENMP
+  const index_t num_task = omp_get_max_threads();
+#else  // _OPENMP
+  const index_t num_task = 1;
+#endif  // _OPENMP
+
   collection_b_.reconstruct(dim_sketch, dim_sketch, (num_sketch+1)/2);
 
-  matrix_t_.reconstruct(dim_sketch, dim_sketch);
-  vector_s_.reconstruct(dim_sketch);
+  collection_t_.reconstruct(dim_sketch, dim_sketch, num_task);
+  matrix_s_.reconstruct(dim_sketch, num_task);
+
+  collection_tmp_.reconstruct(nrow_rank, dim_sketch, num_task);
+
+  gesvd_drivers_.resize(num_task);
+  for ( auto &driver : gesvd_drivers_ ) {
+    driver.reconstruct(collection_b_(0));
+  }
 
-  matrix_tmp_.reconstruct(nrow_rank, dim_sketch);
-  gesvd_driver_.reconstruct(collection_b_(0));
+  requests_.resize(num_sketch/2);
+  requests_next_.resize(num_sketch/2);
+  indices_.reserve(num_sketch/2);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t nrow_rank  = parameters_.nrowRank();
+  const std::size_t dim_sketch = parameters_.dimSketch();
+  const std::size_t num_sketch = parameters_.numSketch();
+
+#ifdef _OPENMP
+  const std::size_t num_task = omp_get_max_threads();
+#else  // _OPENMP
+  const std::size_t num_task = 1;
+#endif  // _OPENMP
+
+  return sizeof(_Val) * (dim_sketch * dim_sketch * ((num_sketch+1)/2)
+                       + (dim_sketch * dim_sketch + dim_sketch + nrow_rank * dim_sketch) * num_task);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -69,51 +108,80 @@ void MCNLA_ALIAS::runImpl(
     DenseMatrixRowMajor<_Val> &matrix_qbarj
 ) noexcept {
 
-  const auto mpi_comm   = parameters_.mpi_comm;
   const auto nrow_rank  = parameters_.nrowRank();
   const auto dim_sketch = parameters_.dimSketch();
   const auto num_sketch = parameters_.numSketch();
 
   static_cast<void>(nrow_rank);
+  static_cast<void>(dim_sketch);
 
   mcnla_assert_eq(collection_qj.sizes(), std::make_tuple(nrow_rank, dim_sketch, num_sketch));
   mcnla_assert_eq(matrix_qbarj.sizes(),  std::make_tuple(nrow_rank, dim_sketch));
 
+  const auto mpi_comm = parameters_.mpi_comm;
+
   double comm_moment, comm_time;
   this->tic(comm_time);
   // ====================================================================================================================== //
   // Loop
-  for ( auto N = num_sketch; N > 1; N = (N+1)/2 ) {
-    const auto h = N / 2;
-
-    // B(i) := Q(i)' * Q(i+h)
-    for ( auto i = 0; i < h; ++i ) {
-      la::mm(collection_qj(i).t(), collection_qj(i+h), collection_b_(i));
-    }
-    comm_moment = utility::getTime();
-    mpi::allreduce(collection_b_({0, h}).unfold(), MPI_SUM, mpi_comm);
-    comm_time += utility::getTime() - comm_moment;
-
-    for ( auto i = 0; i < h; ++i ) {
-
-      auto &&matrix_w    = collection_b_(i);  // matrix W
-      auto &&matrix_qij  = collection_qj(i);  // matrix Q(i)
-      auto &&matrix_qihj = collection_qj(i+h);  // matrix Q(i+h)
 
-      // svd(B(i)) = W * S * T'
-      gesvd_driver_(matrix_w, vector_s_, matrix_empty_, matrix_t_.t());
-
-      // Q(i) := Q(i) * W + Q(i+h) * T
-      la::copy(matrix_qij, matrix_tmp_);
-      la::mm(matrix_tmp_, matrix_w, matrix_qij);
-      la::mm(matrix_qihj, matrix_t_, matrix_qij, 1.0, 1.0);
+  // B(i) := Q(i)' * Q(i+h) (nonblocking)
+  for ( auto i = 0; i < num_sketch/2; ++i ) {
+    la::mm(collection_qj(i).t(), collection_qj(i+num_sketch/2), collection_b_(i));
+    requests_[i] = mpi::iallreduce(collection_b_(i), MPI_SUM, mpi_comm);
+  }
 
-      // Q(i) /= sqrt(2(I + S))
-      for ( index_t ii = 0; ii < dim_sketch; ++ii ) {
-        vector_s_(ii) = 1.0 / sqrt(2.0 * (1 + vector_s_(ii)));
+  for ( auto N = num_sketch; N > 1; N = (N+1)/2 ) {
+    const auto h  = N / 2;
+    const auto h2 = (N+1) / 2 / 2;
+
+    // Q(i) is ready for the next level if it is not updated in this level, or its update is finished
+    auto is_ready = [&]( const index_t i ) { return i >= h || requests_[i].isNull(); };
+
+    index_t num_done = 0, num_post = 0;
+    while ( num_done < h ) {
+
+      comm_moment = utility::getTime();
+      const index_t num_ready = mpi::waitSome(requests_, indices_);
+      comm_time += utility::getTime() - comm_moment;
+
+      // Update the finished pairs concurrently
+#ifdef _OPENMP
+      double flops = 0.0, bytes = 0.0;
+      #pragma omp parallel for reduction(+:flops, bytes)
+#endif  // _OPENMP
+      for ( index_t ii = 0; ii < num_ready; ++ii ) {
+        const auto i = indices_[ii];
+        auto &&matrix_qij  = collection_qj(i);
+        auto &&matrix_qihj = collection_qj(i+h);
+        auto &&matrix_w    = collection_b_(i);
+#ifdef _OPENMP
+        const auto thread_id = omp_get_thread_num();
+        const auto &counter  = utility::Counter::instance();
+        const auto flops0 = counter.flops(), bytes0 = counter.bytes();
+        reducePair(matrix_qij, matrix_qihj, matrix_w, thread_id);
+        if ( thread_id != 0 ) {
+          flops += counter.flops() - flops0;
+          bytes += counter.bytes() - bytes0;
+        }
+#else  // _OPENMP
+        reducePair(matrix_qij, matrix_qihj, matrix_w, 0);
+#endif  // _OPENMP
+      }
+#ifdef _OPENMP
+      // Count the operations of the other threads in this thread
+      utility::Counter::instance().addFlops(flops, bytes);
+#endif  // _OPENMP
+      num_done += num_ready;
+
+      // B(i) := Q(i)' * Q(i+h2) of the next level (nonblocking, posted in order)
+      for ( ; num_post < h2 && is_ready(num_post) && is_ready(num_post+h2); ++num_post ) {
+        la::mm(collection_qj(num_post).t(), collection_qj(num_post+h2), collection_b_(num_post));
+        requests_next_[num_post] = mpi::iallreduce(collection_b_(num_post), MPI_SUM, mpi_comm);
       }
-      la::mm(""_, vector_s_.diag(), matrix_qij);
     }
+
+    std::swap(requests_, requests_next_);
   }
 
   // Qbar := Q(i)
@@ -122,6 +190,43 @@ void MCNLA_ALIAS::runImpl(
   this->toc(comm_time);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Reduces a pair of Q.
+///
+/// @param  matrix_qij   The matrix Q(i) (j-th row-block, where j is the MPI rank).
+/// @param  matrix_qihj  The matrix Q(i+h) (j-th row-block, where j is the MPI rank).
+/// @param  matrix_w     The matrix B(i) := Q(i)' * Q(i+h); replaced by W on exit.
+/// @param  task         The index of the task (i.e. the workspace).
+///
+template <typename _Val>
+void MCNLA_ALIAS::reducePair(
+          DenseMatrixRowMajor<_Val> &matrix_qij,
+    const DenseMatrixRowMajor<_Val> &matrix_qihj,
+          DenseMatrixRowMajor<_Val> &matrix_w,
+    const index_t task
+) noexcept {
+
+  const auto dim_sketch = parameters_.dimSketch();
+
+  auto &&matrix_t   = collection_t_(task);    // matrix T
+  auto &&vector_s   = matrix_s_(""_, task);   // vector S
+  auto &&matrix_tmp = collection_tmp_(task);  // matrix tmp
+
+  // svd(B(i)) = W * S * T'
+  gesvd_drivers_[task](matrix_w, vector_s, matrix_empty_, matrix_t.t());
+
+  // Q(i) := Q(i) * W + Q(i+h) * T
+  la::copy(matrix_qij, matrix_tmp);
+  la::mm(matrix_tmp, matrix_w, matrix_qij);
+  la::mm(matrix_qihj, matrix_t, matrix_qij, 1.0, 1.0);
+
+  // Q(i) /= sqrt(2(I + S))
+  for ( index_t ii = 0; ii < dim_sketch; ++ii ) {
+    vector_s(ii) = 1.0 / sqrt(2.0 * (1 + vector_s(ii)));
+  }
+  la::mm(""_, vector_s.diag(), matrix_qij);
+}
+
 }  // namespace isvd
 
 }  // namespace mcnla
@@ -10,7 +10,9 @@
 
 #include <mcnla/isvd/def.hpp>
 #include <mcnla/isvd/integrator/integrator.hpp>
+#include <vector>
 #include <mcnla/core/la.hpp>
+#include <mcnla/core/mpi.hpp>
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
   #define MCNLA_ALIAS0 Integrator
@@ -72,6 +74,9 @@ class MCNLA_ALIAS1
   /// The number of iteration.
   index_t iteration_;
 
+  /// The iteration monitor.
+  IterationMonitor<_Val> monitor_;
+
   /// The initial step size.
   _Val tau0_ = 1.0;
 
@@ -93,11 +98,38 @@ class MCNLA_ALIAS1
   /// The parameter for next step searching.
   _Val eta_ = 0.85;
 
+  /// The number of chunks in the pipelined reduction of Bgc.
+  index_t num_chunk_;
+
+  /// The tag shows if the integrator is warm-started.
+  bool is_warm_ = false;
+
+  /// The initial matrix Qbar (j-th row-block, where j is the MPI rank).
+  DenseMatrixRowMajor<_Val> matrix_qbar0j_;
+
+  /// The tag shows if the early iterations use single precision.
+  bool mixed_precision_ = false;
+
+  /// The tolerance of switching from single precision to full precision.
+  RealValT<_Val> switch_tolerance_ = 0;
+
+  /// The matrix Qs (single precision).
+  DenseMatrixRowMajor<float> matrix_qsjf_;
+
+  /// The matrix G (single precision).
+  DenseMatrixRowMajor<float> matrix_gjf_;
+
+  /// The matrix B (single precision).
+  DenseMatrixRowMajor<float> matrix_bf_;
+
+  /// The matrix Bg (single precision).
+  DenseMatrixRowMajor<float> matrix_bgf_;
+
   /// The matrix Qc and Q+.
   DenseMatrixCollectionRowBlockRowMajor<_Val> collection_qcj_;
 
-  /// The matrix Gc.
-  DenseMatrixRowMajor<_Val> matrix_gcj_;
+  /// The matrix Gc and G+.
+  DenseMatrixCollectionRowBlockRowMajor<_Val> collection_gcj_;
 
   /// The matrix Xc and X+.
   DenseMatrixCollectionRowBlockRowMajor<_Val> collection_xcj_;
@@ -123,6 +155,21 @@ class MCNLA_ALIAS1
   /// The GETRFI driver.
   la::DenseGetrfiDriverRowMajor<_Val> getrfi_driver_;
 
+  /// The matrix Z (for warm start).
+  DenseSymmetricMatrixRowMajor<_Val> symatrix_z_;
+
+  /// The vector S (for warm start).
+  DenseVector<_Val> vector_s_;
+
+  /// The SYEV driver (for warm start).
+  la::DenseSyevDriverRowMajor<'V', _Val> syev_driver_;
+
+  /// The requests of the pipelined reduction of Bgc.
+  std::vector<mpi::Request> requests_;
+
+  /// The aggregator of the last chunk of Bgc and the vector t.
+  mpi::Aggregator<_Val> aggregator_;
+
   using BaseType::parameters_;
   using BaseType::initialized_;
   using BaseType::computed_;
@@ -133,26 +180,48 @@ class MCNLA_ALIAS1
 
   // Constructor
   inline MCNLA_ALIAS0( const Parameters<_Val> &parameters,
-                     const index_t max_iteration = 256, const RealValT<_Val> tolerance = 1e-3 ) noexcept;
+                     const index_t max_iteration = 256, const RealValT<_Val> tolerance = 1e-3,
+                     const index_t num_chunk = 4 ) noexcept;
 
   // Gets parameters
   inline index_t        maxIteration() const noexcept;
   inline RealValT<_Val> tolerance() const noexcept;
+  inline index_t        numChunk() const noexcept;
+  inline bool           isMixedPrecision() const noexcept;
+  inline RealValT<_Val> switchTolerance() const noexcept;
   inline index_t        iteration() const noexcept;
+  inline const std::vector<IterationRecord<_Val>>& records() const noexcept;
 
   // Sets parameters
   inline MCNLA_ALIAS1& setMaxIteration( const index_t max_iteration ) noexcept;
   inline MCNLA_ALIAS1& setTolerance( const RealValT<_Val> tolerance ) noexcept;
+  inline MCNLA_ALIAS1& setNumChunk( const index_t num_chunk ) noexcept;
+  inline MCNLA_ALIAS1& setMixedPrecision( const bool mixed_precision ) noexcept;
+  inline MCNLA_ALIAS1& setSwitchTolerance( const RealValT<_Val> switch_tolerance ) noexcept;
+  inline MCNLA_ALIAS1& setInitialQbar( const DenseMatrixRowMajor<_Val> &matrix_qbarj ) noexcept;
+  inline MCNLA_ALIAS1& unsetInitialQbar() noexcept;
+  inline MCNLA_ALIAS1& setCallback( const typename IterationMonitor<_Val>::CallbackType &callback ) noexcept;
 
  protected:
 
   // Initializes
   void initializeImpl() noexcept;
 
+  // Gets memory requirement
+  inline std::size_t memoryRequirementImpl() const noexcept;
+
   // Initializes
   void runImpl( const DenseMatrixCollectionColBlockRowMajor<_Val> &collection_qj,
                       DenseMatrixRowMajor<_Val> &matrix_qbarj ) noexcept;
 
+  // Computes G
+  void computeG( const DenseMatrixRowMajor<_Val> &matrix_qsj, const DenseMatrixRowMajor<_Val> &matrix_b,
+                 DenseMatrixRowMajor<_Val> &matrix_gj, const bool is_single ) noexcept;
+
+  // Computes Bgc and posts its reduction
+  void postBg( const DenseMatrixRowMajor<_Val> &matrix_qsj, const DenseMatrixRowMajor<_Val> &matrix_gj,
+               const bool is_single, const bool post_last = true ) noexcept;
+
 };
 
 }  // namespace isvd
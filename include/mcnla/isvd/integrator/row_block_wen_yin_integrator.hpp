@@ -9,6 +9,8 @@
 #define MCNLA_ISVD_INTEGRATOR_ROW_BLOCK_WEN_YIN_INTEGRATOR_HPP_
 
 #include <mcnla/isvd/integrator/row_block_wen_yin_integrator.hh>
+#include <algorithm>
+#include <limits>
 #include <mcnla/core/la.hpp>
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -36,11 +38,13 @@ template <typename _Val>
 MCNLA_ALIAS::MCNLA_ALIAS0(
     const Parameters<_Val> &parameters,
     const index_t max_iteration,
-    const RealValT<_Val> tolerance
+    const RealValT<_Val> tolerance,
+    const index_t num_chunk
 ) noexcept
   : BaseType(parameters) {
   setMaxIteration(max_iteration);
   setTolerance(tolerance);
+  setNumChunk(num_chunk);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -54,7 +58,7 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   const auto dim_sketch_total = parameters_.dimSketchTotal();
 
   collection_qcj_.reconstruct(nrow_rank, dim_sketch, 2);
-  matrix_gcj_.reconstruct(nrow_rank, dim_sketch);
+  collection_gcj_.reconstruct(nrow_rank, dim_sketch, 2);
   collection_xcj_.reconstruct(nrow_rank, dim_sketch, 2);
 
   collection_bc_.reconstruct(dim_sketch_total, dim_sketch, 2);
@@ -68,6 +72,50 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   vector_t_.reconstruct(2);
 
   getrfi_driver_.reconstruct(matrix_c_);
+
+  symatrix_z_.reconstruct(dim_sketch);
+  vector_s_.reconstruct(dim_sketch);
+  syev_driver_.reconstruct(symatrix_z_);
+
+  if ( mixed_precision_ ) {
+    matrix_qsjf_.reconstruct(nrow_rank, dim_sketch_total);
+    matrix_gjf_.reconstruct(nrow_rank, dim_sketch);
+    matrix_bf_.reconstruct(dim_sketch_total, dim_sketch);
+    matrix_bgf_.reconstruct(dim_sketch_total, dim_sketch);
+  } else {
+    matrix_qsjf_ = DenseMatrixRowMajor<float>();
+    matrix_gjf_  = DenseMatrixRowMajor<float>();
+    matrix_bf_   = DenseMatrixRowMajor<float>();
+    matrix_bgf_  = DenseMatrixRowMajor<float>();
+  }
+
+  requests_.resize(std::min(num_chunk_, dim_sketch_total));
+
+  const auto num_chunk = static_cast<index_t>(requests_.size());
+  aggregator_.clear();
+  aggregator_.add(matrix_bgc_(I_{dim_sketch_total * (num_chunk-1) / num_chunk, dim_sketch_total}, ""_));
+  aggregator_.add(vector_t_);
+  aggregator_.pack();  // allocates the buffer
+
+  monitor_.reserve(max_iteration_);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t nrow_rank        = parameters_.nrowRank();
+  const std::size_t dim_sketch       = parameters_.dimSketch();
+  const std::size_t dim_sketch_total = parameters_.dimSketchTotal();
+
+  auto bytes = sizeof(_Val) * (6 * nrow_rank * dim_sketch + 3 * dim_sketch_total * dim_sketch
+                             + 7 * dim_sketch * dim_sketch + dim_sketch + 2);
+  if ( mixed_precision_ ) {
+    bytes += sizeof(float) * (nrow_rank * dim_sketch_total + nrow_rank * dim_sketch + 2 * dim_sketch_total * dim_sketch);
+  }
+  return bytes;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -96,6 +144,9 @@ void MCNLA_ALIAS::runImpl(
 
   _Val one_n = 1.0/num_sketch, one_2n = 0.5/num_sketch;
   _Val taug, zeta, phi, mu;
+  bool is_single = mixed_precision_;
+
+  monitor_.clear();
 
   double comm_moment, comm_time;
   this->tic(comm_time);
@@ -106,36 +157,93 @@ void MCNLA_ALIAS::runImpl(
 
     auto &&matrix_bc  = collection_bc_(0);   // matrix Bc.
     auto &&matrix_qcj = collection_qcj_(0);  // matrix Qc.
+    auto &&matrix_gcj = collection_gcj_(0);  // matrix Gc.
     auto &&matrix_xcj = collection_xcj_(0);  // matrix Xc.
 
-    // Qc := Q0
-    la::copy(collection_qj(0), matrix_qcj);
+    // Qs (single precision) := Qs
+    if ( is_single ) {
+      la::lag2(matrix_qsj, matrix_qsjf_);
+    }
+
+    bool is_cold = !is_warm_;
+
+    if ( is_warm_ ) {
+
+      auto &&symatrix_zinv = matrix_dc_.syml();  // matrix inv(sqrt(Z)).
+
+      // B0 [in Bc] := Qs' * Qbar0
+      la::mm(matrix_qsj.t(), matrix_qbar0j_, matrix_bc);
+      comm_moment = utility::getTime();
+      parameters_.allreduce(matrix_bc, MPI_SUM);
+      comm_time += utility::getTime() - comm_moment;
+
+      // G0 [in Gc] := 1/N * Qs * B0 (projection onto the sketch span)
+      la::mm(matrix_qsj, matrix_bc, matrix_gcj, one_n);
+
+      // Z := G0' * G0
+      la::memset0(symatrix_z_.full());
+      la::rk(matrix_gcj.t(), symatrix_z_);
+      comm_moment = utility::getTime();
+      parameters_.allreduce(symatrix_z_.full(), MPI_SUM);
+      comm_time += utility::getTime() - comm_moment;
+
+      // eig(Z) = Z' * S * Z
+      syev_driver_(symatrix_z_, vector_s_);
+
+      // Falls back to Q0 if G0 is (nearly) rank deficient, e.g. Qbar0 is nearly orthogonal to the sketches
+      // (the eigenvalues are at most one for an orthonormal Qbar0, so they are compared with one if they are all tiny)
+      is_cold = !(vector_s_(0) > std::numeric_limits<RealValT<_Val>>::epsilon()
+                                 * std::max(vector_s_(dim_sketch-1), RealValT<_Val>(1)));
+
+      if ( !is_cold ) {
+
+        // inv(sqrt(Z)) [in Dc] := Z' * inv(sqrt(S)) * Z
+        for ( auto &v : vector_s_ ) {
+          v = std::sqrt(std::sqrt(v));
+        }
+        la::sm(vector_s_.diag().inv(), symatrix_z_.full());
+        la::rk(symatrix_z_.full().t(), symatrix_zinv);
+
+        // Qc := G0 * inv(sqrt(Z)) [in Dc]
+        la::mm(matrix_gcj, symatrix_zinv, matrix_qcj);
+
+      }
+
+    }
+
+    if ( is_cold ) {
+
+      // Qc := Q0
+      la::copy(collection_qj(0), matrix_qcj);
+
+    }
 
     // Bc := Qs' * Qc
     la::mm(matrix_qsj.t(), matrix_qcj, matrix_bc);
     comm_moment = utility::getTime();
-    mpi::allreduce(matrix_bc, MPI_SUM, mpi_comm);
+    parameters_.allreduce(matrix_bc, MPI_SUM);
     comm_time += utility::getTime() - comm_moment;
 
     // Dc := 1/N * Bc' * Bc
     la::mm(matrix_bc.t(), matrix_bc, matrix_dc_, one_n);
 
     // Gc := 1/N * Qs * Bc
-    la::mm(matrix_qsj, matrix_bc, matrix_gcj_, one_n);
+    computeG(matrix_qsj, matrix_bc, matrix_gcj, is_single);
+
+    // Bgc := Qs' * Gc (nonblocking)
+    postBg(matrix_qsj, matrix_gcj, is_single);
+
+    // Xc := Gc - Qc * Dc
+    la::copy(matrix_gcj, matrix_xcj);
+    la::mm(matrix_qcj, matrix_dc_, matrix_xcj, -1.0, 1.0);
 
-    // Bgc := Qs' * Gc
-    la::mm(matrix_qsj.t(), matrix_gcj_, matrix_bgc_);
     comm_moment = utility::getTime();
-    mpi::allreduce(matrix_bgc_, MPI_SUM, mpi_comm);
+    mpi::waitAll(requests_);
     comm_time += utility::getTime() - comm_moment;
 
     // Dgc := 1/N * Bc' * Bgc
     la::mm(matrix_bc.t(), matrix_bgc_, matrix_dgc_, one_n);
 
-    // Xc := Gc - Qc * Dc
-    la::copy(matrix_gcj_, matrix_xcj);
-    la::mm(matrix_qcj, matrix_dc_, matrix_xcj, -1.0, 1.0);
-
     // taug := tau0; zeta := 1; phi := 1/2N * norm( Bc )_F
     taug = tau0_, zeta = 1.0, phi = one_2n * la::dot(matrix_bc.vec());
 
@@ -151,6 +259,8 @@ void MCNLA_ALIAS::runImpl(
   bool is_odd = false;
   for ( iteration_ = 0; iteration_ < max_iteration_; ++iteration_ ) {
 
+    const double iter_moment = utility::getTime(), iter_comm_moment = comm_time;
+
     auto idxs1 = I_{0_i, dim_sketch};
     auto idxs2 = idxs1 + dim_sketch;
     auto &&matrix_c11 = matrix_c_(idxs1, idxs1);  // matrix C11
@@ -164,6 +274,8 @@ void MCNLA_ALIAS::runImpl(
     auto &&matrix_bp  = collection_bc_(!is_odd);   // matrix B+.
     auto &&matrix_qcj = collection_qcj_(is_odd);   // matrix Qc.
     auto &&matrix_qpj = collection_qcj_(!is_odd);  // matrix Q+.
+    auto &&matrix_gcj = collection_gcj_(is_odd);   // matrix Gc.
+    auto &&matrix_gpj = collection_gcj_(!is_odd);  // matrix G+.
     auto &&matrix_xcj = collection_xcj_(is_odd);   // matrix Xc.
     auto &&matrix_xpj = collection_xcj_(!is_odd);  // matrix X+.
     auto &matrix_fc   = matrix_c21;  // matrix Fc
@@ -173,7 +285,9 @@ void MCNLA_ALIAS::runImpl(
     // ================================================================================================================== //
     // Find step size
     _Val tau = taug, phit = phi;
+    index_t num_line_search = 0;
     for ( auto tauiter = 0; tauiter < taumaxiter_; ++tauiter, tau *= beta_ ) {
+      ++num_line_search;
 
       // C := [ Dc/2 - I/tau , I/2          ;
       //       -Dgc/2,        -Dc/2 - I/tau ]
@@ -213,47 +327,28 @@ void MCNLA_ALIAS::runImpl(
     phi = (eta_ * zeta * phi + phit) / (eta_ * zeta + 1);
     zeta = eta_ * zeta + 1;
 
+    // G+ := 1/N * Qs * B+
+    computeG(matrix_qsj, matrix_bp, matrix_gpj, is_single);
+
+    // Bg+ [in Bgc] := Qs' * G+ (nonblocking, except the last chunk)
+    postBg(matrix_qsj, matrix_gpj, is_single, false);
+
     // Q+ := Qc * Fc + Gc * Fgc
     la::mm(matrix_qcj, matrix_fc, matrix_qpj);
-    la::mm(matrix_gcj_, matrix_fgc, matrix_qpj, 1.0, 1.0);
+    la::mm(matrix_gcj, matrix_fgc, matrix_qpj, 1.0, 1.0);
 
     // D+ [in Dc] := 1/N * B+' * B+
     la::mm(matrix_bp.t(), matrix_bp, matrix_dc_, one_n);
 
-    // G+ [in Gc] := 1/N * Qs * B+
-    la::mm(matrix_qsj, matrix_bp, matrix_gcj_, one_n);
-
-    // Bg+ [in Bgc] := Qs' * G+ [in Gc]
-    la::mm(matrix_qsj.t(), matrix_gcj_, matrix_bgc_);
-    comm_moment = utility::getTime();
-    mpi::allreduce(matrix_bgc_, MPI_SUM, mpi_comm);
-    comm_time += utility::getTime() - comm_moment;
-
-    // Dg+ [in Dgc] := 1/N * B+' * Bg+ [in Bgc]
-    la::mm(matrix_bp.t(), matrix_bgc_, matrix_dgc_, one_n);
-
-    // mu := tr( Dg+ [in Dgc] ) - norm( D+ [in Dc] )_F
-    mu = la::asum(matrix_dgc_.diag().vec()) - la::dot(matrix_dc_.vec());
-
-    // ================================================================================================================== //
-    // Check convergence: mu  < tol^2
-    if ( mu < tolerance_ * tolerance_ ) {
-      ++iteration_;
-      break;
-    }
-
-    // ================================================================================================================== //
-    // Update taug
-
-    // X+ := G+ [in Gc] - Q+ * D+ [in Dc]
-    la::copy(matrix_gcj_, matrix_xpj);
+    // X+ := G+ - Q+ * D+ [in Dc]
+    la::copy(matrix_gpj, matrix_xpj);
     la::mm(matrix_qpj, matrix_dc_, matrix_xpj, -1.0, 1.0);
 
     // Delta1 [in Qc] := Qc - Q+; Delta2 [in Xc] := Xc - X+
+    // (computed before the convergence check so that t is reduced together with Bg+)
     la::axpy(matrix_qpj.vec(), matrix_qcj.vec(), -1.0);
     la::axpy(matrix_xpj.vec(), matrix_xcj.vec(), -1.0);
 
-    // Update taug
     auto &t1 = vector_t_(0);
     auto &t2 = vector_t_(1);
 
@@ -265,10 +360,40 @@ void MCNLA_ALIAS::runImpl(
       t2 = la::dot(matrix_xcj.vec());
     }
 
+    // Reduce the last chunk of Bg+ and t together
+    requests_.back() = aggregator_.iallreduce(MPI_SUM, mpi_comm);
+
     comm_moment = utility::getTime();
-    mpi::allreduce(vector_t_, MPI_SUM, mpi_comm);
+    mpi::waitAll(requests_);
     comm_time += utility::getTime() - comm_moment;
+    aggregator_.unpack();
+
+    // Dg+ [in Dgc] := 1/N * B+' * Bg+ [in Bgc]
+    la::mm(matrix_bp.t(), matrix_bgc_, matrix_dgc_, one_n);
+
+    // mu := tr( Dg+ [in Dgc] ) - norm( D+ [in Dc] )_F
+    mu = la::asum(matrix_dgc_.diag().vec()) - la::dot(matrix_dc_.vec());
+
+    // ================================================================================================================== //
+    // Record the iteration
+    const double iter_comm_time = comm_time - iter_comm_moment;
+    const double iter_time      = utility::getTime() - iter_moment - iter_comm_time;
+    const bool is_stopped = monitor_.record({iteration_, mu, tau, num_line_search, iter_time, iter_comm_time});
+
+    // ================================================================================================================== //
+    // Check convergence: mu  < tol^2
+    if ( (!is_single && mu < tolerance_ * tolerance_) || is_stopped ) {
+      ++iteration_;
+      break;
+    }
+
+    // Switch to full precision: mu < max(switch_tol, tol)^2
+    if ( is_single && (mu < switch_tolerance_ * switch_tolerance_ || mu < tolerance_ * tolerance_) ) {
+      is_single = false;
+    }
 
+    // ================================================================================================================== //
+    // Update taug
     taug = std::abs(t1/t2);
     if ( taug < taumin_ ) { taug = taumin_; }
     if ( taug > taumax_ ) { taug = taumax_; }
@@ -280,6 +405,80 @@ void MCNLA_ALIAS::runImpl(
   this->toc(comm_time);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Computes G := 1/N * Qs * B.
+///
+/// @param  matrix_qsj  The matrix Qs (j-th row-block, where j is the MPI rank).
+/// @param  matrix_b    The matrix B.
+/// @param  matrix_gj   The matrix G (j-th row-block, where j is the MPI rank).
+/// @param  is_single   Whether to compute in single precision (through #matrix_qsjf_). If so, the single precision G is
+///                     also stored in #matrix_gjf_.
+///
+template <typename _Val>
+void MCNLA_ALIAS::computeG(
+    const DenseMatrixRowMajor<_Val> &matrix_qsj,
+    const DenseMatrixRowMajor<_Val> &matrix_b,
+          DenseMatrixRowMajor<_Val> &matrix_gj,
+    const bool is_single
+) noexcept {
+
+  const _Val one_n = 1.0/parameters_.numSketch();
+
+  if ( is_single ) {
+    la::lag2(matrix_b, matrix_bf_);
+    la::mm(matrix_qsjf_, matrix_bf_, matrix_gjf_, one_n);
+    la::lag2(matrix_gjf_, matrix_gj);
+  } else {
+    la::mm(matrix_qsj, matrix_b, matrix_gj, one_n);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Computes Bg := Qs' * G and posts its reduction.
+///
+/// Bg is split into row chunks. The reduction of each chunk is posted as soon as it is computed, and overlaps with the
+/// computation of the next chunk. The requests are stored in #requests_ and should be waited before Bg is used.
+///
+/// @param  matrix_qsj  The matrix Qs (j-th row-block, where j is the MPI rank).
+/// @param  matrix_gj   The matrix G (j-th row-block, where j is the MPI rank).
+/// @param  is_single   Whether to compute in single precision (through #matrix_qsjf_ and #matrix_gjf_).
+/// @param  post_last   Whether to post the reduction of the last chunk. If not, the caller should post it (through
+///                     #aggregator_) into the last entry of #requests_.
+///
+template <typename _Val>
+void MCNLA_ALIAS::postBg(
+    const DenseMatrixRowMajor<_Val> &matrix_qsj,
+    const DenseMatrixRowMajor<_Val> &matrix_gj,
+    const bool is_single,
+    const bool post_last
+) noexcept {
+
+  const auto mpi_comm         = parameters_.mpi_comm;
+  const auto dim_sketch_total = parameters_.dimSketchTotal();
+  const auto num_chunk        = static_cast<index_t>(requests_.size());
+
+  for ( index_t i = 0; i < num_chunk; ++i ) {
+    auto idxs = I_{dim_sketch_total * i / num_chunk, dim_sketch_total * (i+1) / num_chunk};
+    auto &&matrix_bgc_i = matrix_bgc_(idxs, ""_);
+
+    // Bg(i) := Qs(i)' * G
+    if ( is_single ) {
+      auto &&matrix_bgf_i = matrix_bgf_(idxs, ""_);
+      la::mm(matrix_qsjf_(""_, idxs).t(), matrix_gjf_, matrix_bgf_i);
+      la::lag2(matrix_bgf_i, matrix_bgc_i);
+    } else {
+      la::mm(matrix_qsj(""_, idxs).t(), matrix_gj, matrix_bgc_i);
+    }
+    if ( i == num_chunk-1 && !post_last ) {
+      break;
+    }
+    requests_[i] = mpi::iallreduce(matrix_bgc_i, MPI_SUM, mpi_comm);
+
+    // Progress the posted reductions
+    mpi::testAll(requests_);
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Gets the maximum number of iteration.
 ///
@@ -296,6 +495,30 @@ RealValT<_Val> MCNLA_ALIAS::tolerance() const noexcept {
   return tolerance_;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of chunks in the pipelined reduction.
+///
+template <typename _Val>
+index_t MCNLA_ALIAS::numChunk() const noexcept {
+  return num_chunk_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Determines if the early iterations use single precision.
+///
+template <typename _Val>
+bool MCNLA_ALIAS::isMixedPrecision() const noexcept {
+  return mixed_precision_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the tolerance of switching from single precision to full precision.
+///
+template <typename _Val>
+RealValT<_Val> MCNLA_ALIAS::switchTolerance() const noexcept {
+  return switch_tolerance_;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Gets the number of iteration.
 ///
@@ -305,6 +528,17 @@ index_t MCNLA_ALIAS::iteration() const noexcept {
   return iteration_;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the records of each iteration.
+///
+/// @see  IterationRecord
+///
+template <typename _Val>
+const std::vector<IterationRecord<_Val>>& MCNLA_ALIAS::records() const noexcept {
+  mcnla_assert_true(this->isComputed());
+  return monitor_.records();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Sets the maximum number of iteration.
 ///
@@ -333,6 +567,108 @@ MCNLA_ALIAS& MCNLA_ALIAS::setTolerance(
   return *this;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the number of chunks in the pipelined reduction.
+///
+template <typename _Val>
+MCNLA_ALIAS& MCNLA_ALIAS::setNumChunk(
+    const index_t num_chunk
+) noexcept {
+  mcnla_assert_gt(num_chunk, 0);
+  num_chunk_ = num_chunk;
+  initialized_ = false;
+  computed_ = false;
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the mixed precision mode.
+///
+/// If enabled, a single precision copy of Qs is kept, and the products with Qs (i.e. G := 1/N * Qs * B and Bg := Qs' * G)
+/// are computed in single precision until sqrt(mu) is less than #switchTolerance (or the tolerance of convergence
+/// condition). The remaining iterations use full precision to reach the tolerance of convergence condition.
+///
+/// @note  This halves the memory traffic over Qs in the early iterations. It is useless if @a _Val is @c float.
+///
+template <typename _Val>
+MCNLA_ALIAS& MCNLA_ALIAS::setMixedPrecision(
+    const bool mixed_precision
+) noexcept {
+  mixed_precision_ = mixed_precision;
+  initialized_ = false;
+  computed_ = false;
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the tolerance of switching from single precision to full precision.
+///
+/// The default value is zero, i.e., single precision is used until the tolerance of convergence condition is reached.
+///
+/// @see  setMixedPrecision
+///
+template <typename _Val>
+MCNLA_ALIAS& MCNLA_ALIAS::setSwitchTolerance(
+    const RealValT<_Val> switch_tolerance
+) noexcept {
+  mcnla_assert_ge(switch_tolerance, 0);
+  switch_tolerance_ = switch_tolerance;
+  computed_ = false;
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the initial matrix Qbar (warm start).
+///
+/// The iteration starts from the orthonormalized projection of @a matrix_qbarj onto the span of the sketches, instead of
+/// Q0. For example, pass the result of the previous run when decomposing a slowly changing matrix.
+///
+/// @param  matrix_qbarj  The initial matrix Qbarj (j-th row-block, where j is the MPI rank).
+///
+/// @note  If the projection is (nearly) rank deficient, e.g. @a matrix_qbarj is nearly orthogonal to the sketches, the
+///        iteration starts from Q0 instead.
+///
+/// @attention  @a matrix_qbarj is not copied. It should not be released before the integration.
+///
+template <typename _Val>
+MCNLA_ALIAS& MCNLA_ALIAS::setInitialQbar(
+    const DenseMatrixRowMajor<_Val> &matrix_qbarj
+) noexcept {
+  mcnla_assert_eq(matrix_qbarj.sizes(), std::make_tuple(parameters_.nrowRank(), parameters_.dimSketch()));
+  matrix_qbar0j_ = matrix_qbarj;
+  is_warm_ = true;
+  computed_ = false;
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Unsets the initial matrix Qbar (i.e. starts from Q0).
+///
+template <typename _Val>
+MCNLA_ALIAS& MCNLA_ALIAS::unsetInitialQbar() noexcept {
+  matrix_qbar0j_ = DenseMatrixRowMajor<_Val>();
+  is_warm_ = false;
+  computed_ = false;
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the callback called after each iteration.
+///
+/// The integrator stops if @a callback returns @c true.
+///
+/// @attention  @a callback is called on all MPI nodes. It should return the same value on all of them.
+///
+/// @see  IterationMonitor::setCallback
+///
+template <typename _Val>
+MCNLA_ALIAS& MCNLA_ALIAS::setCallback(
+    const typename IterationMonitor<_Val>::CallbackType &callback
+) noexcept {
+  monitor_.setCallback(callback);
+  return *this;
+}
+
 }  // namespace isvd
 
 }  // namespace mcnla
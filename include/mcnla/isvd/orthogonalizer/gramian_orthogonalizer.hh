@@ -90,6 +90,9 @@ class MCNLA_ALIAS1
   // Initializes
   void initializeImpl() noexcept;
 
+  // Gets memory requirement
+  inline std::size_t memoryRequirementImpl() const noexcept;
+
   // Orthogonalizes
   void runImpl( DenseMatrixCollectionColBlockRowMajor<_Val> &collection_q ) noexcept;
 
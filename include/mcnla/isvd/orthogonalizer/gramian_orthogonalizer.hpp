@@ -54,6 +54,19 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   gesvd_driver_.reconstruct(dim_sketch, dim_sketch);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t nrow            = parameters_.nrow();
+  const std::size_t num_sketch_each = parameters_.numSketchEach();
+  const std::size_t dim_sketch      = parameters_.dimSketch();
+
+  return sizeof(_Val) * num_sketch_each * (dim_sketch * dim_sketch + dim_sketch + nrow * dim_sketch);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Orthogonalizes.
 ///
@@ -51,6 +51,17 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   geqrfg_driver_.reconstruct(nrow, dim_sketch);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t dim_sketch = parameters_.dimSketch();
+
+  return sizeof(_Val) * dim_sketch;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Orthogonalizes.
 ///
@@ -54,6 +54,19 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   gesvd_driver_.reconstruct(dim_sketch, dim_sketch);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t nrow_rank  = parameters_.nrowRank();
+  const std::size_t num_sketch = parameters_.numSketch();
+  const std::size_t dim_sketch = parameters_.dimSketch();
+
+  return sizeof(_Val) * num_sketch * (dim_sketch * dim_sketch + dim_sketch + nrow_rank * dim_sketch);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Orthogonalizes.
 ///
@@ -64,7 +77,6 @@ void MCNLA_ALIAS::runImpl(
     DenseMatrixCollectionColBlockRowMajor<_Val> &collection_qj
 ) noexcept {
 
-  const auto mpi_comm   = parameters_.mpi_comm;
   const auto num_sketch = parameters_.numSketch();
 
   mcnla_assert_eq(collection_qj.sizes(), std::make_tuple(parameters_.nrowRank(), parameters_.dimSketch(), num_sketch));
@@ -83,7 +95,7 @@ void MCNLA_ALIAS::runImpl(
 
   // Reduce sum Wi
   comm_moment = utility::getTime();
-  mpi::allreduce(collection_w_.unfold(), MPI_SUM, mpi_comm);
+  parameters_.allreduce(collection_w_.unfold(), MPI_SUM);
   comm_time += utility::getTime() - comm_moment;
 
   // Compute the eigen-decomposition of Wi -> Wi' * Si * Wi
@@ -10,6 +10,7 @@
 
 #include <mcnla/isvd/def.hpp>
 #include <mcnla/isvd/sketcher/sketcher.hpp>
+#include <mcnla/core/random/streams.hpp>
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
   #define MCNLA_ALIAS0 Sketcher
@@ -38,6 +39,9 @@ template <typename _Val> using ColBlockGaussianProjectionSketcher = Sketcher<Col
 /// @ingroup  isvd_sketcher_module
 /// The Gaussian projection sketcher (column-block version).
 ///
+/// The random sketches can be split into tiles (see #setNumTile), so that only the random matrix Omega of one tile is stored.
+/// The tiles are generated and projected one by one.
+///
 /// @tparam  _Val  The value type.
 ///
 template <typename _Val>
@@ -61,9 +65,15 @@ class MCNLA_ALIAS1
   /// The random seed.
   index_t seed_;
 
+  /// The number of tiles of the random sketches.
+  index_t num_tile_ = 1;
+
   /// The matrix Omegas.
   DenseMatrixRowMajor<_Val> matrix_omegajs_;
 
+  /// The random streams (reset by each run).
+  random::Streams streams_;
+
   using BaseType::parameters_;
   using BaseType::initialized_;
   using BaseType::computed_;
@@ -77,9 +87,11 @@ class MCNLA_ALIAS1
 
   // Gets parameters
   inline index_t seed() const noexcept;
+  inline index_t numTile() const noexcept;
 
   // Sets parameters
   inline MCNLA_ALIAS1& setSeed( const index_t seed ) noexcept;
+  inline MCNLA_ALIAS1& setNumTile( const index_t num_tile ) noexcept;
 
 
  protected:
@@ -87,6 +99,13 @@ class MCNLA_ALIAS1
   // Initializes
   void initializeImpl() noexcept;
 
+  // Memory
+  inline std::size_t memoryRequirementImpl() const noexcept;
+  inline void fitMemoryImpl( const std::size_t limit ) noexcept;
+
+  // Gets the number of random sketches per tile
+  inline index_t numSketchTile() const noexcept;
+
   // Random sketches
   template <class _Matrix>
   void runImpl( const _Matrix &matrix_ajc, DenseMatrixCollectionColBlockRowMajor<_Val> &collection_qjp ) noexcept;
@@ -9,6 +9,7 @@
 #define MCNLA_ISVD_SKETCHER_COL_BLOCK_GAUSSIAN_PROJECTION_SKETCHER_HPP_
 
 #include <mcnla/isvd/sketcher/col_block_gaussian_projection_sketcher.hh>
+#include <algorithm>
 #include <mcnla/core/la.hpp>
 #include <mcnla/core/random.hpp>
 
@@ -38,7 +39,8 @@ MCNLA_ALIAS::MCNLA_ALIAS0(
     const Parameters<_Val> &parameters,
     const index_t seed
 ) noexcept
-  : BaseType(parameters) {
+  : BaseType(parameters),
+    streams_(seed) {
   setSeed(seed);
 }
 
@@ -48,10 +50,52 @@ MCNLA_ALIAS::MCNLA_ALIAS0(
 template <typename _Val>
 void MCNLA_ALIAS::initializeImpl() noexcept {
 
-  const auto ncol_rank        = parameters_.ncolRank();
-  const auto dim_sketch_total = parameters_.dimSketchTotal();
+  const auto ncol_rank  = parameters_.ncolRank();
+  const auto dim_sketch = parameters_.dimSketch();
+
+  matrix_omegajs_.reconstruct(ncol_rank, dim_sketch * numSketchTile());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t ncol_rank  = parameters_.ncolRank();
+  const std::size_t dim_sketch = parameters_.dimSketch();
 
-  matrix_omegajs_.reconstruct(ncol_rank, dim_sketch_total);
+  return sizeof(_Val) * ncol_rank * dim_sketch * numSketchTile();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::fitMemory
+///
+/// Chooses the least number of tiles so that the memory requirement is at most @a limit.
+///
+template <typename _Val>
+void MCNLA_ALIAS::fitMemoryImpl(
+    const std::size_t limit
+) noexcept {
+
+  const auto num_sketch = parameters_.numSketch();
+
+  for ( num_tile_ = 1; num_tile_ < num_sketch; ++num_tile_ ) {
+    if ( memoryRequirementImpl() <= limit ) {
+      break;
+    }
+  }
+  initialized_ = false;
+  computed_ = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of random sketches per tile.
+///
+template <typename _Val>
+index_t MCNLA_ALIAS::numSketchTile() const noexcept {
+  const auto num_sketch = parameters_.numSketch();
+  return (num_sketch-1) / std::min(num_tile_, num_sketch) + 1;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -81,24 +125,50 @@ void MCNLA_ALIAS::runImpl(
   mcnla_assert_eq(matrix_ajc.sizes(),     std::make_tuple(nrow, ncol_rank));
   mcnla_assert_eq(collection_qjp.sizes(), std::make_tuple(nrow, dim_sketch, num_sketch));
 
-  random::Streams streams(seed_, mpi_root, mpi_comm);
+  streams_.resetSeeds(seed_, mpi_root, mpi_comm);
+
+  const auto num_sketch_tile = numSketchTile();
 
   double comm_time;
   this->tic(comm_time);
-  // ====================================================================================================================== //
-  // Random generating
-
-  // Random sample Omega using normal Gaussian distribution
-  random::gaussian(streams, matrix_omegajs_.vec());
-
-  this->toc(comm_time);
-  // ====================================================================================================================== //
-  // Projection
-
-  // Q := A * Omega
-  la::mm(matrix_ajc, matrix_omegajs_, collection_qjp.unfold());
-
-  this->toc(comm_time);
+  if ( num_sketch_tile == num_sketch ) {
+    // ==================================================================================================================== //
+    // Random generating
+
+    // Random sample Omega using normal Gaussian distribution
+    random::gaussian(streams_, matrix_omegajs_.vec());
+
+    this->toc(comm_time);
+    // ==================================================================================================================== //
+    // Projection
+
+    // Q := A * Omega
+    la::mm(matrix_ajc, matrix_omegajs_, collection_qjp.unfold());
+
+    this->toc(comm_time);
+  } else {
+    // ==================================================================================================================== //
+    // Random generating & projection (tile by tile)
+
+    double gen_time = 0.0;
+    for ( index_t i = 0; i < num_sketch; i += num_sketch_tile ) {
+      const IdxRange range = {i, std::min(i+num_sketch_tile, num_sketch)};
+      auto collection_qjpt = collection_qjp(range);
+
+      // Random sample Omega using normal Gaussian distribution
+      const double gen_moment = utility::getTime();
+      random::gaussian(streams_, matrix_omegajs_.vec());
+      gen_time += utility::getTime() - gen_moment;
+
+      // Qt := A * Omega
+      la::mm(matrix_ajc, matrix_omegajs_(""_, {0_i, range.len() * dim_sketch}), collection_qjpt.unfold());
+    }
+
+    // Records the random generating and the projection as two parts
+    moments_.emplace_back(moments_.front() + gen_time);
+    comm_times_.emplace_back(0.0);
+    this->toc(comm_time);
+  }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -120,6 +190,14 @@ index_t MCNLA_ALIAS::seed() const noexcept {
   return seed_;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of tiles of the random sketches.
+///
+template <typename _Val>
+index_t MCNLA_ALIAS::numTile() const noexcept {
+  return num_tile_;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Sets the random seed.
 ///
@@ -132,6 +210,22 @@ MCNLA_ALIAS& MCNLA_ALIAS::setSeed(
   return *this;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the number of tiles of the random sketches.
+///
+/// @note  The random sketches depend on the number of tiles.
+///
+template <typename _Val>
+MCNLA_ALIAS& MCNLA_ALIAS::setNumTile(
+    const index_t num_tile
+) noexcept {
+  mcnla_assert_gt(num_tile, 0);
+  num_tile_ = num_tile;
+  initialized_ = false;
+  computed_ = false;
+  return *this;
+}
+
 }  // namespace isvd
 
 }  // namespace mcnla
@@ -38,7 +38,8 @@ MCNLA_ALIAS::MCNLA_ALIAS0(
     const Parameters<_Val> &parameters,
     const index_t seed
 ) noexcept
-  : BaseType(parameters) {
+  : BaseType(parameters),
+    streams_(seed) {
   setSeed(seed);
 }
 
@@ -53,6 +54,17 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   vector_idxs_.reconstruct(dim_sketch_each);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t dim_sketch_each = parameters_.dimSketchEach();
+
+  return sizeof(index_t) * dim_sketch_each;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Sketches.
 ///
@@ -76,7 +88,7 @@ void MCNLA_ALIAS::runImpl(
   mcnla_assert_eq(matrix_a.sizes(),     std::make_tuple(nrow, ncol));
   mcnla_assert_eq(collection_q.sizes(), std::make_tuple(nrow, dim_sketch, num_sketch_each));
 
-  random::Streams streams(seed_, mpi_root, mpi_comm);
+  streams_.resetSeeds(seed_, mpi_root, mpi_comm);
 
   double comm_time;
   this->tic(comm_time);
@@ -84,7 +96,7 @@ void MCNLA_ALIAS::runImpl(
   // Random generating
 
   // Random sample Idxs using uniform distribution
-  random::uniformBits(streams, vector_idxs_);
+  random::uniformBits(streams_, vector_idxs_);
 
   this->toc(comm_time);
   // ====================================================================================================================== //
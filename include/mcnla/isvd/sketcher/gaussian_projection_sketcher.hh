@@ -10,6 +10,7 @@
 
 #include <mcnla/isvd/def.hpp>
 #include <mcnla/isvd/sketcher/sketcher.hpp>
+#include <mcnla/core/random/streams.hpp>
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
   #define MCNLA_ALIAS0 Sketcher
@@ -67,6 +68,9 @@ class MCNLA_ALIAS1
   /// The matrix Omegas.
   DenseMatrixRowMajor<_Val> matrix_omegas_;
 
+  /// The random streams (reset by each run).
+  random::Streams streams_;
+
   using BaseType::parameters_;
   using BaseType::initialized_;
   using BaseType::computed_;
@@ -92,6 +96,9 @@ class MCNLA_ALIAS1
   // Initializes
   void initializeImpl() noexcept;
 
+  // Gets memory requirement
+  inline std::size_t memoryRequirementImpl() const noexcept;
+
   // Random sketches
   template <class _Matrix>
   void runImpl( const _Matrix &matrix_a, DenseMatrixCollectionColBlockRowMajor<_Val> &collection_q ) noexcept;
@@ -39,7 +39,8 @@ MCNLA_ALIAS::MCNLA_ALIAS0(
     const index_t seed,
     const index_t exponent
 ) noexcept
-  : BaseType(parameters) {
+  : BaseType(parameters),
+    streams_(seed) {
   setSeed(seed);
   setExponent(exponent);
 }
@@ -56,6 +57,18 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   matrix_omegas_.reconstruct(ncol, dim_sketch_each);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t ncol            = parameters_.ncol();
+  const std::size_t dim_sketch_each = parameters_.dimSketchEach();
+
+  return sizeof(_Val) * ncol * dim_sketch_each;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Sketches.
 ///
@@ -69,6 +82,7 @@ void MCNLA_ALIAS::runImpl(
 ) noexcept {
 
   const auto mpi_comm        = parameters_.mpi_comm;
+  const auto mpi_size        = parameters_.mpi_size;
   const auto mpi_root        = parameters_.mpi_root;
   const auto nrow            = parameters_.nrow();
   const auto ncol            = parameters_.ncol();
@@ -78,7 +92,12 @@ void MCNLA_ALIAS::runImpl(
   mcnla_assert_eq(matrix_a.sizes(),     std::make_tuple(nrow, ncol));
   mcnla_assert_eq(collection_q.sizes(), std::make_tuple(nrow, dim_sketch, num_sketch_each));
 
-  random::Streams streams(seed_, mpi_root, mpi_comm);
+  // Scatters the seeds only if there are more than one MPI node
+  if ( mpi_size > 1 ) {
+    streams_.resetSeeds(seed_, mpi_root, mpi_comm);
+  } else {
+    streams_.resetSeed(seed_);
+  }
 
   double comm_time;
   this->tic(comm_time);
@@ -86,7 +105,7 @@ void MCNLA_ALIAS::runImpl(
   // Random generating
 
   // Random sample Omega using normal Gaussian distribution
-  random::gaussian(streams, matrix_omegas_.vec());
+  random::gaussian(streams_, matrix_omegas_.vec());
 
   this->toc(comm_time);
   // ====================================================================================================================== //
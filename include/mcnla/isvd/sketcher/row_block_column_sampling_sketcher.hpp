@@ -38,7 +38,8 @@ MCNLA_ALIAS::MCNLA_ALIAS0(
     const Parameters<_Val> &parameters,
     const index_t seed
 ) noexcept
-  : BaseType(parameters) {
+  : BaseType(parameters),
+    streams_(seed) {
   setSeed(seed);
 }
 
@@ -53,6 +54,17 @@ void MCNLA_ALIAS::initializeImpl() noexcept {
   vector_idxs_.reconstruct(dim_sketch_total);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t dim_sketch_total = parameters_.dimSketchTotal();
+
+  return sizeof(index_t) * dim_sketch_total;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Sketches.
 ///
@@ -73,13 +85,17 @@ void MCNLA_ALIAS::runImpl(
   const auto dim_sketch_total = parameters_.dimSketchTotal();
   const auto num_sketch       = parameters_.numSketch();
 
+  static_cast<void>(nrow_rank);
+  static_cast<void>(dim_sketch);
+  static_cast<void>(num_sketch);
+
   mcnla_assert_eq(matrix_aj.sizes(),     std::make_tuple(nrow_rank, ncol));
   mcnla_assert_eq(collection_qj.sizes(), std::make_tuple(nrow_rank, dim_sketch, num_sketch));
 
   constexpr const MPI_Datatype datatype = traits::MpiValTraits<index_t>::datatype;
   index_t seed_tmp = seed_;
   MPI_Bcast(&seed_tmp, 1, datatype, mpi_root, mpi_comm);
-  random::Streams streams(seed_tmp);
+  streams_.resetSeed(seed_tmp);
 
   double comm_time;
   this->tic(comm_time);
@@ -87,7 +103,7 @@ void MCNLA_ALIAS::runImpl(
   // Random generating
 
   // Random sample Idxs using uniform distribution
-  random::uniformBits(streams, vector_idxs_);
+  random::uniformBits(streams_, vector_idxs_);
 
   this->toc(comm_time);
   // ====================================================================================================================== //
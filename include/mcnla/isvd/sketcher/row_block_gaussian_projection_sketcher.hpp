@@ -9,6 +9,7 @@
 #define MCNLA_ISVD_SKETCHER_ROW_BLOCK_GAUSSIAN_PROJECTION_SKETCHER_HPP_
 
 #include <mcnla/isvd/sketcher/row_block_gaussian_projection_sketcher.hh>
+#include <algorithm>
 #include <mcnla/core/la.hpp>
 #include <mcnla/core/random.hpp>
 
@@ -39,7 +40,8 @@ MCNLA_ALIAS::MCNLA_ALIAS0(
     const index_t seed,
     const index_t exponent
 ) noexcept
-  : BaseType(parameters) {
+  : BaseType(parameters),
+    streams_(seed) {
   setSeed(seed);
   setExponent(exponent);
 }
@@ -50,10 +52,52 @@ MCNLA_ALIAS::MCNLA_ALIAS0(
 template <typename _Val>
 void MCNLA_ALIAS::initializeImpl() noexcept {
 
-  const auto ncol             = parameters_.ncol();
-  const auto dim_sketch_total = parameters_.dimSketchTotal();
+  const auto ncol       = parameters_.ncol();
+  const auto dim_sketch = parameters_.dimSketch();
+
+  matrix_omegas_.reconstruct(ncol, dim_sketch * numSketchTile());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <typename _Val>
+std::size_t MCNLA_ALIAS::memoryRequirementImpl() const noexcept {
+
+  const std::size_t ncol       = parameters_.ncol();
+  const std::size_t dim_sketch = parameters_.dimSketch();
+
+  return sizeof(_Val) * ncol * dim_sketch * numSketchTile();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::fitMemory
+///
+/// Chooses the least number of tiles so that the memory requirement is at most @a limit.
+///
+template <typename _Val>
+void MCNLA_ALIAS::fitMemoryImpl(
+    const std::size_t limit
+) noexcept {
 
-  matrix_omegas_.reconstruct(ncol, dim_sketch_total);
+  const auto num_sketch = parameters_.numSketch();
+
+  for ( num_tile_ = 1; num_tile_ < num_sketch; ++num_tile_ ) {
+    if ( memoryRequirementImpl() <= limit ) {
+      break;
+    }
+  }
+  initialized_ = false;
+  computed_ = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of random sketches per tile.
+///
+template <typename _Val>
+index_t MCNLA_ALIAS::numSketchTile() const noexcept {
+  const auto num_sketch = parameters_.numSketch();
+  return (num_sketch-1) / std::min(num_tile_, num_sketch) + 1;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -86,31 +130,57 @@ void MCNLA_ALIAS::runImpl(
   constexpr const MPI_Datatype datatype = traits::MpiValTraits<index_t>::datatype;
   index_t seed_tmp = seed_;
   MPI_Bcast(&seed_tmp, 1, datatype, mpi_root, mpi_comm);
-  random::Streams streams(seed_tmp);
+  streams_.resetSeed(seed_tmp);
+
+  const auto num_sketch_tile = numSketchTile();
 
   double comm_moment, comm_time;
   this->tic(comm_time);
-  // ====================================================================================================================== //
-  // Random generating
-
-  // Random sample Omega using normal Gaussian distribution
-  random::gaussian(streams, matrix_omegas_.vec());
-
-  this->toc(comm_time);
-  // ====================================================================================================================== //
-  // Projection
-
-  // Q := A * Omega
-  la::mm(matrix_aj, matrix_omegas_, collection_qj.unfold());
-  for ( index_t i = 0; i < exponent_; ++i ) {
-    la::mm(matrix_aj.t(), collection_qj.unfold(), matrix_omegas_);
-    comm_moment = utility::getTime();
-    mpi::allreduce(matrix_omegas_, MPI_SUM, mpi_comm);
-    comm_time += utility::getTime() - comm_moment;
+  if ( num_sketch_tile == num_sketch ) {
+    // ==================================================================================================================== //
+    // Random generating
+
+    // Random sample Omega using normal Gaussian distribution
+    random::gaussian(streams_, matrix_omegas_.vec());
+
+    this->toc(comm_time);
+    // ==================================================================================================================== //
+    // Projection
+
+    // Q := A * Omega
     la::mm(matrix_aj, matrix_omegas_, collection_qj.unfold());
-  }
+    for ( index_t i = 0; i < exponent_; ++i ) {
+      la::mm(matrix_aj.t(), collection_qj.unfold(), matrix_omegas_);
+      comm_moment = utility::getTime();
+      parameters_.allreduce(matrix_omegas_, MPI_SUM);
+      comm_time += utility::getTime() - comm_moment;
+      la::mm(matrix_aj, matrix_omegas_, collection_qj.unfold());
+    }
+
+    this->toc(comm_time);
+  } else {
+    // ==================================================================================================================== //
+    // Random generating & projection (tile by tile)
 
-  this->toc(comm_time);
+    double gen_time = 0.0;
+    for ( index_t i = 0; i < num_sketch; i += num_sketch_tile ) {
+      const IdxRange range = {i, std::min(i+num_sketch_tile, num_sketch)};
+      auto collection_qjt = collection_qj(range);
+
+      // Random sample Omega using normal Gaussian distribution
+      const double gen_moment = utility::getTime();
+      random::gaussian(streams_, matrix_omegas_.vec());
+      gen_time += utility::getTime() - gen_moment;
+
+      // Qt := A * Omega
+      la::mm(matrix_aj, matrix_omegas_(""_, {0_i, range.len() * dim_sketch}), collection_qjt.unfold());
+    }
+
+    // Records the random generating and the projection as two parts
+    moments_.emplace_back(moments_.front() + gen_time);
+    comm_times_.emplace_back(0.0);
+    this->toc(comm_time);
+  }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -140,6 +210,14 @@ index_t MCNLA_ALIAS::exponent() const noexcept {
   return exponent_;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of tiles of the random sketches.
+///
+template <typename _Val>
+index_t MCNLA_ALIAS::numTile() const noexcept {
+  return num_tile_;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief  Sets the random seed.
 ///
@@ -167,6 +245,22 @@ MCNLA_ALIAS& MCNLA_ALIAS::setExponent(
   return *this;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the number of tiles of the random sketches.
+///
+/// @note  The random sketches depend on the number of tiles.
+///
+template <typename _Val>
+MCNLA_ALIAS& MCNLA_ALIAS::setNumTile(
+    const index_t num_tile
+) noexcept {
+  mcnla_assert_gt(num_tile, 0);
+  num_tile_ = num_tile;
+  initialized_ = false;
+  computed_ = false;
+  return *this;
+}
+
 }  // namespace isvd
 
 }  // namespace mcnla
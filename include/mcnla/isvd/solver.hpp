@@ -0,0 +1,18 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/isvd/solver.hpp
+/// @brief   The iSVD solver header.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_ISVD_SOLVER_HPP_
+#define MCNLA_ISVD_SOLVER_HPP_
+
+#include <mcnla/isvd/solver/stage_traits.hpp>
+#include <mcnla/isvd/solver/solver.hpp>
+#include <mcnla/isvd/solver/stage_interface.hpp>
+#include <mcnla/isvd/solver/solver_interface.hpp>
+#include <mcnla/isvd/solver/solver_registry.hpp>
+#include <mcnla/isvd/solver/batch_solver.hpp>
+
+#endif  // MCNLA_ISVD_SOLVER_HPP_
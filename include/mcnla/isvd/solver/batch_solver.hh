@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/isvd/solver/batch_solver.hh
+/// @brief   The definition of batched iSVD solver.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_ISVD_SOLVER_BATCH_SOLVER_HH_
+#define MCNLA_ISVD_SOLVER_BATCH_SOLVER_HH_
+
+#include <mcnla/isvd/def.hpp>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include <mcnla/core/matrix/collection.hpp>
+#include <mcnla/isvd/core/parameters.hpp>
+#include <mcnla/isvd/solver/stage_traits.hpp>
+#include <mcnla/isvd/solver/solver.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The iSVD namespace.
+//
+namespace isvd {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  isvd_solver_module
+/// The batched iSVD solver.
+///
+/// Computes the iSVD of many independent matrices of the same size. Each matrix is decomposed on a single MPI node by the
+/// non-distributed stages, and the batch is distributed instead: the matrices are split into contiguous batches across the
+/// MPI nodes (see #batchRange), and the matrices of each batch are scheduled dynamically across the OpenMP threads, so that
+/// an idle thread takes the next matrix. Each thread owns a @ref Solver "solver" as its workspace.
+///
+/// The parameters describe each matrix; the number of random sketches is the number for each matrix. The MPI communicator
+/// of the parameters is only used to distribute the batch, and the stages run on `MPI_COMM_SELF` without calling MPI.
+///
+/// The random seed of the i-th matrix is the seed of the batch plus i, so that the results do not depend on the numbers
+/// of MPI nodes and threads.
+///
+/// @tparam  _Sketcher        The sketcher type.
+/// @tparam  _Orthogonalizer  The orthogonalizer type.
+/// @tparam  _Integrator      The integrator type.
+/// @tparam  _Former          The former type (should compute the right singular vectors).
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+class BatchSolver {
+
+  static_assert(std::is_same<typename StageTraits<_Sketcher>::MatrixDist, FullDistTag>::value &&
+                std::is_same<typename StageTraits<_Former>::MatrixDist, FullDistTag>::value,
+                "The sketcher and the former should use the whole input matrix!");
+
+ private:
+
+  using _Val = ValT<_Sketcher>;
+
+ public:
+
+  using ValType     = _Val;
+  using RealValType = RealValT<_Val>;
+  using SolverType  = Solver<_Sketcher, _Orthogonalizer, _Integrator, _Former>;
+
+ protected:
+
+  /// The parameters of the batch.
+  const Parameters<_Val> &parameters_;
+
+  /// The parameters of each matrix (on a single MPI node).
+  Parameters<_Val> matrix_parameters_;
+
+  /// The tag shows if the solver is initialized.
+  bool initialized_ = false;
+
+  /// The tag shows if the solver is computed.
+  bool computed_ = false;
+
+  /// The number of matrices of all MPI nodes.
+  index_t nmat_total_ = 0;
+
+  /// The random seed of the batch.
+  index_t seed_ = 0;
+
+  /// The solvers (one per OpenMP thread).
+  std::vector<std::unique_ptr<SolverType>> solvers_;
+
+  /// The singular values (the i-th column is of the i-th matrix).
+  DenseMatrixColMajor<RealValType> matrix_s_;
+
+  /// The left singular vectors.
+  DenseMatrixCollectionColBlockColMajor<_Val> collection_u_;
+
+  /// The right singular vectors.
+  DenseMatrixCollectionColBlockColMajor<_Val> collection_v_;
+
+  /// The number of iterations of the integrator of each matrix.
+  std::vector<index_t> iterations_;
+
+  /// The computing time.
+  double time_ = 0.0;
+
+ public:
+
+  // Constructor
+  inline BatchSolver( const Parameters<_Val> &parameters, const index_t nmat_total, const index_t seed = rand() ) noexcept;
+  inline BatchSolver( const BatchSolver &other ) noexcept = delete;
+
+  // Operators
+  inline BatchSolver& operator=( const BatchSolver &other ) noexcept = delete;
+
+  // Initializes
+  inline void initialize() noexcept;
+
+  // Operators
+  template <class _Collection>
+  inline void operator()( const _Collection &collection_a ) noexcept;
+
+  // Gets data
+  inline bool isInitialized() const noexcept;
+  inline bool isComputed() const noexcept;
+  inline index_t nmatTotal() const noexcept;
+  inline index_t nmat() const noexcept;
+  inline IdxRange batchRange() const noexcept;
+  inline index_t numThread() const noexcept;
+  inline index_t seed() const noexcept;
+  inline std::size_t memoryRequirement() const noexcept;
+
+  // Sets parameters of stages
+  inline BatchSolver& setSeed( const index_t seed ) noexcept;
+  inline BatchSolver& setMaxIteration( const index_t max_iteration ) noexcept;
+  inline BatchSolver& setTolerance( const RealValType tolerance ) noexcept;
+
+  // Gets solvers
+  inline       SolverType& solver( const index_t idx ) noexcept;
+  inline const SolverType& solver( const index_t idx ) const noexcept;
+
+  // Gets results
+  inline const DenseMatrixColMajor<RealValType>& matrixS() const noexcept;
+  inline const DenseMatrixCollectionColBlockColMajor<_Val>& collectionU() const noexcept;
+  inline const DenseMatrixCollectionColBlockColMajor<_Val>& collectionV() const noexcept;
+  inline const std::vector<index_t>& iterations() const noexcept;
+
+  // Gets compute time
+  inline double time() const noexcept;
+
+};
+
+}  // namespace isvd
+
+}  // namespace mcnla
+
+#endif  // MCNLA_ISVD_SOLVER_BATCH_SOLVER_HH_
@@ -0,0 +1,335 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/isvd/solver/batch_solver.hpp
+/// @brief   The batched iSVD solver.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_ISVD_SOLVER_BATCH_SOLVER_HPP_
+#define MCNLA_ISVD_SOLVER_BATCH_SOLVER_HPP_
+
+#include <mcnla/isvd/solver/batch_solver.hh>
+#include <mcnla/core/la.hpp>
+#include <mcnla/core/utility/time.hpp>
+#include <mcnla/isvd/solver/solver_interface.hpp>
+
+#ifdef _OPENMP
+  #include <omp.h>
+#endif  // _OPENMP
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+  #define MCNLA_ALIAS BatchSolver<_Sketcher, _Orthogonalizer, _Integrator, _Former>
+#else  // DOXYGEN_SHOULD_SKIP_THIS
+  #define MCNLA_ALIAS BatchSolver
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The iSVD namespace.
+//
+namespace isvd {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Construct with given parameters.
+///
+/// @param  parameters  The parameters (of each matrix).
+/// @param  nmat_total  The number of matrices of all MPI nodes.
+/// @param  seed        The random seed of the batch.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+MCNLA_ALIAS::BatchSolver(
+    const Parameters<_Val> &parameters,
+    const index_t nmat_total,
+    const index_t seed
+) noexcept
+  : parameters_(parameters),
+    matrix_parameters_(0, MPI_COMM_SELF),
+    nmat_total_(nmat_total),
+    seed_(seed) {
+  mcnla_assert_ge(nmat_total, 0);
+#ifdef _OPENMP
+  const index_t num_thread = omp_get_max_threads();
+#else  // _OPENMP
+  const index_t num_thread = 1;
+#endif  // _OPENMP
+  for ( index_t i = 0; i < num_thread; ++i ) {
+    solvers_.emplace_back(new SolverType(matrix_parameters_));
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Initializes.
+///
+/// Copies the parameters to a single MPI node, initializes the solvers of all the threads, and allocates the results of
+/// this MPI node. If the memory limit of the parameters is set, it is shared by the solvers.
+///
+/// @attention  The parameters of the stages should be set before initializing.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+void MCNLA_ALIAS::initialize() noexcept {
+  mcnla_assert_true(parameters_.isSynchronized());
+
+  const auto nrow = parameters_.nrow();
+  const auto ncol = parameters_.ncol();
+  const auto rank = parameters_.rank();
+
+  matrix_parameters_.setSize(nrow, ncol).setRank(rank).setOverRank(parameters_.overRank())
+                    .setNumSketch(parameters_.numSketch()).setMemoryLimit(parameters_.memoryLimit() / numThread());
+  matrix_parameters_.sync();
+
+  for ( auto &solver : solvers_ ) {
+    solver->initialize();
+  }
+
+  matrix_s_.reconstruct(rank, nmat());
+  collection_u_.reconstruct(nrow, rank, nmat());
+  collection_v_.reconstruct(ncol, rank, nmat());
+  iterations_.assign(nmat(), 0);
+
+  initialized_ = true;
+  computed_ = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Runs the solver.
+///
+/// @param  collection_a  The matrices A of this MPI node (the matrices in #batchRange).
+///
+/// @note  The matrices are scheduled dynamically on #numThread threads, and the BLAS routines are called by each thread
+///        independently.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former> template <class _Collection>
+void MCNLA_ALIAS::operator()(
+    const _Collection &collection_a
+) noexcept {
+  mcnla_assert_true(isInitialized());
+  mcnla_assert_eq(collection_a.nmat(), nmat());
+
+  const auto offset = batchRange().begin;
+  const auto nmat   = this->nmat();
+
+  time_ = utility::getTime();
+
+  // Uses one thread per solver, since the number of threads may be changed after constructing
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic, 1) num_threads(numThread())
+#endif  // _OPENMP
+  for ( index_t i = 0; i < nmat; ++i ) {
+#ifdef _OPENMP
+    auto &solver = *solvers_[omp_get_thread_num()];
+#else  // _OPENMP
+    auto &solver = *solvers_[0];
+#endif  // _OPENMP
+    detail::setStageSeed(solver.sketcher(), seed_ + offset + i, 0);
+    solver(collection_a(i));
+
+    la::copy(solver.former().vectorS(), matrix_s_(""_, i));
+    la::copy(solver.former().matrixU(), collection_u_(i));
+    la::copy(solver.former().matrixV(), collection_v_(i));
+    iterations_[i] = detail::getStageIteration(solver.integrator(), 0);
+  }
+
+  time_ = utility::getTime() - time_;
+  computed_ = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Check if the solver is initialized.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+bool MCNLA_ALIAS::isInitialized() const noexcept {
+  return initialized_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Check if the solver is computed.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+bool MCNLA_ALIAS::isComputed() const noexcept {
+  return computed_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of matrices of all MPI nodes.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+index_t MCNLA_ALIAS::nmatTotal() const noexcept {
+  return nmat_total_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of matrices of this MPI node.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+index_t MCNLA_ALIAS::nmat() const noexcept {
+  return batchRange().len();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the range of the matrices of this MPI node.
+///
+/// The matrices are split into contiguous batches, and the sizes of the batches differ by at most one.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+IdxRange MCNLA_ALIAS::batchRange() const noexcept {
+  const auto mpi_size = parameters_.mpi_size;
+  const auto mpi_rank = parameters_.mpi_rank;
+  return {nmat_total_ * mpi_rank / mpi_size, nmat_total_ * (mpi_rank+1) / mpi_size};
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of threads (i.e., the number of solvers).
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+index_t MCNLA_ALIAS::numThread() const noexcept {
+  return solvers_.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the random seed of the batch.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+index_t MCNLA_ALIAS::seed() const noexcept {
+  return seed_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of bytes allocated by #initialize in this MPI node.
+///
+/// This is the sum of the memory requirements of the solvers and the results.
+///
+/// @note  The input matrices and the internal workspaces of the LAPACK drivers are not counted.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+std::size_t MCNLA_ALIAS::memoryRequirement() const noexcept {
+  mcnla_assert_true(matrix_parameters_.isSynchronized());
+
+  const std::size_t nrow = parameters_.nrow();
+  const std::size_t ncol = parameters_.ncol();
+  const std::size_t rank = parameters_.rank();
+  const std::size_t nmat = this->nmat();
+
+  std::size_t bytes = sizeof(RealValType) * rank * nmat + sizeof(_Val) * (nrow + ncol) * rank * nmat;
+  for ( const auto &solver : solvers_ ) {
+    bytes += solver->memoryRequirement();
+  }
+  return bytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the random seed of the batch.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+MCNLA_ALIAS& MCNLA_ALIAS::setSeed(
+    const index_t seed
+) noexcept {
+  seed_ = seed;
+  computed_ = false;
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the maximum number of iterations of the integrators (does nothing if the integrator does not iterate).
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+MCNLA_ALIAS& MCNLA_ALIAS::setMaxIteration(
+    const index_t max_iteration
+) noexcept {
+  for ( auto &solver : solvers_ ) {
+    detail::setStageMaxIteration(solver->integrator(), max_iteration, 0);
+  }
+  computed_ = false;
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the tolerance of convergence condition of the integrators (does nothing if the integrator does not iterate).
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+MCNLA_ALIAS& MCNLA_ALIAS::setTolerance(
+    const RealValType tolerance
+) noexcept {
+  for ( auto &solver : solvers_ ) {
+    detail::setStageTolerance(solver->integrator(), tolerance, 0);
+  }
+  computed_ = false;
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the solver of the @a idx-th thread.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+typename MCNLA_ALIAS::SolverType& MCNLA_ALIAS::solver(
+    const index_t idx
+) noexcept {
+  mcnla_assert_gelt(idx, 0, numThread());
+  return *solvers_[idx];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  solver
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+const typename MCNLA_ALIAS::SolverType& MCNLA_ALIAS::solver(
+    const index_t idx
+) const noexcept {
+  mcnla_assert_gelt(idx, 0, numThread());
+  return *solvers_[idx];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the singular values (the i-th column is of the i-th matrix of this MPI node).
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+const DenseMatrixColMajor<typename MCNLA_ALIAS::RealValType>& MCNLA_ALIAS::matrixS() const noexcept {
+  mcnla_assert_true(isComputed());
+  return matrix_s_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the left singular vectors (the i-th matrix is of the i-th matrix of this MPI node).
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+const DenseMatrixCollectionColBlockColMajor<typename MCNLA_ALIAS::ValType>& MCNLA_ALIAS::collectionU() const noexcept {
+  mcnla_assert_true(isComputed());
+  return collection_u_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the right singular vectors (the i-th matrix is of the i-th matrix of this MPI node).
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+const DenseMatrixCollectionColBlockColMajor<typename MCNLA_ALIAS::ValType>& MCNLA_ALIAS::collectionV() const noexcept {
+  mcnla_assert_true(isComputed());
+  return collection_v_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the numbers of iterations of the integrator (zero if the integrator does not iterate).
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+const std::vector<index_t>& MCNLA_ALIAS::iterations() const noexcept {
+  mcnla_assert_true(isComputed());
+  return iterations_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the wall time of computing the batch of this MPI node.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+double MCNLA_ALIAS::time() const noexcept {
+  return time_;
+}
+
+}  // namespace isvd
+
+}  // namespace mcnla
+
+#undef MCNLA_ALIAS
+
+#endif  // MCNLA_ISVD_SOLVER_BATCH_SOLVER_HPP_
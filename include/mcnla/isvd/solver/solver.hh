@@ -0,0 +1,247 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/isvd/solver/solver.hh
+/// @brief   The definition of iSVD solver.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_ISVD_SOLVER_SOLVER_HH_
+#define MCNLA_ISVD_SOLVER_SOLVER_HH_
+
+#include <mcnla/isvd/def.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <mcnla/isvd/core/parameters.hpp>
+#include <mcnla/isvd/converter.hpp>
+#include <mcnla/isvd/solver/stage_traits.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The iSVD namespace.
+//
+namespace isvd {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace.
+//
+namespace detail {
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+// Selects the converter of matrix collections
+template <class _From, class _To, typename _Val> struct CollectionConverterSelector;
+
+template <class _Dist, typename _Val>
+struct CollectionConverterSelector<_Dist, _Dist, _Val> { using Type = DummyConverter<_Val>; };
+
+template <typename _Val>
+struct CollectionConverterSelector<FullDistTag, RowBlockDistTag, _Val> {
+  using Type = CollectionToRowBlockConverter<_Val>;
+};
+
+template <typename _Val>
+struct CollectionConverterSelector<RowBlockDistTag, FullDistTag, _Val> {
+  using Type = CollectionFromRowBlockConverter<_Val>;
+};
+
+template <typename _Val>
+struct CollectionConverterSelector<PartialSumDistTag, RowBlockDistTag, _Val> {
+  using Type = CollectionFromPartialSumToRowBlockConverter<_Val>;
+};
+
+// Selects the converter of matrices
+template <class _From, class _To, typename _Val> struct MatrixConverterSelector;
+
+template <class _Dist, typename _Val>
+struct MatrixConverterSelector<_Dist, _Dist, _Val> { using Type = DummyConverter<_Val>; };
+
+template <typename _Val>
+struct MatrixConverterSelector<FullDistTag, RowBlockDistTag, _Val> {
+  using Type = MatrixToRowBlockConverter<_Val>;
+};
+
+template <typename _Val>
+struct MatrixConverterSelector<RowBlockDistTag, FullDistTag, _Val> {
+  using Type = MatrixFromRowBlockToAllConverter<_Val>;
+};
+
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  isvd_solver_module
+/// The iSVD solver.
+///
+/// Chains a sketcher, an orthogonalizer, an integrator and a former. The converters between the stages are selected from
+/// the data distributions of the stages (see @ref StageTraits), and the intermediate data are planned into two workspaces,
+/// so that the data with non-overlapping lifetimes share memory.
+///
+/// The memory requirement of the solver is known before initializing (see #memoryRequirement). If the memory limit of the
+/// parameters is set, the stages are tiled to fit it while initializing; if they cannot, the solver warns and exceeds the limit
+/// (see #fitsMemoryLimit).
+///
+/// Initializing plans the solver: all the workspaces are allocated once, and running the solver on matrices of the same
+/// size does not allocate any array (see #allocations).
+///
+/// @tparam  _Sketcher        The sketcher type.
+/// @tparam  _Orthogonalizer  The orthogonalizer type.
+/// @tparam  _Integrator      The integrator type.
+/// @tparam  _Former          The former type.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+class Solver {
+
+  static_assert(std::is_same<typename StageTraits<_Sketcher>::MatrixDist,
+                             typename StageTraits<_Former>::MatrixDist>::value,
+                "The sketcher and the former should use the same distribution of the input matrix!");
+
+ private:
+
+  using _Val = ValT<_Sketcher>;
+
+  using SketcherDist       = typename StageTraits<_Sketcher>::OutputDist;
+  using OrthogonalizerDist = typename StageTraits<_Orthogonalizer>::InputDist;
+  using IntegratorDist     = typename StageTraits<_Integrator>::InputDist;
+  using IntegratorOutDist  = typename StageTraits<_Integrator>::OutputDist;
+  using FormerDist         = typename StageTraits<_Former>::InputDist;
+
+ public:
+
+  using ValType              = _Val;
+  using SketcherType         = _Sketcher;
+  using OrthogonalizerType   = _Orthogonalizer;
+  using IntegratorType       = _Integrator;
+  using FormerType           = _Former;
+  using SoConverterType      = typename detail::CollectionConverterSelector<SketcherDist, OrthogonalizerDist, _Val>::Type;
+  using OiConverterType      = typename detail::CollectionConverterSelector<OrthogonalizerDist, IntegratorDist, _Val>::Type;
+  using IfConverterType      = typename detail::MatrixConverterSelector<IntegratorOutDist, FormerDist, _Val>::Type;
+
+ protected:
+
+  /// The parameters
+  const Parameters<_Val> &parameters_;
+
+  /// The tag shows if the solver is initialized.
+  bool initialized_ = false;
+
+  /// The tag shows if the solver is computed.
+  bool computed_ = false;
+
+  /// The sketcher.
+  _Sketcher sketcher_;
+
+  /// The orthogonalizer.
+  _Orthogonalizer orthogonalizer_;
+
+  /// The integrator.
+  _Integrator integrator_;
+
+  /// The former.
+  _Former former_;
+
+  /// The converter between the sketcher and the orthogonalizer.
+  SoConverterType so_converter_;
+
+  /// The converter between the orthogonalizer and the integrator.
+  OiConverterType oi_converter_;
+
+  /// The converter between the integrator and the former.
+  IfConverterType if_converter_;
+
+  /// The workspaces.
+  Array<_Val> workspaces_[2];
+
+  /// The matrix collection Q (output of the sketcher).
+  DenseMatrixCollectionColBlockRowMajor<_Val> collection_qs_;
+
+  /// The matrix collection Q (input of the orthogonalizer).
+  DenseMatrixCollectionColBlockRowMajor<_Val> collection_qo_;
+
+  /// The matrix collection Q (input of the integrator).
+  DenseMatrixCollectionColBlockRowMajor<_Val> collection_qi_;
+
+  /// The matrix Qbar (output of the integrator).
+  DenseMatrixRowMajor<_Val> matrix_qi_;
+
+  /// The matrix Qbar (input of the former).
+  DenseMatrixRowMajor<_Val> matrix_qf_;
+
+ public:
+
+  // Constructor
+  inline Solver( const Parameters<_Val> &parameters ) noexcept;
+
+  // Initializes
+  inline void initialize() noexcept;
+
+  // Operators
+  template <class _Matrix>
+  inline void operator()( const _Matrix &matrix_a ) noexcept;
+
+  // Gets data
+  inline bool isInitialized() const noexcept;
+  inline bool isComputed() const noexcept;
+  inline index_t workspaceSize() const noexcept;
+  inline std::size_t memoryRequirement() const noexcept;
+  inline bool fitsMemoryLimit() const noexcept;
+  inline std::int64_t allocations() const noexcept;
+
+  // Gets stages
+  inline       _Sketcher& sketcher() noexcept;
+  inline const _Sketcher& sketcher() const noexcept;
+  inline       _Orthogonalizer& orthogonalizer() noexcept;
+  inline const _Orthogonalizer& orthogonalizer() const noexcept;
+  inline       _Integrator& integrator() noexcept;
+  inline const _Integrator& integrator() const noexcept;
+  inline       _Former& former() noexcept;
+  inline const _Former& former() const noexcept;
+  inline const SoConverterType& soConverter() const noexcept;
+  inline const OiConverterType& oiConverter() const noexcept;
+  inline const IfConverterType& ifConverter() const noexcept;
+
+  // Gets compute time
+  inline double time() const noexcept;
+
+ protected:
+
+  // Plans workspaces
+  inline void plan() noexcept;
+  inline std::array<index_t, 5> planIndices() const noexcept;
+  inline std::array<index_t, 2> planSizes() const noexcept;
+
+  // Fits memory
+  template <class _Stage>
+  inline void fitMemory( _Stage &stage, const std::size_t limit ) noexcept;
+
+  // Gets sizes
+  inline std::tuple<index_t, index_t, index_t> collectionSizes( const FullDistTag ) const noexcept;
+  inline std::tuple<index_t, index_t, index_t> collectionSizes( const RowBlockDistTag ) const noexcept;
+  inline std::tuple<index_t, index_t, index_t> collectionSizes( const PartialSumDistTag ) const noexcept;
+  inline std::tuple<index_t, index_t> matrixSizes( const FullDistTag ) const noexcept;
+  inline std::tuple<index_t, index_t> matrixSizes( const RowBlockDistTag ) const noexcept;
+  template <class _Dist>
+  inline index_t collectionNelem() const noexcept;
+  template <class _Dist>
+  inline index_t matrixNelem() const noexcept;
+
+  // Creates data
+  template <class _Dist>
+  inline DenseMatrixCollectionColBlockRowMajor<_Val> createCollection( const Array<_Val> &workspace ) const noexcept;
+  template <class _Dist>
+  inline DenseMatrixRowMajor<_Val> createMatrix( const Array<_Val> &workspace ) const noexcept;
+
+};
+
+}  // namespace isvd
+
+}  // namespace mcnla
+
+#endif  // MCNLA_ISVD_SOLVER_SOLVER_HH_
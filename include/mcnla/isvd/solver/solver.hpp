@@ -0,0 +1,441 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/isvd/solver/solver.hpp
+/// @brief   The iSVD solver.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_ISVD_SOLVER_SOLVER_HPP_
+#define MCNLA_ISVD_SOLVER_SOLVER_HPP_
+
+#include <mcnla/isvd/solver/solver.hh>
+#include <algorithm>
+#include <iostream>
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+  #define MCNLA_ALIAS Solver<_Sketcher, _Orthogonalizer, _Integrator, _Former>
+#else  // DOXYGEN_SHOULD_SKIP_THIS
+  #define MCNLA_ALIAS Solver
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The iSVD namespace.
+//
+namespace isvd {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Construct with given parameters.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+MCNLA_ALIAS::Solver(
+    const Parameters<_Val> &parameters
+) noexcept
+  : parameters_(parameters),
+    sketcher_(parameters),
+    orthogonalizer_(parameters),
+    integrator_(parameters),
+    former_(parameters),
+    so_converter_(parameters),
+    oi_converter_(parameters),
+    if_converter_(parameters) {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Initializes.
+///
+/// Initializes all the stages and converters, and plans the workspaces. If the memory limit of the parameters is set, the
+/// stages are fitted to it first (see @ref StageWrapper::fitMemory "fitMemory"), and a warning is printed on the root rank
+/// if they cannot fit (see #fitsMemoryLimit).
+///
+/// @attention  The parameters of the stages should be set before initializing.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+void MCNLA_ALIAS::initialize() noexcept {
+  mcnla_assert_true(parameters_.isSynchronized());
+
+  const auto memory_limit = parameters_.memoryLimit();
+  if ( memory_limit > 0 ) {
+    fitMemory(sketcher_, memory_limit);
+    fitMemory(orthogonalizer_, memory_limit);
+    fitMemory(integrator_, memory_limit);
+    fitMemory(former_, memory_limit);
+    if ( !fitsMemoryLimit() && parameters_.mpi_rank == parameters_.mpi_root ) {
+      std::cerr << "Warning: the iSVD solver requires " << memoryRequirement() << " bytes, "
+                << "which exceeds the memory limit of " << memory_limit << " bytes." << std::endl;
+    }
+  }
+
+  sketcher_.initialize();
+  orthogonalizer_.initialize();
+  integrator_.initialize();
+  former_.initialize();
+  so_converter_.initialize();
+  oi_converter_.initialize();
+  if_converter_.initialize();
+  plan();
+  initialized_ = true;
+  computed_ = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Runs the solver.
+///
+/// @param  matrix_a  The matrix A (in the distribution of the sketcher and the former).
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former> template <class _Matrix>
+void MCNLA_ALIAS::operator()(
+    const _Matrix &matrix_a
+) noexcept {
+  mcnla_assert_true(parameters_.isSynchronized());
+  mcnla_assert_true(isInitialized());
+  sketcher_(matrix_a, collection_qs_);
+  so_converter_(collection_qs_, collection_qo_);
+  orthogonalizer_(collection_qo_);
+  oi_converter_(collection_qo_, collection_qi_);
+  integrator_(collection_qi_, matrix_qi_);
+  if_converter_(matrix_qi_, matrix_qf_);
+  former_(matrix_a, matrix_qf_);
+  computed_ = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Check if the solver is initialized.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+bool MCNLA_ALIAS::isInitialized() const noexcept {
+  return initialized_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Check if the solver is computed.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+bool MCNLA_ALIAS::isComputed() const noexcept {
+  return computed_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of values in the workspaces.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+index_t MCNLA_ALIAS::workspaceSize() const noexcept {
+  mcnla_assert_true(isInitialized());
+  return workspaces_[0].size() + workspaces_[1].size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of bytes allocated by #initialize in this MPI node.
+///
+/// This is the sum of the memory requirements of the stages and the planned workspaces, that is, the peak memory of the
+/// solver. It is available before initializing.
+///
+/// @note  The input matrix and the internal workspaces of the LAPACK drivers are not counted.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+std::size_t MCNLA_ALIAS::memoryRequirement() const noexcept {
+  mcnla_assert_true(parameters_.isSynchronized());
+  const auto sizes = planSizes();
+  return sketcher_.memoryRequirement() + orthogonalizer_.memoryRequirement()
+       + integrator_.memoryRequirement() + former_.memoryRequirement()
+       + so_converter_.memoryRequirement() + oi_converter_.memoryRequirement() + if_converter_.memoryRequirement()
+       + sizeof(_Val) * (sizes[0] + sizes[1]);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Check if the memory requirement fits the memory limit of the parameters (always true if the limit is not set).
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+bool MCNLA_ALIAS::fitsMemoryLimit() const noexcept {
+  const auto memory_limit = parameters_.memoryLimit();
+  return memory_limit == 0 || memoryRequirement() <= memory_limit;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of heap allocations of arrays of the last run (including the converters).
+///
+/// @see  StageWrapper::allocations
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+std::int64_t MCNLA_ALIAS::allocations() const noexcept {
+  return sketcher_.allocations() + orthogonalizer_.allocations() + integrator_.allocations() + former_.allocations()
+       + so_converter_.allocations() + oi_converter_.allocations() + if_converter_.allocations();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the sketcher.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+_Sketcher& MCNLA_ALIAS::sketcher() noexcept {
+  return sketcher_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  sketcher
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+const _Sketcher& MCNLA_ALIAS::sketcher() const noexcept {
+  return sketcher_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the orthogonalizer.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+_Orthogonalizer& MCNLA_ALIAS::orthogonalizer() noexcept {
+  return orthogonalizer_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  orthogonalizer
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+const _Orthogonalizer& MCNLA_ALIAS::orthogonalizer() const noexcept {
+  return orthogonalizer_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the integrator.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+_Integrator& MCNLA_ALIAS::integrator() noexcept {
+  return integrator_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  integrator
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+const _Integrator& MCNLA_ALIAS::integrator() const noexcept {
+  return integrator_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the former.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+_Former& MCNLA_ALIAS::former() noexcept {
+  return former_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  former
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+const _Former& MCNLA_ALIAS::former() const noexcept {
+  return former_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the converter between the sketcher and the orthogonalizer.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+const typename MCNLA_ALIAS::SoConverterType& MCNLA_ALIAS::soConverter() const noexcept {
+  return so_converter_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the converter between the orthogonalizer and the integrator.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+const typename MCNLA_ALIAS::OiConverterType& MCNLA_ALIAS::oiConverter() const noexcept {
+  return oi_converter_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the converter between the integrator and the former.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+const typename MCNLA_ALIAS::IfConverterType& MCNLA_ALIAS::ifConverter() const noexcept {
+  return if_converter_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the total computing time (including the converters).
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+double MCNLA_ALIAS::time() const noexcept {
+  return sketcher_.time() + orthogonalizer_.time() + integrator_.time() + former_.time()
+       + so_converter_.time() + oi_converter_.time() + if_converter_.time();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Plans the workspaces.
+///
+/// The intermediate data are placed into two workspaces. The output of a converter is placed into the workspace not used by
+/// its input, and the output of the integrator is placed into the workspace not used by its input; therefore the data
+/// placed in the same workspace never live at the same time. If a conversion is not needed (the distributions are the same,
+/// or there is only one MPI node), the output shares the storage of the input.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+void MCNLA_ALIAS::plan() noexcept {
+
+  const auto idx   = planIndices();
+  const auto sizes = planSizes();
+
+  const auto idx_qs = idx[0];
+  const auto idx_qo = idx[1];
+  const auto idx_qi = idx[2];
+  const auto idx_mi = idx[3];
+  const auto idx_mf = idx[4];
+
+  // Allocates workspaces
+  for ( index_t i = 0; i < 2; ++i ) {
+    if ( workspaces_[i].size() < sizes[i] ) {
+      workspaces_[i] = Array<_Val>(sizes[i]);
+    }
+  }
+
+  // Creates data
+  collection_qs_ = createCollection<SketcherDist>(workspaces_[idx_qs]);
+  collection_qo_ = (idx_qo != idx_qs) ? createCollection<OrthogonalizerDist>(workspaces_[idx_qo]) : collection_qs_;
+  collection_qi_ = (idx_qi != idx_qo) ? createCollection<IntegratorDist>(workspaces_[idx_qi]) : collection_qo_;
+  matrix_qi_     = createMatrix<IntegratorOutDist>(workspaces_[idx_mi]);
+  matrix_qf_     = (idx_mf != idx_mi) ? createMatrix<FormerDist>(workspaces_[idx_mf]) : matrix_qi_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the workspace indices of Q (output of the sketcher, input of the orthogonalizer, input of the integrator)
+///         and Qbar (output of the integrator, input of the former).
+///
+/// @see  plan
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+std::array<index_t, 5> MCNLA_ALIAS::planIndices() const noexcept {
+
+  const auto mpi_size = parameters_.mpi_size;
+
+  const bool so_copy = !std::is_same<SketcherDist, OrthogonalizerDist>::value && mpi_size > 1;
+  const bool oi_copy = !std::is_same<OrthogonalizerDist, IntegratorDist>::value && mpi_size > 1;
+  const bool if_copy = !std::is_same<IntegratorOutDist, FormerDist>::value && mpi_size > 1;
+
+  const index_t idx_qs = 0;
+  const index_t idx_qo = so_copy ? 1 - idx_qs : idx_qs;
+  const index_t idx_qi = oi_copy ? 1 - idx_qo : idx_qo;
+  const index_t idx_mi = 1 - idx_qi;
+  const index_t idx_mf = if_copy ? 1 - idx_mi : idx_mi;
+
+  return {{idx_qs, idx_qo, idx_qi, idx_mi, idx_mf}};
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of values of the workspaces.
+///
+/// @see  plan
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+std::array<index_t, 2> MCNLA_ALIAS::planSizes() const noexcept {
+
+  const auto idx = planIndices();
+
+  std::array<index_t, 2> sizes = {{0, 0}};
+  sizes[idx[0]] = std::max(sizes[idx[0]], collectionNelem<SketcherDist>());
+  sizes[idx[1]] = std::max(sizes[idx[1]], collectionNelem<OrthogonalizerDist>());
+  sizes[idx[2]] = std::max(sizes[idx[2]], collectionNelem<IntegratorDist>());
+  sizes[idx[3]] = std::max(sizes[idx[3]], matrixNelem<IntegratorOutDist>());
+  sizes[idx[4]] = std::max(sizes[idx[4]], matrixNelem<FormerDist>());
+  return sizes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Fits a stage into the memory left by the other parts of the solver.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former> template <class _Stage>
+void MCNLA_ALIAS::fitMemory(
+          _Stage &stage,
+    const std::size_t limit
+) noexcept {
+  const auto others = memoryRequirement() - stage.memoryRequirement();
+  stage.fitMemory(limit > others ? limit - others : 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the sizes (the number of allocated rows, the number of rows, and the number of matrices) of the collection.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+std::tuple<index_t, index_t, index_t> MCNLA_ALIAS::collectionSizes( const FullDistTag ) const noexcept {
+  return std::make_tuple(parameters_.nrowTotal(), parameters_.nrow(), parameters_.numSketchEach());
+}
+
+/// @copydoc  collectionSizes
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+std::tuple<index_t, index_t, index_t> MCNLA_ALIAS::collectionSizes( const RowBlockDistTag ) const noexcept {
+  return std::make_tuple(parameters_.nrowEach(), parameters_.nrowRank(), parameters_.numSketch());
+}
+
+/// @copydoc  collectionSizes
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+std::tuple<index_t, index_t, index_t> MCNLA_ALIAS::collectionSizes( const PartialSumDistTag ) const noexcept {
+  return std::make_tuple(parameters_.nrowTotal(), parameters_.nrow(), parameters_.numSketch());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the sizes (the number of allocated rows and the number of rows) of the matrix.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+std::tuple<index_t, index_t> MCNLA_ALIAS::matrixSizes( const FullDistTag ) const noexcept {
+  return std::make_tuple(parameters_.nrowTotal(), parameters_.nrow());
+}
+
+/// @copydoc  matrixSizes
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+std::tuple<index_t, index_t> MCNLA_ALIAS::matrixSizes( const RowBlockDistTag ) const noexcept {
+  return std::make_tuple(parameters_.nrowEach(), parameters_.nrowRank());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of values of the collection.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former> template <class _Dist>
+index_t MCNLA_ALIAS::collectionNelem() const noexcept {
+  const auto sizes = collectionSizes(_Dist());
+  return std::get<0>(sizes) * parameters_.dimSketch() * std::get<2>(sizes);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of values of the matrix.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former> template <class _Dist>
+index_t MCNLA_ALIAS::matrixNelem() const noexcept {
+  const auto sizes = matrixSizes(_Dist());
+  return std::get<0>(sizes) * parameters_.dimSketch();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Creates a collection in the workspace.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former> template <class _Dist>
+DenseMatrixCollectionColBlockRowMajor<typename MCNLA_ALIAS::ValType> MCNLA_ALIAS::createCollection(
+    const Array<_Val> &workspace
+) const noexcept {
+  const auto sizes      = collectionSizes(_Dist());
+  const auto dim_sketch = parameters_.dimSketch();
+  const auto ncol       = dim_sketch * std::get<2>(sizes);
+  DenseMatrixRowMajor<_Val> data(std::get<0>(sizes), ncol, ncol, workspace);
+  DenseMatrixCollectionColBlockRowMajor<_Val> retval(dim_sketch, data);
+  return retval({0_i, std::get<1>(sizes)}, ""_, ""_);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Creates a matrix in the workspace.
+///
+template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former> template <class _Dist>
+DenseMatrixRowMajor<typename MCNLA_ALIAS::ValType> MCNLA_ALIAS::createMatrix(
+    const Array<_Val> &workspace
+) const noexcept {
+  const auto sizes      = matrixSizes(_Dist());
+  const auto dim_sketch = parameters_.dimSketch();
+  DenseMatrixRowMajor<_Val> retval(std::get<0>(sizes), dim_sketch, dim_sketch, workspace);
+  return retval({0_i, std::get<1>(sizes)}, ""_);
+}
+
+}  // namespace isvd
+
+}  // namespace mcnla
+
+#undef MCNLA_ALIAS
+
+#endif  // MCNLA_ISVD_SOLVER_SOLVER_HPP_
@@ -0,0 +1,237 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/isvd/solver/solver_interface.hh
+/// @brief   The definition of iSVD solver interface.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_ISVD_SOLVER_SOLVER_INTERFACE_HH_
+#define MCNLA_ISVD_SOLVER_SOLVER_INTERFACE_HH_
+
+#include <mcnla/isvd/def.hpp>
+#include <cstddef>
+#include <mcnla/isvd/core/parameters.hpp>
+#include <mcnla/isvd/solver/stage_traits.hpp>
+#include <mcnla/isvd/solver/stage_interface.hpp>
+#include <mcnla/isvd/solver/solver.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The iSVD namespace.
+//
+namespace isvd {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace.
+//
+namespace detail {
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+// The input and output types of the solvers
+template <class _Dist, typename _Val> struct SolverInterfaceTypes;
+
+template <typename _Val>
+struct SolverInterfaceTypes<RowBlockDistTag, _Val> {
+  using MatrixType  = DenseMatrixRowMajor<_Val>;
+  using MatrixUType = DenseMatrixRowMajor<_Val>;
+  using MatrixVType = DenseMatrixRowMajor<_Val>;
+};
+
+template <typename _Val>
+struct SolverInterfaceTypes<ColBlockDistTag, _Val> {
+  using MatrixType  = DenseMatrixColMajor<_Val>;
+  using MatrixUType = DenseMatrixColMajor<_Val>;
+  using MatrixVType = DenseMatrixRowMajor<_Val>;
+};
+
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  isvd_solver_module
+/// The iSVD solver interface.
+///
+/// The type-erased view of a @ref Solver "solver", so that the stages can be selected at runtime (see @ref SolverRegistry).
+/// All the solvers of the same interface take the same type of input matrix and give the same type of results:
+///
+/// - `RowBlockDistTag`: A, U and V are row-blocks (`DenseMatrixRowMajor`).
+/// - `ColBlockDistTag`: A is a column-block (`DenseMatrixColMajor`), U is the whole matrix (`DenseMatrixColMajor`) and V is
+///   a row-block (`DenseMatrixRowMajor`).
+///
+/// @tparam  _Dist  The distribution of the input matrix A (see @ref StageTraits).
+/// @tparam  _Val   The value type.
+///
+/// @see  SolverHolder
+///
+template <class _Dist, typename _Val>
+class SolverInterface {
+
+ public:
+
+  using ValType     = _Val;
+  using RealValType = RealValT<_Val>;
+  using MatrixType  = typename detail::SolverInterfaceTypes<_Dist, _Val>::MatrixType;
+  using MatrixUType = typename detail::SolverInterfaceTypes<_Dist, _Val>::MatrixUType;
+  using MatrixVType = typename detail::SolverInterfaceTypes<_Dist, _Val>::MatrixVType;
+
+ public:
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  /// @brief  The default destructor.
+  ///
+  virtual ~SolverInterface() noexcept = default;
+
+  // Initializes
+  virtual void initialize() noexcept = 0;
+
+  // Operators
+  virtual void operator()( const MatrixType &matrix_a ) noexcept = 0;
+
+  // Gets data
+  virtual bool isInitialized() const noexcept = 0;
+  virtual bool isComputed() const noexcept = 0;
+  virtual index_t workspaceSize() const noexcept = 0;
+  virtual std::size_t memoryRequirement() const noexcept = 0;
+  virtual index_t iteration() const noexcept = 0;
+
+  // Sets parameters of stages
+  virtual bool setSeed( const index_t seed ) noexcept = 0;
+  virtual bool setMaxIteration( const index_t max_iteration ) noexcept = 0;
+  virtual bool setTolerance( const RealValType tolerance ) noexcept = 0;
+
+  // Gets stages
+  virtual const StageInterface& sketcher() const noexcept = 0;
+  virtual const StageInterface& orthogonalizer() const noexcept = 0;
+  virtual const StageInterface& integrator() const noexcept = 0;
+  virtual const StageInterface& former() const noexcept = 0;
+  virtual const StageInterface& soConverter() const noexcept = 0;
+  virtual const StageInterface& oiConverter() const noexcept = 0;
+  virtual const StageInterface& ifConverter() const noexcept = 0;
+
+  // Gets results
+  virtual const DenseVector<RealValType>& vectorS() const noexcept = 0;
+  virtual const MatrixUType& matrixU() const noexcept = 0;
+  virtual const MatrixVType& matrixV() const noexcept = 0;
+
+  // Gets compute time
+  virtual double time() const noexcept = 0;
+
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  isvd_solver_module
+/// The iSVD solver holder.
+///
+/// Implements the @ref SolverInterface "solver interface" by owning a solver. Setting a parameter that the stage does not
+/// have does nothing and returns `false` (e.g. the tolerance of the reduction integrator).
+///
+/// @tparam  _Solver  The solver type.
+///
+template <class _Solver>
+class SolverHolder
+  : public SolverInterface<typename StageTraits<typename _Solver::FormerType>::MatrixDist, typename _Solver::ValType> {
+
+ private:
+
+  using BaseType = SolverInterface<typename StageTraits<typename _Solver::FormerType>::MatrixDist,
+                                   typename _Solver::ValType>;
+  using DistType = typename StageTraits<typename _Solver::FormerType>::MatrixDist;
+
+ public:
+
+  using ValType     = typename BaseType::ValType;
+  using RealValType = typename BaseType::RealValType;
+  using MatrixType  = typename BaseType::MatrixType;
+  using MatrixUType = typename BaseType::MatrixUType;
+  using MatrixVType = typename BaseType::MatrixVType;
+
+ protected:
+
+  /// The solver.
+  _Solver solver_;
+
+  /// The sketcher.
+  StageHolder<typename _Solver::SketcherType> sketcher_;
+
+  /// The orthogonalizer.
+  StageHolder<typename _Solver::OrthogonalizerType> orthogonalizer_;
+
+  /// The integrator.
+  StageHolder<typename _Solver::IntegratorType> integrator_;
+
+  /// The former.
+  StageHolder<typename _Solver::FormerType> former_;
+
+  /// The converter between the sketcher and the orthogonalizer.
+  StageHolder<typename _Solver::SoConverterType> so_converter_;
+
+  /// The converter between the orthogonalizer and the integrator.
+  StageHolder<typename _Solver::OiConverterType> oi_converter_;
+
+  /// The converter between the integrator and the former.
+  StageHolder<typename _Solver::IfConverterType> if_converter_;
+
+ public:
+
+  // Constructor
+  inline SolverHolder( const Parameters<ValType> &parameters ) noexcept;
+  inline SolverHolder( const SolverHolder &other ) noexcept = delete;
+
+  // Operators
+  inline SolverHolder& operator=( const SolverHolder &other ) noexcept = delete;
+
+  // Destructor
+  virtual ~SolverHolder() noexcept override = default;
+
+  // Gets solver
+  inline       _Solver& solver() noexcept;
+  inline const _Solver& solver() const noexcept;
+
+  // Initializes
+  virtual void initialize() noexcept override;
+
+  // Operators
+  virtual void operator()( const MatrixType &matrix_a ) noexcept override;
+
+  // Gets data
+  virtual bool isInitialized() const noexcept override;
+  virtual bool isComputed() const noexcept override;
+  virtual index_t workspaceSize() const noexcept override;
+  virtual std::size_t memoryRequirement() const noexcept override;
+  virtual index_t iteration() const noexcept override;
+
+  // Sets parameters of stages
+  virtual bool setSeed( const index_t seed ) noexcept override;
+  virtual bool setMaxIteration( const index_t max_iteration ) noexcept override;
+  virtual bool setTolerance( const RealValType tolerance ) noexcept override;
+
+  // Gets stages
+  virtual const StageInterface& sketcher() const noexcept override;
+  virtual const StageInterface& orthogonalizer() const noexcept override;
+  virtual const StageInterface& integrator() const noexcept override;
+  virtual const StageInterface& former() const noexcept override;
+  virtual const StageInterface& soConverter() const noexcept override;
+  virtual const StageInterface& oiConverter() const noexcept override;
+  virtual const StageInterface& ifConverter() const noexcept override;
+
+  // Gets results
+  virtual const DenseVector<RealValType>& vectorS() const noexcept override;
+  virtual const MatrixUType& matrixU() const noexcept override;
+  virtual const MatrixVType& matrixV() const noexcept override;
+
+  // Gets compute time
+  virtual double time() const noexcept override;
+
+};
+
+}  // namespace isvd
+
+}  // namespace mcnla
+
+#endif  // MCNLA_ISVD_SOLVER_SOLVER_INTERFACE_HH_
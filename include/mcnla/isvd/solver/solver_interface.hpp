@@ -0,0 +1,317 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/isvd/solver/solver_interface.hpp
+/// @brief   The iSVD solver interface.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_ISVD_SOLVER_SOLVER_INTERFACE_HPP_
+#define MCNLA_ISVD_SOLVER_SOLVER_INTERFACE_HPP_
+
+#include <mcnla/isvd/solver/solver_interface.hh>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The iSVD namespace.
+//
+namespace isvd {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace.
+//
+namespace detail {
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+// Sets the seed if the stage has it
+template <class _Stage>
+inline auto setStageSeed( _Stage &stage, const index_t seed, int ) noexcept -> decltype(stage.setSeed(seed), bool()) {
+  stage.setSeed(seed);
+  return true;
+}
+
+template <class _Stage>
+inline bool setStageSeed( _Stage&, const index_t, long ) noexcept {
+  return false;
+}
+
+// Sets the maximum iteration if the stage has it
+template <class _Stage>
+inline auto setStageMaxIteration( _Stage &stage, const index_t max_iteration, int ) noexcept
+    -> decltype(stage.setMaxIteration(max_iteration), bool()) {
+  stage.setMaxIteration(max_iteration);
+  return true;
+}
+
+template <class _Stage>
+inline bool setStageMaxIteration( _Stage&, const index_t, long ) noexcept {
+  return false;
+}
+
+// Sets the tolerance if the stage has it
+template <class _Stage, typename _Real>
+inline auto setStageTolerance( _Stage &stage, const _Real tolerance, int ) noexcept
+    -> decltype(stage.setTolerance(tolerance), bool()) {
+  stage.setTolerance(tolerance);
+  return true;
+}
+
+template <class _Stage, typename _Real>
+inline bool setStageTolerance( _Stage&, const _Real, long ) noexcept {
+  return false;
+}
+
+// Gets the number of iterations if the stage has it
+template <class _Stage>
+inline auto getStageIteration( const _Stage &stage, int ) noexcept -> decltype(index_t(stage.iteration())) {
+  return stage.iteration();
+}
+
+template <class _Stage>
+inline index_t getStageIteration( const _Stage&, long ) noexcept {
+  return 0;
+}
+
+// Gets the results of the formers
+template <class _Former>
+inline auto getFormerMatrixU( const _Former &former, const RowBlockDistTag ) noexcept -> decltype(former.matrixUj()) {
+  return former.matrixUj();
+}
+
+template <class _Former>
+inline auto getFormerMatrixU( const _Former &former, const ColBlockDistTag ) noexcept -> decltype(former.matrixU()) {
+  return former.matrixU();
+}
+
+template <class _Former, class _Dist>
+inline auto getFormerMatrixV( const _Former &former, const _Dist ) noexcept -> decltype(former.matrixVj()) {
+  return former.matrixVj();
+}
+
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Construct with given parameters.
+///
+template <class _Solver>
+SolverHolder<_Solver>::SolverHolder(
+    const Parameters<ValType> &parameters
+) noexcept
+  : solver_(parameters),
+    sketcher_(solver_.sketcher()),
+    orthogonalizer_(solver_.orthogonalizer()),
+    integrator_(solver_.integrator()),
+    former_(solver_.former()),
+    so_converter_(solver_.soConverter()),
+    oi_converter_(solver_.oiConverter()),
+    if_converter_(solver_.ifConverter()) {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the solver.
+///
+template <class _Solver>
+_Solver& SolverHolder<_Solver>::solver() noexcept {
+  return solver_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  solver
+///
+template <class _Solver>
+const _Solver& SolverHolder<_Solver>::solver() const noexcept {
+  return solver_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::Solver::initialize
+///
+template <class _Solver>
+void SolverHolder<_Solver>::initialize() noexcept {
+  solver_.initialize();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::Solver::operator()
+///
+template <class _Solver>
+void SolverHolder<_Solver>::operator()(
+    const MatrixType &matrix_a
+) noexcept {
+  solver_(matrix_a);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::Solver::isInitialized
+///
+template <class _Solver>
+bool SolverHolder<_Solver>::isInitialized() const noexcept {
+  return solver_.isInitialized();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::Solver::isComputed
+///
+template <class _Solver>
+bool SolverHolder<_Solver>::isComputed() const noexcept {
+  return solver_.isComputed();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::Solver::workspaceSize
+///
+template <class _Solver>
+index_t SolverHolder<_Solver>::workspaceSize() const noexcept {
+  return solver_.workspaceSize();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::Solver::memoryRequirement
+///
+template <class _Solver>
+std::size_t SolverHolder<_Solver>::memoryRequirement() const noexcept {
+  return solver_.memoryRequirement();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the number of iterations of the integrator (zero if the integrator does not iterate).
+///
+template <class _Solver>
+index_t SolverHolder<_Solver>::iteration() const noexcept {
+  return detail::getStageIteration(solver_.integrator(), 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the random seed of the sketcher.
+///
+/// @return  false if the sketcher has no random seed.
+///
+template <class _Solver>
+bool SolverHolder<_Solver>::setSeed(
+    const index_t seed
+) noexcept {
+  return detail::setStageSeed(solver_.sketcher(), seed, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the maximum number of iterations of the integrator.
+///
+/// @return  false if the integrator has no maximum number of iterations.
+///
+template <class _Solver>
+bool SolverHolder<_Solver>::setMaxIteration(
+    const index_t max_iteration
+) noexcept {
+  return detail::setStageMaxIteration(solver_.integrator(), max_iteration, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Sets the tolerance of convergence condition of the integrator.
+///
+/// @return  false if the integrator has no tolerance.
+///
+template <class _Solver>
+bool SolverHolder<_Solver>::setTolerance(
+    const RealValType tolerance
+) noexcept {
+  return detail::setStageTolerance(solver_.integrator(), tolerance, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::Solver::sketcher
+///
+template <class _Solver>
+const StageInterface& SolverHolder<_Solver>::sketcher() const noexcept {
+  return sketcher_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::Solver::orthogonalizer
+///
+template <class _Solver>
+const StageInterface& SolverHolder<_Solver>::orthogonalizer() const noexcept {
+  return orthogonalizer_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::Solver::integrator
+///
+template <class _Solver>
+const StageInterface& SolverHolder<_Solver>::integrator() const noexcept {
+  return integrator_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::Solver::former
+///
+template <class _Solver>
+const StageInterface& SolverHolder<_Solver>::former() const noexcept {
+  return former_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::Solver::soConverter
+///
+template <class _Solver>
+const StageInterface& SolverHolder<_Solver>::soConverter() const noexcept {
+  return so_converter_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::Solver::oiConverter
+///
+template <class _Solver>
+const StageInterface& SolverHolder<_Solver>::oiConverter() const noexcept {
+  return oi_converter_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::Solver::ifConverter
+///
+template <class _Solver>
+const StageInterface& SolverHolder<_Solver>::ifConverter() const noexcept {
+  return if_converter_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the singular values.
+///
+template <class _Solver>
+const DenseVector<typename SolverHolder<_Solver>::RealValType>& SolverHolder<_Solver>::vectorS() const noexcept {
+  return solver_.former().vectorS();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the left singular vectors (see @ref SolverInterface for the distribution).
+///
+template <class _Solver>
+const typename SolverHolder<_Solver>::MatrixUType& SolverHolder<_Solver>::matrixU() const noexcept {
+  return detail::getFormerMatrixU(solver_.former(), DistType());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the right singular vectors (see @ref SolverInterface for the distribution).
+///
+template <class _Solver>
+const typename SolverHolder<_Solver>::MatrixVType& SolverHolder<_Solver>::matrixV() const noexcept {
+  return detail::getFormerMatrixV(solver_.former(), DistType());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::Solver::time
+///
+template <class _Solver>
+double SolverHolder<_Solver>::time() const noexcept {
+  return solver_.time();
+}
+
+}  // namespace isvd
+
+}  // namespace mcnla
+
+#endif  // MCNLA_ISVD_SOLVER_SOLVER_INTERFACE_HPP_
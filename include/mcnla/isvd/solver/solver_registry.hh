@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/isvd/solver/solver_registry.hh
+/// @brief   The definition of iSVD solver registry.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_ISVD_SOLVER_SOLVER_REGISTRY_HH_
+#define MCNLA_ISVD_SOLVER_SOLVER_REGISTRY_HH_
+
+#include <mcnla/isvd/def.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+#include <mcnla/isvd/core/parameters.hpp>
+#include <mcnla/isvd/solver/stage_traits.hpp>
+#include <mcnla/isvd/solver/solver.hpp>
+#include <mcnla/isvd/solver/solver_interface.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The iSVD namespace.
+//
+namespace isvd {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  isvd_solver_module
+/// The iSVD solver registry.
+///
+/// Maps the names of the stages (see @ref StageTraits) to the factories of the @ref Solver "solvers", so that the stages can
+/// be selected at runtime, e.g. from the command line or a @ref Configuration "configuration file". The solvers are created
+/// behind the @ref SolverInterface "solver interface".
+///
+/// The registry of each distribution (see #instance) contains the following stages, and all the combinations of them:
+///
+/// - `RowBlockDistTag`: the row-block Gaussian projection and column sampling sketchers, and the row-block Gramian, symmetric
+///   and TSQR formers.
+/// - `ColBlockDistTag`: the column-block Gaussian projection sketcher and the column-block Gramian former.
+///
+/// The integrators are the row-block Kolmogorov-Nagumo, Gramian Kolmogorov-Nagumo, Wen-Yin, Gramian Wen-Yin and reduction
+/// integrators.
+///
+/// The orthogonalizer is always the row-block Gramian orthogonalizer, and the formers compute the right singular vectors.
+/// Other combinations can be added by #add.
+///
+/// @tparam  _Dist  The distribution of the input matrix A (see @ref StageTraits).
+/// @tparam  _Val   The value type.
+///
+template <class _Dist, typename _Val>
+class SolverRegistry {
+
+ public:
+
+  using InterfaceType = SolverInterface<_Dist, _Val>;
+  using FactoryType   = std::unique_ptr<InterfaceType>(*)( const Parameters<_Val> &parameters );
+
+  /// The registered solver.
+  struct Entry {
+
+    /// The name of the sketcher.
+    std::string sketcher;
+
+    /// The name of the orthogonalizer.
+    std::string orthogonalizer;
+
+    /// The name of the integrator.
+    std::string integrator;
+
+    /// The name of the former.
+    std::string former;
+
+    /// The factory.
+    FactoryType factory;
+
+  };
+
+ protected:
+
+  /// The registered solvers.
+  std::vector<Entry> entries_;
+
+ public:
+
+  // Constructor
+  inline SolverRegistry() noexcept = default;
+
+  // Gets instance
+  static inline SolverRegistry& instance() noexcept;
+
+  // Registers
+  template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+  inline SolverRegistry& add() noexcept;
+
+  // Gets data
+  inline const std::vector<Entry>& entries() const noexcept;
+  inline const Entry* find( const std::string &sketcher, const std::string &orthogonalizer,
+                            const std::string &integrator, const std::string &former ) const noexcept;
+
+  // Creates solver
+  inline std::unique_ptr<InterfaceType> create(
+      const std::string &sketcher, const std::string &orthogonalizer, const std::string &integrator,
+      const std::string &former, const Parameters<_Val> &parameters ) const noexcept;
+
+ protected:
+
+  // Creates solver
+  template <class _Solver>
+  static inline std::unique_ptr<InterfaceType> createSolver( const Parameters<_Val> &parameters ) noexcept;
+
+};
+
+}  // namespace isvd
+
+}  // namespace mcnla
+
+#endif  // MCNLA_ISVD_SOLVER_SOLVER_REGISTRY_HH_
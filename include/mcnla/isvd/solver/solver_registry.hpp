@@ -0,0 +1,191 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/isvd/solver/solver_registry.hpp
+/// @brief   The iSVD solver registry.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_ISVD_SOLVER_SOLVER_REGISTRY_HPP_
+#define MCNLA_ISVD_SOLVER_SOLVER_REGISTRY_HPP_
+
+#include <mcnla/isvd/solver/solver_registry.hh>
+#include <type_traits>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The iSVD namespace.
+//
+namespace isvd {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The detail namespace.
+//
+namespace detail {
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+// The list of stages
+template <class ..._Stages> struct StageList {};
+
+// Registers all the combinations of the stages
+template <class _Registry, class ..._Chosen>
+inline void addSolvers( _Registry &registry, StageList<_Chosen...> ) noexcept {
+  registry.template add<_Chosen...>();
+}
+
+template <class _Registry, class ..._Chosen, class ..._Stages, class ..._Lists>
+inline void addSolvers( _Registry &registry, StageList<_Chosen...>, StageList<_Stages...>, _Lists... lists ) noexcept {
+  using Expander = int[];
+  static_cast<void>(Expander{0, (addSolvers(registry, StageList<_Chosen..., _Stages>(), lists...), 0)...});
+}
+
+// The row-block integrators
+template <typename _Val>
+using RowBlockIntegratorList = StageList<RowBlockKolmogorovNagumoIntegrator<_Val>,
+                                         RowBlockGramianKolmogorovNagumoIntegrator<_Val>,
+                                         RowBlockWenYinIntegrator<_Val>,
+                                         RowBlockGramianWenYinIntegrator<_Val>,
+                                         RowBlockReductionIntegrator<_Val>>;
+
+// Registers the default solvers
+template <typename _Val>
+inline void addDefaultSolvers( SolverRegistry<RowBlockDistTag, _Val> &registry ) noexcept {
+  addSolvers(registry, StageList<>(),
+             StageList<RowBlockGaussianProjectionSketcher<_Val>, RowBlockColumnSamplingSketcher<_Val>>(),
+             StageList<RowBlockGramianOrthogonalizer<_Val>>(),
+             RowBlockIntegratorList<_Val>(),
+             StageList<RowBlockGramianFormer<_Val, true>, RowBlockSymmetricFormer<_Val, true>,
+                       RowBlockTsqrFormer<_Val, true>>());
+}
+
+template <typename _Val>
+inline void addDefaultSolvers( SolverRegistry<ColBlockDistTag, _Val> &registry ) noexcept {
+  addSolvers(registry, StageList<>(),
+             StageList<ColBlockGaussianProjectionSketcher<_Val>>(),
+             StageList<RowBlockGramianOrthogonalizer<_Val>>(),
+             RowBlockIntegratorList<_Val>(),
+             StageList<ColBlockGramianFormer<_Val, true>>());
+}
+
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the registry of the default solvers.
+///
+template <class _Dist, typename _Val>
+SolverRegistry<_Dist, _Val>& SolverRegistry<_Dist, _Val>::instance() noexcept {
+  static SolverRegistry registry = [] {
+    SolverRegistry registry;
+    detail::addDefaultSolvers(registry);
+    return registry;
+  }();
+  return registry;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Registers a solver.
+///
+/// The solver replaces the registered one with the same names.
+///
+/// @tparam  _Sketcher        The sketcher type.
+/// @tparam  _Orthogonalizer  The orthogonalizer type.
+/// @tparam  _Integrator      The integrator type.
+/// @tparam  _Former          The former type.
+///
+template <class _Dist, typename _Val> template <class _Sketcher, class _Orthogonalizer, class _Integrator, class _Former>
+SolverRegistry<_Dist, _Val>& SolverRegistry<_Dist, _Val>::add() noexcept {
+  static_assert(std::is_same<typename StageTraits<_Former>::MatrixDist, _Dist>::value,
+                "The former should use the distribution of the registry!");
+  static_assert(std::is_same<ValT<_Sketcher>, _Val>::value, "The value type should be the same as the registry!");
+
+  Entry entry{StageTraits<_Sketcher>::name, StageTraits<_Orthogonalizer>::name,
+              StageTraits<_Integrator>::name, StageTraits<_Former>::name,
+              createSolver<Solver<_Sketcher, _Orthogonalizer, _Integrator, _Former>>};
+
+  for ( auto &registered : entries_ ) {
+    if ( registered.sketcher == entry.sketcher && registered.orthogonalizer == entry.orthogonalizer &&
+         registered.integrator == entry.integrator && registered.former == entry.former ) {
+      registered = entry;
+      return *this;
+    }
+  }
+  entries_.push_back(entry);
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the registered solvers.
+///
+template <class _Dist, typename _Val>
+const std::vector<typename SolverRegistry<_Dist, _Val>::Entry>& SolverRegistry<_Dist, _Val>::entries() const noexcept {
+  return entries_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Finds a registered solver.
+///
+/// @return  The registered solver, or `nullptr` if not found.
+///
+template <class _Dist, typename _Val>
+const typename SolverRegistry<_Dist, _Val>::Entry* SolverRegistry<_Dist, _Val>::find(
+    const std::string &sketcher,
+    const std::string &orthogonalizer,
+    const std::string &integrator,
+    const std::string &former
+) const noexcept {
+  for ( const auto &entry : entries_ ) {
+    if ( entry.sketcher == sketcher && entry.orthogonalizer == orthogonalizer &&
+         entry.integrator == integrator && entry.former == former ) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Creates a solver.
+///
+/// @param  sketcher        The name of the sketcher.
+/// @param  orthogonalizer  The name of the orthogonalizer.
+/// @param  integrator      The name of the integrator.
+/// @param  former          The name of the former.
+/// @param  parameters      The parameters.
+///
+/// @return  The solver, or `nullptr` if the combination is not registered.
+///
+template <class _Dist, typename _Val>
+std::unique_ptr<typename SolverRegistry<_Dist, _Val>::InterfaceType> SolverRegistry<_Dist, _Val>::create(
+    const std::string &sketcher,
+    const std::string &orthogonalizer,
+    const std::string &integrator,
+    const std::string &former,
+    const Parameters<_Val> &parameters
+) const noexcept {
+  const auto entry = find(sketcher, orthogonalizer, integrator, former);
+  if ( entry == nullptr ) {
+    return nullptr;
+  }
+  return entry->factory(parameters);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Creates a solver.
+///
+template <class _Dist, typename _Val> template <class _Solver>
+std::unique_ptr<typename SolverRegistry<_Dist, _Val>::InterfaceType> SolverRegistry<_Dist, _Val>::createSolver(
+    const Parameters<_Val> &parameters
+) noexcept {
+  return std::unique_ptr<InterfaceType>(new SolverHolder<_Solver>(parameters));
+}
+
+}  // namespace isvd
+
+}  // namespace mcnla
+
+#endif  // MCNLA_ISVD_SOLVER_SOLVER_REGISTRY_HPP_
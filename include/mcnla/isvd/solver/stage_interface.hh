@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/isvd/solver/stage_interface.hh
+/// @brief   The definition of iSVD stage interface.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_ISVD_SOLVER_STAGE_INTERFACE_HH_
+#define MCNLA_ISVD_SOLVER_STAGE_INTERFACE_HH_
+
+#include <mcnla/isvd/def.hpp>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The iSVD namespace.
+//
+namespace isvd {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  isvd_solver_module
+/// The iSVD stage interface.
+///
+/// The type-erased view of a stage, which provides the information of the stage (see @ref StageWrapper) without knowing
+/// its type.
+///
+/// @see  StageHolder, SolverInterface
+///
+class StageInterface {
+
+ public:
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  /// @brief  The default destructor.
+  ///
+  virtual ~StageInterface() noexcept = default;
+
+  // Operators
+  friend inline std::ostream& operator<<( std::ostream &os, const StageInterface &stage ) noexcept;
+
+  // Gets data
+  virtual bool isInitialized() const noexcept = 0;
+  virtual bool isComputed() const noexcept = 0;
+
+  // Gets compute time
+  virtual double time() const noexcept = 0;
+  virtual double commTime() const noexcept = 0;
+  virtual std::vector<double> times() const noexcept = 0;
+  virtual std::vector<double> commTimes() const noexcept = 0;
+  virtual std::vector<double> moments() const noexcept = 0;
+  virtual const char* names() const noexcept = 0;
+
+  // Gets operation count
+  virtual double flops() const noexcept = 0;
+  virtual double gflops() const noexcept = 0;
+  virtual double bytesMoved() const noexcept = 0;
+  virtual double commBytes() const noexcept = 0;
+
+  // Gets memory requirement
+  virtual std::size_t memoryRequirement() const noexcept = 0;
+
+ protected:
+
+  // Outputs name
+  virtual std::ostream& outputName( std::ostream &os ) const noexcept = 0;
+
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  isvd_solver_module
+/// The iSVD stage holder.
+///
+/// Implements the @ref StageInterface "stage interface" by referring to a stage.
+///
+/// @tparam  _Stage  The stage type.
+///
+template <class _Stage>
+class StageHolder
+  : public StageInterface {
+
+ protected:
+
+  /// The stage.
+  const _Stage &stage_;
+
+ public:
+
+  // Constructor
+  inline StageHolder( const _Stage &stage ) noexcept;
+
+  // Destructor
+  virtual ~StageHolder() noexcept override = default;
+
+  // Gets stage
+  inline const _Stage& stage() const noexcept;
+
+  // Gets data
+  virtual bool isInitialized() const noexcept override;
+  virtual bool isComputed() const noexcept override;
+
+  // Gets compute time
+  virtual double time() const noexcept override;
+  virtual double commTime() const noexcept override;
+  virtual std::vector<double> times() const noexcept override;
+  virtual std::vector<double> commTimes() const noexcept override;
+  virtual std::vector<double> moments() const noexcept override;
+  virtual const char* names() const noexcept override;
+
+  // Gets operation count
+  virtual double flops() const noexcept override;
+  virtual double gflops() const noexcept override;
+  virtual double bytesMoved() const noexcept override;
+  virtual double commBytes() const noexcept override;
+
+  // Gets memory requirement
+  virtual std::size_t memoryRequirement() const noexcept override;
+
+ protected:
+
+  // Outputs name
+  virtual std::ostream& outputName( std::ostream &os ) const noexcept override;
+
+};
+
+}  // namespace isvd
+
+}  // namespace mcnla
+
+#endif  // MCNLA_ISVD_SOLVER_STAGE_INTERFACE_HH_
@@ -0,0 +1,168 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/isvd/solver/stage_interface.hpp
+/// @brief   The iSVD stage interface.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_ISVD_SOLVER_STAGE_INTERFACE_HPP_
+#define MCNLA_ISVD_SOLVER_STAGE_INTERFACE_HPP_
+
+#include <mcnla/isvd/solver/stage_interface.hh>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The iSVD namespace.
+//
+namespace isvd {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Output name to stream.
+///
+std::ostream& operator<<(
+    std::ostream &os,
+    const StageInterface &stage
+) noexcept {
+  return stage.outputName(os);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Construct with given stage.
+///
+template <class _Stage>
+StageHolder<_Stage>::StageHolder(
+    const _Stage &stage
+) noexcept
+  : stage_(stage) {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief  Gets the stage.
+///
+template <class _Stage>
+const _Stage& StageHolder<_Stage>::stage() const noexcept {
+  return stage_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::isInitialized
+///
+template <class _Stage>
+bool StageHolder<_Stage>::isInitialized() const noexcept {
+  return stage_.isInitialized();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::isComputed
+///
+template <class _Stage>
+bool StageHolder<_Stage>::isComputed() const noexcept {
+  return stage_.isComputed();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::time
+///
+template <class _Stage>
+double StageHolder<_Stage>::time() const noexcept {
+  return stage_.time();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::commTime
+///
+template <class _Stage>
+double StageHolder<_Stage>::commTime() const noexcept {
+  return stage_.commTime();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::times
+///
+template <class _Stage>
+std::vector<double> StageHolder<_Stage>::times() const noexcept {
+  return stage_.times();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::commTimes
+///
+template <class _Stage>
+std::vector<double> StageHolder<_Stage>::commTimes() const noexcept {
+  return stage_.commTimes();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::moments
+///
+template <class _Stage>
+std::vector<double> StageHolder<_Stage>::moments() const noexcept {
+  return stage_.moments();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::names
+///
+template <class _Stage>
+const char* StageHolder<_Stage>::names() const noexcept {
+  return stage_.names();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::flops
+///
+template <class _Stage>
+double StageHolder<_Stage>::flops() const noexcept {
+  return stage_.flops();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::gflops
+///
+template <class _Stage>
+double StageHolder<_Stage>::gflops() const noexcept {
+  return stage_.gflops();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::bytesMoved
+///
+template <class _Stage>
+double StageHolder<_Stage>::bytesMoved() const noexcept {
+  return stage_.bytesMoved();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::commBytes
+///
+template <class _Stage>
+double StageHolder<_Stage>::commBytes() const noexcept {
+  return stage_.commBytes();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  mcnla::isvd::StageWrapper::memoryRequirement
+///
+template <class _Stage>
+std::size_t StageHolder<_Stage>::memoryRequirement() const noexcept {
+  return stage_.memoryRequirement();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @copydoc  operator<<
+///
+template <class _Stage>
+std::ostream& StageHolder<_Stage>::outputName(
+    std::ostream &os
+) const noexcept {
+  return os << stage_;
+}
+
+}  // namespace isvd
+
+}  // namespace mcnla
+
+#endif  // MCNLA_ISVD_SOLVER_STAGE_INTERFACE_HPP_
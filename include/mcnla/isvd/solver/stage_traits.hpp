@@ -0,0 +1,222 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    include/mcnla/isvd/solver/stage_traits.hpp
+/// @brief   The data distribution traits of iSVD stages.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#ifndef MCNLA_ISVD_SOLVER_STAGE_TRAITS_HPP_
+#define MCNLA_ISVD_SOLVER_STAGE_TRAITS_HPP_
+
+#include <mcnla/isvd/def.hpp>
+#include <mcnla/isvd/sketcher.hpp>
+#include <mcnla/isvd/orthogonalizer.hpp>
+#include <mcnla/isvd/integrator.hpp>
+#include <mcnla/isvd/former.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The MCNLA namespace.
+//
+namespace mcnla {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  The iSVD namespace.
+//
+namespace isvd {
+
+/// @ingroup  isvd_solver_module
+/// The full distribution tag (each MPI node stores all rows of its own data).
+struct FullDistTag {};
+
+/// @ingroup  isvd_solver_module
+/// The row-block distribution tag (each MPI node stores a row-block of the data).
+struct RowBlockDistTag {};
+
+/// @ingroup  isvd_solver_module
+/// The column-block distribution tag (each MPI node stores a column-block of the data).
+struct ColBlockDistTag {};
+
+/// @ingroup  isvd_solver_module
+/// The partial-sum distribution tag (the data is the sum of the data on all MPI nodes).
+struct PartialSumDistTag {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @ingroup  isvd_solver_module
+/// The data distribution traits of a stage.
+///
+/// Defines the following types:
+/// - `MatrixDist`: the distribution of the input matrix A (sketchers and formers).
+/// - `InputDist`:  the distribution of the input Q (orthogonalizers, integrators and formers).
+/// - `OutputDist`: the distribution of the output Q (sketchers, orthogonalizers and integrators).
+///
+/// and the name of the stage in the @ref SolverRegistry "solver registry" as `name`.
+///
+/// @tparam  _Stage  The stage type.
+///
+template <class _Stage>
+struct StageTraits;
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+// Sketchers
+
+template <typename _Val>
+struct StageTraits<Sketcher<GaussianProjectionSketcherTag, _Val>> {
+  static constexpr const char* name = "GaussianProjectionSketcher";
+  using MatrixDist = FullDistTag;
+  using OutputDist = FullDistTag;
+};
+
+template <typename _Val>
+struct StageTraits<Sketcher<RowBlockGaussianProjectionSketcherTag, _Val>> {
+  static constexpr const char* name = "RowBlockGaussianProjectionSketcher";
+  using MatrixDist = RowBlockDistTag;
+  using OutputDist = RowBlockDistTag;
+};
+
+template <typename _Val>
+struct StageTraits<Sketcher<ColBlockGaussianProjectionSketcherTag, _Val>> {
+  static constexpr const char* name = "ColBlockGaussianProjectionSketcher";
+  using MatrixDist = ColBlockDistTag;
+  using OutputDist = PartialSumDistTag;
+};
+
+template <typename _Val>
+struct StageTraits<Sketcher<ColumnSamplingSketcherTag, _Val>> {
+  static constexpr const char* name = "ColumnSamplingSketcher";
+  using MatrixDist = FullDistTag;
+  using OutputDist = FullDistTag;
+};
+
+template <typename _Val>
+struct StageTraits<Sketcher<RowBlockColumnSamplingSketcherTag, _Val>> {
+  static constexpr const char* name = "RowBlockColumnSamplingSketcher";
+  using MatrixDist = RowBlockDistTag;
+  using OutputDist = RowBlockDistTag;
+};
+
+// Orthogonalizers
+
+template <typename _Val>
+struct StageTraits<Orthogonalizer<QrOrthogonalizerTag, _Val>> {
+  static constexpr const char* name = "QrOrthogonalizer";
+  using InputDist  = FullDistTag;
+  using OutputDist = FullDistTag;
+};
+
+template <typename _Val>
+struct StageTraits<Orthogonalizer<SvdOrthogonalizerTag, _Val>> {
+  static constexpr const char* name = "SvdOrthogonalizer";
+  using InputDist  = FullDistTag;
+  using OutputDist = FullDistTag;
+};
+
+template <typename _Val>
+struct StageTraits<Orthogonalizer<GramianOrthogonalizerTag, _Val>> {
+  static constexpr const char* name = "GramianOrthogonalizer";
+  using InputDist  = FullDistTag;
+  using OutputDist = FullDistTag;
+};
+
+template <typename _Val>
+struct StageTraits<Orthogonalizer<RowBlockGramianOrthogonalizerTag, _Val>> {
+  static constexpr const char* name = "RowBlockGramianOrthogonalizer";
+  using InputDist  = RowBlockDistTag;
+  using OutputDist = RowBlockDistTag;
+};
+
+// Integrators
+
+template <typename _Val>
+struct StageTraits<Integrator<KolmogorovNagumoIntegratorTag, _Val>> {
+  static constexpr const char* name = "KolmogorovNagumoIntegrator";
+  using InputDist  = FullDistTag;
+  using OutputDist = FullDistTag;
+};
+
+template <typename _Val>
+struct StageTraits<Integrator<RowBlockKolmogorovNagumoIntegratorTag, _Val>> {
+  static constexpr const char* name = "RowBlockKolmogorovNagumoIntegrator";
+  using InputDist  = RowBlockDistTag;
+  using OutputDist = RowBlockDistTag;
+};
+
+template <typename _Val>
+struct StageTraits<Integrator<RowBlockGramianKolmogorovNagumoIntegratorTag, _Val>> {
+  static constexpr const char* name = "RowBlockGramianKolmogorovNagumoIntegrator";
+  using InputDist  = RowBlockDistTag;
+  using OutputDist = RowBlockDistTag;
+};
+
+template <typename _Val>
+struct StageTraits<Integrator<RowBlockWenYinIntegratorTag, _Val>> {
+  static constexpr const char* name = "RowBlockWenYinIntegrator";
+  using InputDist  = RowBlockDistTag;
+  using OutputDist = RowBlockDistTag;
+};
+
+template <typename _Val>
+struct StageTraits<Integrator<RowBlockGramianWenYinIntegratorTag, _Val>> {
+  static constexpr const char* name = "RowBlockGramianWenYinIntegrator";
+  using InputDist  = RowBlockDistTag;
+  using OutputDist = RowBlockDistTag;
+};
+
+template <typename _Val>
+struct StageTraits<Integrator<RowBlockReductionIntegratorTag, _Val>> {
+  static constexpr const char* name = "RowBlockReductionIntegrator";
+  using InputDist  = RowBlockDistTag;
+  using OutputDist = RowBlockDistTag;
+};
+
+// Formers
+
+template <typename _Val, bool _jobv>
+struct StageTraits<Former<SvdFormerTag<_jobv>, _Val>> {
+  static constexpr const char* name = "SvdFormer";
+  using MatrixDist = FullDistTag;
+  using InputDist  = FullDistTag;
+};
+
+template <typename _Val, bool _jobv>
+struct StageTraits<Former<GramianFormerTag<_jobv>, _Val>> {
+  static constexpr const char* name = "GramianFormer";
+  using MatrixDist = FullDistTag;
+  using InputDist  = FullDistTag;
+};
+
+template <typename _Val, bool _jobv>
+struct StageTraits<Former<RowBlockGramianFormerTag<_jobv>, _Val>> {
+  static constexpr const char* name = "RowBlockGramianFormer";
+  using MatrixDist = RowBlockDistTag;
+  using InputDist  = RowBlockDistTag;
+};
+
+template <typename _Val, bool _jobv>
+struct StageTraits<Former<ColBlockGramianFormerTag<_jobv>, _Val>> {
+  static constexpr const char* name = "ColBlockGramianFormer";
+  using MatrixDist = ColBlockDistTag;
+  using InputDist  = FullDistTag;
+};
+
+template <typename _Val, bool _jobv>
+struct StageTraits<Former<RowBlockSymmetricFormerTag<_jobv>, _Val>> {
+  static constexpr const char* name = "RowBlockSymmetricFormer";
+  using MatrixDist = RowBlockDistTag;
+  using InputDist  = RowBlockDistTag;
+};
+
+template <typename _Val, bool _jobv>
+struct StageTraits<Former<RowBlockTsqrFormerTag<_jobv>, _Val>> {
+  static constexpr const char* name = "RowBlockTsqrFormer";
+  using MatrixDist = RowBlockDistTag;
+  using InputDist  = RowBlockDistTag;
+};
+
+#endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+}  // namespace isvd
+
+}  // namespace mcnla
+
+#endif  // MCNLA_ISVD_SOLVER_STAGE_TRAITS_HPP_
@@ -87,6 +87,7 @@ int main( int argc, char **argv ) {
   // ====================================================================================================================== //
   // Create statistics collector
   StatisticsSet set_time(num_test), set_comm_time(num_test);
+  StatisticsSet set_gflops(num_test), set_bytes(num_test), set_comm_bytes(num_test);
   std::vector<StatisticsSet> set_times, set_comm_times;
 
   // ====================================================================================================================== //
@@ -111,6 +112,9 @@ int main( int argc, char **argv ) {
       auto times      = stage.times();
       auto comm_time  = stage.commTime();
       auto comm_times = stage.commTimes();
+      auto gflops     = stage.gflops();
+      auto bytes      = stage.bytesMoved() / 1048576.0;
+      auto comm_bytes = stage.commBytes() / 1048576.0;
 
       std::cout << std::setw(log10(num_test)+2) << t << " | time: " << time << " (";
       if ( t >= 0 ) {
@@ -152,7 +156,13 @@ int main( int argc, char **argv ) {
         }
       }
 
-      std::cout << ")" << std::endl;
+      std::cout << ") | GFLOPS: " << gflops << " | moved: " << bytes << " MB | communicated: " << comm_bytes << " MB"
+                << std::endl;
+      if ( t >= 0 ) {
+        set_gflops(gflops);
+        set_bytes(bytes);
+        set_comm_bytes(comm_bytes);
+      }
     }
   }
 
@@ -176,7 +186,8 @@ int main( int argc, char **argv ) {
       std::cout << set_comm_times[i].mean();
     }
 
-    std::cout << ")" << std::endl << std::endl;
+    std::cout << ") | GFLOPS: " << set_gflops.mean() << " | moved: " << set_bytes.mean()
+              << " MB | communicated: " << set_comm_bytes.mean() << " MB" << std::endl << std::endl;
   }
 
   mcnla::finalize();
@@ -5,7 +5,10 @@
 /// @author  Mu Yang <<emfomy@gmail.com>>
 ///
 
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <string>
 #include <mcnla.hpp>
 #include <omp.h>
 
@@ -33,6 +36,9 @@
 #define FTYPE ColBlockGramianFormer
 #endif  // FTYPE
 
+#define STR_(x) #x
+#define STR(y) STR_(y)
+
 void check(       mcnla::matrix::DenseMatrixColMajor<double> &matrix_ajc,
             const mcnla::matrix::DenseMatrixColMajor<double> &matrix_u,
             const mcnla::matrix::DenseMatrixRowMajor<double> &matrix_vj,
@@ -62,6 +68,49 @@ int main( int argc, char **argv ) {
               << MCNLA_PATCH_VERSION << " iSVD driver for DenseMatrix (column-block version)" << std::endl << std::endl;
   }
 
+  // ====================================================================================================================== //
+  // Load stage options (e.g. --integrator=RowBlockKolmogorovNagumoIntegrator)
+  using Registry = mcnla::isvd::SolverRegistry<mcnla::isvd::ColBlockDistTag, double>;
+  const char *stage_options[4] = {"--sketcher=", "--orthogonalizer=", "--integrator=", "--former="};
+  std::string stage_names[4]   = {STR(STYPE), STR(OTYPE), STR(ITYPE), STR(FTYPE)};
+  bool stage_given[4] = {false, false, false, false};
+  bool list_stages = false;
+  {
+    int argj = 1;
+    for ( int argi = 1; argi < argc; ++argi ) {
+      bool is_option = false;
+      for ( int i = 0; i < 4; ++i ) {
+        const auto len = std::strlen(stage_options[i]);
+        if ( std::strncmp(argv[argi], stage_options[i], len) == 0 ) {
+          stage_names[i] = argv[argi] + len;
+          stage_given[i] = is_option = true;
+        }
+      }
+      if ( std::strcmp(argv[argi], "--list") == 0 ) {
+        list_stages = is_option = true;
+      }
+      if ( !is_option ) {
+        argv[argj++] = argv[argi];
+      }
+    }
+    argc = argj;
+  }
+
+  // List the combinations of stages
+  if ( list_stages ) {
+    if ( mpi_rank == mpi_root ) {
+      for ( const auto &entry : Registry::instance().entries() ) {
+        std::cout << "--sketcher="       << entry.sketcher
+                  << " --orthogonalizer=" << entry.orthogonalizer
+                  << " --integrator="     << entry.integrator
+                  << " --former="         << entry.former << std::endl;
+      }
+      std::cout << std::endl;
+    }
+    mcnla::finalize();
+    return 0;
+  }
+
   // ====================================================================================================================== //
   // Check input
   if ( argc < 5 ) {
@@ -69,7 +118,9 @@ int main( int argc, char **argv ) {
       std::cout << "Usage: " << argv[0]
                 << " <A-mtx-file> <S-mtx-file> <U-mtx-file> <skip>"
                    " [#sketch] [rank] [over-sampling-rank] [tolerance] [maxiter]"
+                   " [--sketcher=NAME] [--orthogonalizer=NAME] [--integrator=NAME] [--former=NAME]"
                 << std::endl << std::endl;
+      std::cout << "Use --list to list the combinations of stages." << std::endl << std::endl;
       MPI_Abort(mpi_comm, 1);
     }
     MPI_Barrier(mpi_comm);
@@ -86,12 +137,52 @@ int main( int argc, char **argv ) {
 
   // ====================================================================================================================== //
   // Load parameters
+  mcnla::index_t N = 16, k = 20, p = 12, maxiter = 256, config_rank = 0;
+  double tol = 1e-3;
+
+  // Load configuration if MCNLA_CONFIG is set to the configuration file (see isvd_tune)
+  const char *config_file = std::getenv("MCNLA_CONFIG");
+  if ( config_file != nullptr ) {
+    mcnla::isvd::Configuration config;
+    if ( !config.load(config_file) ) {
+      if ( mpi_rank == mpi_root ) {
+        std::cout << "Unable to open " << config_file << "!" << std::endl << std::endl;
+      }
+      MPI_Abort(mpi_comm, 1);
+    }
+    config_rank = config.rank;
+    N           = config.num_sketch;
+    p           = config.over_rank;
+    tol         = config.tolerance;
+    maxiter     = config.max_iteration;
+#ifdef _OPENMP
+    if ( config.num_thread > 0 ) {
+      omp_set_num_threads(config.num_thread);
+    }
+#endif  // _OPENMP
+
+    // The command line options override the configuration file
+    const std::string *config_names[4] = {&config.sketcher, &config.orthogonalizer, &config.integrator, &config.former};
+    for ( int i = 0; i < 4; ++i ) {
+      if ( !stage_given[i] && !config_names[i]->empty() ) {
+        stage_names[i] = *config_names[i];
+      }
+    }
+  }
+
+  // The command line arguments override the configuration file
   int argi = 4;
-  mcnla::index_t N       = ( argc > ++argi ) ? atof(argv[argi]) : 16;
-  mcnla::index_t k       = ( argc > ++argi ) ? atof(argv[argi]) : 20;
-  mcnla::index_t p       = ( argc > ++argi ) ? atof(argv[argi]) : 12;
-  double         tol     = ( argc > ++argi ) ? atof(argv[argi]) : 1e-3;
-  mcnla::index_t maxiter = ( argc > ++argi ) ? atof(argv[argi]) : 256;
+  N       = ( argc > ++argi ) ? atof(argv[argi]) : N;
+  k       = ( argc > ++argi ) ? atof(argv[argi]) : k;
+  p       = ( argc > ++argi ) ? atof(argv[argi]) : p;
+  tol     = ( argc > ++argi ) ? atof(argv[argi]) : tol;
+  maxiter = ( argc > ++argi ) ? atof(argv[argi]) : maxiter;
+
+  if ( config_rank > 0 && config_rank != k && mpi_rank == mpi_root ) {
+    std::cout << "Warning: the configuration is tuned for rank " << config_rank << ", but rank " << k << " is used."
+              << std::endl << std::endl;
+  }
+
   if ( mpi_rank == mpi_root ) {
     std::cout << "m = " << m
             << ", n = " << n
@@ -121,30 +212,30 @@ int main( int argc, char **argv ) {
 
   // ====================================================================================================================== //
   // Allocate stages
-  mcnla::isvd::STYPE<double> sketcher(parameters);
-  mcnla::isvd::OTYPE<double> orthogonalizer(parameters);
-  mcnla::isvd::ITYPE<double> integrator(parameters);
-#ifndef NJOBV
-  mcnla::isvd::FTYPE<double, true> former(parameters);
-#else  // NJOBV
-  mcnla::isvd::FTYPE<double, false> former(parameters);
-#endif  // NJOBV
-  mcnla::isvd::CollectionFromPartialSumToRowBlockConverter<double> so_converter(parameters);
-  mcnla::isvd::MatrixFromRowBlockToAllConverter<double> if_converter(parameters);
+  auto solver_ptr = Registry::instance().create(stage_names[0], stage_names[1], stage_names[2], stage_names[3], parameters);
+  if ( solver_ptr == nullptr ) {
+    if ( mpi_rank == mpi_root ) {
+      std::cout << "Unknown combination of stages: " << stage_names[0] << " / " << stage_names[1] << " / "
+                << stage_names[2] << " / " << stage_names[3] << "!" << std::endl;
+      std::cout << "Use --list to list the combinations of stages." << std::endl << std::endl;
+    }
+    MPI_Abort(mpi_comm, 1);
+  }
+  auto &solver         = *solver_ptr;
+  auto &sketcher       = solver.sketcher();
+  auto &orthogonalizer = solver.orthogonalizer();
+  auto &integrator     = solver.integrator();
+  auto &former         = solver.former();
 #ifndef NJOBV
   mcnla::isvd::MatrixFromColBlockToAllConverter<double> fe_converter2(parameters);
 #endif  // NJOBV
 
   // ====================================================================================================================== //
   // Initialize stages
-  sketcher.setSeed(rand());
-  integrator.setMaxIteration(maxiter).setTolerance(tol);
-  sketcher.initialize();
-  orthogonalizer.initialize();
-  integrator.initialize();
-  former.initialize();
-  so_converter.initialize();
-  if_converter.initialize();
+  solver.setSeed(rand());
+  solver.setMaxIteration(maxiter);
+  solver.setTolerance(tol);
+  solver.initialize();
 #ifndef NJOBV
   fe_converter2.initialize();
 #endif  // NJOBV
@@ -155,7 +246,8 @@ int main( int argc, char **argv ) {
     std::cout << "Uses " << sketcher << "." << std::endl;
     std::cout << "Uses " << orthogonalizer << "." << std::endl;
     std::cout << "Uses " << integrator << "." << std::endl;
-    std::cout << "Uses " << former << "." << std::endl << std::endl;
+    std::cout << "Uses " << former << "." << std::endl;
+    std::cout << "Uses " << solver.memoryRequirement() / 1048576.0 << " MB per node." << std::endl << std::endl;
   }
 
   // ====================================================================================================================== //
@@ -176,10 +268,6 @@ int main( int argc, char **argv ) {
   }
 
   // Allocate variables
-  auto collection_qj  = parameters.createCollectionQj();
-  auto collection_qjp = parameters.createCollectionQjp();
-  auto matrix_q       = parameters.createMatrixQbar();
-  auto matrix_qj      = parameters.createMatrixQbarj();
 #ifndef NJOBV
   auto matrix_v      = parameters.createMatrixV();
 #endif  // NJOBV
@@ -191,49 +279,30 @@ int main( int argc, char **argv ) {
     std::cout << std::fixed << std::setprecision(6);
   }
 
-  MPI_Barrier(mpi_comm);
-
-  if ( mpi_rank == mpi_root ) { std::cout << "Sketching ............................. " << std::flush; }
-  sketcher(matrix_ajc, collection_qjp);
-  if ( mpi_rank == mpi_root ) { std::cout << "Done!" << std::endl; }
-
-  MPI_Barrier(mpi_comm);
-
-  if ( mpi_rank == mpi_root ) { std::cout << "Scattering ............................ " << std::flush; }
-  so_converter(collection_qjp, collection_qj);
-  if ( mpi_rank == mpi_root ) { std::cout << "Done!" << std::endl; }
-
-  MPI_Barrier(mpi_comm);
-
-  if ( mpi_rank == mpi_root ) { std::cout << "Orthogonalization ..................... " << std::flush; }
-  orthogonalizer(collection_qj);
-  if ( mpi_rank == mpi_root ) { std::cout << "Done!" << std::endl; }
+  // Enable tracing if MCNLA_TRACE is set to the output file
+  const char *trace_file = std::getenv("MCNLA_TRACE");
 
   MPI_Barrier(mpi_comm);
 
-  if ( mpi_rank == mpi_root ) { std::cout << "Integration ........................... " << std::flush; }
-  integrator(collection_qj, matrix_qj);
+  if ( trace_file != nullptr ) { mcnla::utility::Tracer::instance().start(); }
+  if ( mpi_rank == mpi_root ) { std::cout << "Running iSVD .......................... " << std::flush; }
+  solver(matrix_ajc);
   if ( mpi_rank == mpi_root ) { std::cout << "Done!" << std::endl; }
+  if ( trace_file != nullptr ) { mcnla::utility::Tracer::instance().stop(); }
 
   MPI_Barrier(mpi_comm);
 
-  if ( mpi_rank == mpi_root ) { std::cout << "Gathering ............................. " << std::flush; }
-  if_converter(matrix_qj, matrix_q);
-  if ( mpi_rank == mpi_root ) { std::cout << "Done!" << std::endl; }
-
-  MPI_Barrier(mpi_comm);
-
-  if ( mpi_rank == mpi_root ) { std::cout << "Forming ............................... " << std::flush; }
-  former(matrix_ajc, matrix_q);
-  if ( mpi_rank == mpi_root ) { std::cout << "Done!" << std::endl; }
-
-  MPI_Barrier(mpi_comm);
+  if ( trace_file != nullptr ) {
+    if ( mpi_rank == mpi_root ) { std::cout << "Writing trace into " << trace_file << " ........ " << std::flush; }
+    mcnla::io::saveChromeTrace(trace_file, mpi_comm, mpi_root);
+    if ( mpi_rank == mpi_root ) { std::cout << "Done!" << std::endl; }
+  }
 
-  auto &&vector_s = former.vectorS();
-  auto &&matrix_u = former.matrixU();
+  auto &&vector_s = solver.vectorS();
+  auto &&matrix_u = solver.matrixU();
 
 #ifndef NJOBV
-  auto &&matrix_vj = former.matrixVj();
+  auto &&matrix_vj = solver.matrixV();
 #endif  // NJOBV
 
 #ifndef NJOBV
@@ -249,16 +318,16 @@ int main( int argc, char **argv ) {
   check(matrix_ajc, matrix_u, matrix_vj, vector_s, frerr, mpi_comm);
 #endif  // NJOBV
   if ( mpi_rank == mpi_root ) {
-    auto iter    = integrator.iteration();
+    auto iter    = solver.iteration();
     auto time_s  = sketcher.time();
     auto time_o  = orthogonalizer.time();
     auto time_i  = integrator.time();
     auto time_f  = former.time();
-    auto time_so = so_converter.time();
-    auto time_oi = 0.0;
-    auto time_if = if_converter.time();
+    auto time_so = solver.soConverter().time();
+    auto time_oi = solver.oiConverter().time();
+    auto time_if = solver.ifConverter().time();
     auto time_fe = 0.0;
-    auto time    = time_s + time_o + time_i + time_if + time_f + time_fe;
+    auto time    = solver.time() + time_fe;
     std::cout << "Average total computing time:   " << time    << " seconds." << std::endl;
     std::cout << "Average sketching time:         " << time_s  << " seconds." << std::endl;
     std::cout << "Average orthogonalizing time:   " << time_o  << " seconds." << std::endl;
@@ -0,0 +1,353 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    src/isvd_tune.cpp
+/// @brief   The autotuning driver for the iSVD drivers (row-block version)
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include <mcnla.hpp>
+#include <omp.h>
+
+#ifndef FILETYPE
+#define FILETYPE MatrixMarket
+#endif  // FILETYPE
+#define MAKE_FN_NAME(prefix, name, suffix)  prefix ## name ## suffix
+#define FUNCTION_NAME(prefix, name, suffix) MAKE_FN_NAME(prefix, name, suffix)
+#define IO_LOAD_SIZE      FUNCTION_NAME(load, FILETYPE, Size)
+#define IO_LOAD_ROW_BLOCK FUNCTION_NAME(load, FILETYPE, RowBlock)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// The calibration result.
+///
+/// The stages are the sketcher, the orthogonalizer, the integrator, and the former (with the converters before them). The
+/// times of the integrator are per iteration.
+///
+struct Calibration {
+  double time;
+  double error;
+  mcnla::index_t iteration;
+  double times[4];       // The computing time of the stages, which scales with the number of rows
+  double comm_times[4];  // The communication time of the stages, which doesn't depend on the number of rows
+};
+
+/// The solver registry.
+using Registry = mcnla::isvd::SolverRegistry<mcnla::isvd::RowBlockDistTag, double>;
+
+/// The number of runs of each calibration job.
+const int num_test = 3;
+
+Calibration calibrate( const Registry::Entry &candidate, const mcnla::matrix::DenseMatrixRowMajor<double> &matrix_aj,
+                       const mcnla::index_t m, const mcnla::index_t n, const mcnla::index_t k, const mcnla::index_t p,
+                       const mcnla::index_t Nj, const double tol, const mcnla::index_t maxiter, const double scale,
+                       const MPI_Comm mpi_comm ) noexcept;
+
+double estimate( const Calibration &calibration, const double scale ) noexcept;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Main function
+///
+int main( int argc, char **argv ) {
+
+  // ====================================================================================================================== //
+  // Initialize MCNLA
+  mcnla::init(argc, argv, MPI_COMM_WORLD);
+  auto mpi_comm = MPI_COMM_WORLD;
+  auto mpi_size = mcnla::mpi::commSize(mpi_comm);
+  auto mpi_rank = mcnla::mpi::commRank(mpi_comm);
+  auto mpi_root = 0;
+
+  // ====================================================================================================================== //
+  // Display program information
+  if ( mpi_rank == mpi_root ) {
+    std::cout << "MCNLA "
+              << MCNLA_MAJOR_VERSION << "."
+              << MCNLA_MINOR_VERSION << "."
+              << MCNLA_PATCH_VERSION << " iSVD autotuning driver (row-block version)" << std::endl << std::endl;
+  }
+
+  // ====================================================================================================================== //
+  // Check input
+  if ( argc < 3 ) {
+    if ( mpi_rank == mpi_root ) {
+      std::cout << "Usage: " << argv[0]
+                << " <A-mtx-file> <config-file>"
+                   " [rank] [target-error] [sample-ratio] [tolerance] [maxiter]"
+                << std::endl << std::endl;
+      std::cout << "The target error is 1% above the smallest error of all candidates if it is not positive."
+                << std::endl << std::endl;
+      MPI_Abort(mpi_comm, 1);
+    }
+    MPI_Barrier(mpi_comm);
+  }
+
+  // ====================================================================================================================== //
+  // Load matrix size
+  mcnla::index_t m, n;
+  mcnla::io::IO_LOAD_SIZE<mcnla::Trans::TRANS>(m, n, argv[1]);
+
+  // ====================================================================================================================== //
+  // Load parameters
+  int argi = 2;
+  mcnla::index_t k       = ( argc > ++argi ) ? atof(argv[argi]) : 20;
+  double         target  = ( argc > ++argi ) ? atof(argv[argi]) : 0.0;
+  double         ratio   = ( argc > ++argi ) ? atof(argv[argi]) : 0.1;
+  double         tol     = ( argc > ++argi ) ? atof(argv[argi]) : 1e-3;
+  mcnla::index_t maxiter = ( argc > ++argi ) ? atof(argv[argi]) : 256;
+
+  const std::vector<mcnla::index_t> list_Nj = {1, 2, 4};
+  const std::vector<mcnla::index_t> list_p  = {std::max(k/4, 1), std::max(k/2, 1), k};
+
+  // Sample the leading rows
+  mcnla::index_t ms = std::min(m, std::max(mcnla::index_t(m * ratio), 4 * (k + list_p.back())));
+  const double scale = double(m) / ms;
+
+  if ( mpi_rank == mpi_root ) {
+    std::cout << "m = " << m
+            << ", n = " << n
+            << ", k = " << k
+            << ", sample = " << ms
+            << ", tol = " << tol
+            << ", maxiter = " << maxiter << std::endl;
+    std::cout << mpi_size << " nodes / "
+#ifdef _OPENMP
+              << omp_get_max_threads()
+#else  // _OPENMP
+              << 1
+#endif  // _OPENMP
+              << " threads per node" << std::endl;
+    std::cout << sizeof(mcnla::index_t)*8 << "bit integer" << std::endl << std::endl;
+  }
+  assert((k+list_p.back()) <= ms && ms <= n);
+
+  // ====================================================================================================================== //
+  // Load the sample
+  mcnla::isvd::Parameters<double> parameters(mpi_root, mpi_comm);
+  parameters.setSize(ms, n).setRank(k).setOverRank(list_p.back()).setNumSketchEach(1);
+  parameters.sync();
+
+  if ( mpi_rank == mpi_root ) {
+    std::cout << "Reading data from " << argv[1] << "." << std::endl << std::endl;
+  }
+  mcnla::matrix::DenseMatrixRowMajor<double> matrix_aj;
+  mcnla::io::IO_LOAD_ROW_BLOCK(matrix_aj, argv[1], parameters.rowrange());
+
+  // ====================================================================================================================== //
+  // Choose the candidates (all registered combinations of stages but the former for symmetric matrices)
+  std::vector<const Registry::Entry*> candidates;
+  for ( const auto &entry : Registry::instance().entries() ) {
+    if ( entry.former != mcnla::isvd::StageTraits<mcnla::isvd::RowBlockSymmetricFormer<double>>::name ) {
+      candidates.push_back(&entry);
+    }
+  }
+
+  // ====================================================================================================================== //
+  // Calibrate
+  struct Result {
+    const Registry::Entry *candidate;
+    mcnla::index_t Nj;
+    mcnla::index_t p;
+    Calibration calibration;
+  };
+  std::vector<Result> results;
+
+  if ( mpi_rank == mpi_root ) {
+    std::cout << std::fixed << std::setprecision(6);
+  }
+  for ( auto candidate : candidates ) {
+    for ( auto Nj : list_Nj ) {
+      for ( auto p : list_p ) {
+        auto calibration = calibrate(*candidate, matrix_aj, ms, n, k, p, Nj, tol, maxiter, scale, mpi_comm);
+        results.push_back({candidate, Nj, p, calibration});
+        if ( mpi_rank == mpi_root ) {
+          std::cout << candidate->sketcher << " + " << candidate->integrator << " + " << candidate->former
+                    << ", N = " << Nj * mpi_size << ", p = " << p
+                    << " | iteration: " << calibration.iteration
+                    << " | estimated time: " << calibration.time
+                    << " | error: " << calibration.error << std::endl;
+        }
+      }
+    }
+  }
+
+  // ====================================================================================================================== //
+  // Choose the fastest configuration meeting the target error (or the most accurate one if none does)
+  auto best = results.end();
+  for ( auto it = results.begin(); it != results.end(); ++it ) {
+    if ( std::isfinite(it->calibration.error) &&
+         (best == results.end() || it->calibration.error < best->calibration.error) ) {
+      best = it;
+    }
+  }
+  if ( best == results.end() ) {
+    if ( mpi_rank == mpi_root ) {
+      std::cout << "All calibration jobs failed!" << std::endl << std::endl;
+    }
+    MPI_Abort(mpi_comm, 1);
+  }
+  if ( target <= 0 ) {
+    target = best->calibration.error * 1.01;
+  }
+
+  auto chosen = best;
+  for ( auto it = results.begin(); it != results.end(); ++it ) {
+    if ( it->calibration.error <= target && it->calibration.time < chosen->calibration.time ) {
+      chosen = it;
+    }
+  }
+
+  // ====================================================================================================================== //
+  // Choose the number of threads
+  mcnla::index_t num_thread = 0;
+#ifdef _OPENMP
+  {
+    const auto max_thread = omp_get_max_threads();
+    double time = chosen->calibration.time;
+    num_thread = max_thread;
+    for ( auto t = max_thread / 2; t >= 1; t /= 2 ) {
+      omp_set_num_threads(t);
+      auto calibration = calibrate(*chosen->candidate, matrix_aj, ms, n, k, chosen->p, chosen->Nj, tol, maxiter, scale,
+                                   mpi_comm);
+      if ( calibration.time < time ) {
+        time = calibration.time;
+        num_thread = t;
+      }
+    }
+    omp_set_num_threads(max_thread);
+  }
+#endif  // _OPENMP
+
+  // ====================================================================================================================== //
+  // Save the configuration
+  if ( mpi_rank == mpi_root ) {
+    mcnla::isvd::Configuration config;
+    config.rank           = k;
+    config.num_sketch     = chosen->Nj * mpi_size;
+    config.over_rank      = chosen->p;
+    config.tolerance      = tol;
+    config.max_iteration  = maxiter;
+    config.num_thread     = num_thread;
+    config.sketcher       = chosen->candidate->sketcher;
+    config.orthogonalizer = chosen->candidate->orthogonalizer;
+    config.integrator     = chosen->candidate->integrator;
+    config.former         = chosen->candidate->former;
+    config.time           = chosen->calibration.time;
+    config.error          = chosen->calibration.error;
+
+    std::cout << std::endl;
+    std::cout << "Target error = " << target << std::endl;
+    std::cout << "Uses " << config.sketcher << " + " << config.integrator << " + " << config.former
+              << ", N = " << config.num_sketch << ", p = " << config.over_rank
+              << ", " << config.num_thread << " threads per node." << std::endl;
+    std::cout << "Write configuration into " << argv[2] << "." << std::endl << std::endl;
+    config.save(argv[2]);
+  }
+
+  // ====================================================================================================================== //
+  // Finalize MCNLA
+  mcnla::finalize();
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Runs a calibration job.
+///
+/// The job is run #num_test times, and the run of the shortest estimated time is kept. The times are the maximum over all
+/// MPI nodes; the error is norm(A - Uk Sk Vk')_F / norm(A)_F.
+///
+Calibration calibrate(
+    const Registry::Entry &candidate,
+    const mcnla::matrix::DenseMatrixRowMajor<double> &matrix_aj,
+    const mcnla::index_t m,
+    const mcnla::index_t n,
+    const mcnla::index_t k,
+    const mcnla::index_t p,
+    const mcnla::index_t Nj,
+    const double tol,
+    const mcnla::index_t maxiter,
+    const double scale,
+    const MPI_Comm mpi_comm
+) noexcept {
+  const auto mpi_root = 0;
+
+  // Initialize parameters
+  mcnla::isvd::Parameters<double> parameters(mpi_root, mpi_comm);
+  parameters.setSize(m, n).setRank(k).setOverRank(p).setNumSketchEach(Nj);
+  parameters.sync();
+
+  // Initialize stages
+  auto solver = candidate.factory(parameters);
+  mcnla::isvd::MatrixFromColBlockToAllConverter<double> fe_converter(parameters);
+  solver->setMaxIteration(maxiter);
+  solver->setTolerance(tol);
+  solver->initialize();
+  fe_converter.initialize();
+  auto matrix_v = parameters.createMatrixV();
+
+  Calibration calibration;
+  calibration.time = std::numeric_limits<double>::infinity();
+  for ( int t = 0; t < num_test; ++t ) {
+
+    // Run iSVD
+    MPI_Barrier(mpi_comm);
+    solver->setSeed(0);
+    (*solver)(matrix_aj);
+
+    // Gather time
+    const auto &integrator = solver->integrator();
+    const double iteration = std::max(solver->iteration(), mcnla::index_t(1));
+    Calibration run;
+    run.iteration     = solver->iteration();
+    run.times[0]      = solver->sketcher().time() + solver->soConverter().time();
+    run.times[1]      = solver->orthogonalizer().time() - solver->orthogonalizer().commTime()
+                      + solver->oiConverter().time();
+    run.times[2]      = (integrator.time() - integrator.commTime()) / iteration;
+    run.times[3]      = solver->ifConverter().time() + solver->former().time();
+    run.comm_times[0] = 0.0;
+    run.comm_times[1] = solver->orthogonalizer().commTime();
+    run.comm_times[2] = integrator.commTime() / iteration;
+    run.comm_times[3] = 0.0;
+    MPI_Allreduce(MPI_IN_PLACE, run.times, 4, MPI_DOUBLE, MPI_MAX, mpi_comm);
+    MPI_Allreduce(MPI_IN_PLACE, run.comm_times, 4, MPI_DOUBLE, MPI_MAX, mpi_comm);
+    run.time = estimate(run, scale);
+    if ( run.time < calibration.time ) {
+      calibration = run;
+    }
+  }
+
+  // Compute error
+  fe_converter(solver->matrixV().t(), matrix_v.t());
+  const auto &vector_s  = solver->vectorS();
+  auto matrix_uj = solver->matrixU().copy();
+  auto matrix_rj = matrix_aj.copy();
+  mcnla::matrix::DenseVector<double> nrms(2);
+  nrms(1) = mcnla::la::dot(matrix_rj.vec());
+  mcnla::la::mm(""_, vector_s.diag(), matrix_uj);
+  mcnla::la::mm(matrix_uj, matrix_v.t(), matrix_rj, -1.0, 1.0);
+  nrms(0) = mcnla::la::dot(matrix_rj.vec());
+  mcnla::mpi::allreduce(nrms, MPI_SUM, mpi_comm);
+  calibration.error = std::sqrt(nrms(0)) / std::sqrt(nrms(1));
+
+  return calibration;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Estimates the time of the full matrix.
+///
+/// The computation of each stage (and of each iteration of the integrator) scales with the number of rows, while the
+/// reductions of the orthogonalizer and the integrator (of l-by-l matrices) don't. The integrator is assumed to take as
+/// many iterations as the sample.
+///
+double estimate(
+    const Calibration &calibration,
+    const double scale
+) noexcept {
+  const auto &times = calibration.times, &comm_times = calibration.comm_times;
+  const double iteration = std::max(calibration.iteration, mcnla::index_t(1));
+  return (times[0] + times[1] + times[3]) * scale + comm_times[0] + comm_times[1] + comm_times[3]
+       + (times[2] * scale + comm_times[2]) * iteration;
+}
@@ -0,0 +1,53 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file    src/trace2json.cpp
+/// @brief   The driver for merging binary trace files into a Chrome trace file.
+///
+/// @author  Mu Yang <<emfomy@gmail.com>>
+///
+
+#include <fstream>
+#include <iostream>
+#include <mcnla.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Main function
+///
+int main( int argc, char **argv ) {
+
+  // ====================================================================================================================== //
+  // Display program information
+  std::cout << "MCNLA "
+            << MCNLA_MAJOR_VERSION << "."
+            << MCNLA_MINOR_VERSION << "."
+            << MCNLA_PATCH_VERSION << " driver for merging binary trace files into a Chrome trace file"
+            << std::endl << std::endl;
+
+  // ====================================================================================================================== //
+  // Check input
+  if ( argc < 3 ) {
+    std::cout << "Usage: " << argv[0] << " <json file> <trace file> [trace file ...]" << std::endl << std::endl;
+    abort();
+  }
+
+  // ====================================================================================================================== //
+  // Load traces
+  std::vector<std::vector<mcnla::utility::TraceEvent>> events;
+  for ( int i = 2; i < argc; ++i ) {
+    std::cout << "Reading data from " << argv[i] << " ........ " << std::flush;
+    mcnla::mpi_int_t rank;
+    auto rank_events = mcnla::io::loadBinaryTrace(argv[i], rank);
+    if ( static_cast<std::size_t>(rank) >= events.size() ) {
+      events.resize(rank+1);
+    }
+    events[rank] = std::move(rank_events);
+    std::cout << "Done!" << std::endl;
+  }
+
+  // ====================================================================================================================== //
+  // Save trace
+  std::cout << "Writing data into " << argv[1] << " ........ " << std::flush;
+  std::ofstream fout(argv[1]);
+  mcnla::io::writeChromeTrace(fout, events);
+  std::cout << "Done!" << std::endl;
+
+}